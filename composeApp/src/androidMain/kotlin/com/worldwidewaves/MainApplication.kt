@@ -34,6 +34,7 @@ import com.worldwidewaves.shared.WWWShutdownHandler
 import com.worldwidewaves.shared.di.androidModule
 import com.worldwidewaves.shared.di.initializeSimulationMode
 import com.worldwidewaves.shared.di.sharedModule
+import com.worldwidewaves.shared.events.geometry.AreaGeometryCache
 import com.worldwidewaves.shared.notifications.NotificationChannelManager
 import com.worldwidewaves.shared.utils.CloseableCoroutineScope
 import com.worldwidewaves.shared.utils.CrashlyticsLogger
@@ -211,6 +212,18 @@ open class MainApplication :
         }
     }
 
+    /** Releases cached event area geometry under memory pressure (see [AreaGeometryCache]). */
+    override fun onTrimMemory(level: Int) {
+        super.onTrimMemory(level)
+        val trimLevel =
+            when {
+                level >= TRIM_MEMORY_BACKGROUND || level == TRIM_MEMORY_RUNNING_CRITICAL -> AreaGeometryCache.TrimLevel.CRITICAL
+                level >= TRIM_MEMORY_RUNNING_LOW -> AreaGeometryCache.TrimLevel.MODERATE
+                else -> return
+            }
+        AreaGeometryCache.shared.trim(trimLevel)
+    }
+
     override fun onTerminate() {
         wwwShutdownHandler.onAppShutdown()
         get<CloseableCoroutineScope>().close()
@@ -86,10 +86,13 @@ import com.worldwidewaves.shared.map.EventMapConfig
 import com.worldwidewaves.shared.map.LocationProvider
 import com.worldwidewaves.shared.map.MapCameraPosition
 import com.worldwidewaves.shared.map.MapFeatureState
+import com.worldwidewaves.shared.map.PolygonLodCache
 import com.worldwidewaves.shared.position.PositionManager
 import com.worldwidewaves.shared.toMapLibrePolygon
 import com.worldwidewaves.shared.ui.components.DownloadProgressIndicator
 import com.worldwidewaves.shared.ui.components.LoadingIndicator
+import com.worldwidewaves.shared.utils.RenderStage
+import com.worldwidewaves.shared.utils.RenderTrace
 import com.worldwidewaves.utils.AndroidLocationProvider
 import com.worldwidewaves.utils.AndroidMapAvailabilityChecker
 import com.worldwidewaves.utils.CheckGPSEnable
@@ -169,6 +172,10 @@ class AndroidEventMap(
     // Position manager for GPS lifecycle
     private val positionManager: PositionManager by inject(PositionManager::class.java)
 
+    // Wave polygon level of detail, both only used on the UI thread
+    private val polygonLodCache = PolygonLodCache()
+    private var lastWaveFrame: List<Polygon> = emptyList() // Full resolution, for LOD re-renders
+
     /**
      * Setup map state variables and return them as a data class
      */
@@ -696,6 +703,7 @@ class AndroidEventMap(
                 mapLibreView.getMapAsync { map ->
                     // Save reference so we can refresh location component later
                     currentMap = map
+                    map.addOnCameraIdleListener { refreshPolygonLevelOfDetail() }
 
                     // Setup Map
                     this@AndroidEventMap.setupMap(
@@ -1000,10 +1008,30 @@ class AndroidEventMap(
         clearPolygons: Boolean,
     ) {
         context.runOnUiThread {
-            val mapLibrePolygons = wavePolygons.map { it.toMapLibrePolygon() }
-            mapLibreAdapter.addWavePolygons(mapLibrePolygons, clearPolygons)
+            val vertexCount = wavePolygons.sumOf { it.size }
+            val mapLibrePolygons =
+                RenderTrace.trace(RenderStage.MAP_UPDATE, event.id, wavePolygons.size, vertexCount) {
+                    // Decimate for the current zoom band: fewer vertices to convert and tessellate
+                    lastWaveFrame = wavePolygons
+                    polygonLodCache
+                        .polygonsForZoom(wavePolygons, currentMap?.cameraPosition?.zoom)
+                        .map { it.toMapLibrePolygon() }
+                }
+            RenderTrace.trace(RenderStage.LAYER_UPDATE, event.id, wavePolygons.size, vertexCount) {
+                mapLibreAdapter.addWavePolygons(mapLibrePolygons, clearPolygons)
+            }
         }
     }
+
+    /**
+     * Re-renders the last wave frame when the camera settles in another zoom band.
+     * Needed once the wave is DONE, when no further progression ticks would pick up the new band.
+     */
+    private fun refreshPolygonLevelOfDetail() {
+        val zoom = currentMap?.cameraPosition?.zoom
+        if (lastWaveFrame.isEmpty() || !polygonLodCache.bandChanged(zoom)) return
+        updateWavePolygons(lastWaveFrame, clearPolygons = true)
+    }
 }
 
 // ----------------------------------------------------------------------------
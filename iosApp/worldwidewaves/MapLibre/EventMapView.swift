@@ -38,8 +38,9 @@ struct EventMapView: UIViewRepresentable {
         WWWLog.d(Self.tag, "Style URL: \(styleURL)")
         WWWLog.d(Self.tag, "Initial camera position will be set by AbstractEventMap.setupMap()")
 
-        let mapView = MLNMapView(frame: .zero)
-        mapView.autoresizingMask = [.flexibleWidth, .flexibleHeight]
+        // Reuse a map view released by a previous map screen when available (see MapViewPool)
+        let url = resolveStyleURL()
+        let (mapView, styleReused) = MapViewPool.shared.dequeue(styleURL: url)
 
         // Ensure no content insets (prevents borders/margins in map content)
         mapView.contentInset = .zero
@@ -55,11 +56,21 @@ struct EventMapView: UIViewRepresentable {
         // moveToMapBounds(), or moveToCenter() based on mapConfig.initialCameraPosition
         // This ensures iOS matches Android behavior (event-specific positioning, not hard-coded)
 
-        // Configure style URL
-        configureStyleURL(for: mapView)
+        // Configure style URL (a reused view keeps its already loaded style)
+        if !styleReused {
+            mapView.styleURL = url
+            WWWLog.i(Self.tag, "[SUCCESS] Style URL set on map view: \(url.absoluteString)")
+        }
 
         // Create and configure wrapper
-        _ = createAndConfigureWrapper(for: mapView)
+        let mapWrapper = createAndConfigureWrapper(for: mapView)
+
+        // MapLibre will not report didFinishLoading again for a reused style
+        if styleReused {
+            DispatchQueue.main.async {
+                mapWrapper.replayStyleLoaded()
+            }
+        }
 
         return mapView
     }
@@ -99,26 +110,20 @@ struct EventMapView: UIViewRepresentable {
         WWWLog.i(Self.tag, gestureStatus)
     }
 
-    private func configureStyleURL(for mapView: MLNMapView) {
-        let url: URL
+    private func resolveStyleURL() -> URL {
         if styleURL.hasPrefix("http://") || styleURL.hasPrefix("https://") {
             guard let remoteURL = URL(string: styleURL) else {
                 WWWLog.e(Self.tag, "[ERROR] Invalid remote style URL: \(styleURL)")
                 // Fallback to local default style if remote URL is malformed
-                url = URL(fileURLWithPath: styleURL)
                 WWWLog.w(Self.tag, "Falling back to local style path")
-                mapView.styleURL = url
-                return
+                return URL(fileURLWithPath: styleURL)
             }
-            url = remoteURL
-            WWWLog.d(Self.tag, "Using remote style URL: \(url)")
-        } else {
-            url = URL(fileURLWithPath: styleURL)
-            WWWLog.i(Self.tag, "Local file path: \(styleURL)")
-            validateStyleFile(at: styleURL)
+            WWWLog.d(Self.tag, "Using remote style URL: \(remoteURL)")
+            return remoteURL
         }
-        mapView.styleURL = url
-        WWWLog.i(Self.tag, "[SUCCESS] Style URL set on map view: \(url.absoluteString)")
+        WWWLog.i(Self.tag, "Local file path: \(styleURL)")
+        validateStyleFile(at: styleURL)
+        return URL(fileURLWithPath: styleURL)
     }
 
     private func validateStyleFile(at path: String) {
@@ -152,14 +157,9 @@ struct EventMapView: UIViewRepresentable {
     }
 
     func updateUIView(_ mapView: MLNMapView, context: Context) {
-        // Check for pending polygons and render them
-        _ = IOSMapBridge.renderPendingPolygons(eventId: eventId)
-
-        // Check for pending bbox draw and render it
-        _ = IOSMapBridge.renderPendingBbox(eventId: eventId)
-
-        // Check for pending camera commands and execute them
-        IOSMapBridge.executePendingCameraCommand(eventId: eventId)
+        // Pending camera commands, polygons and bbox are applied on the next display refresh
+        // together with any other requests made during this frame
+        MapRenderScheduler.shared.scheduleAll(eventId: eventId)
     }
 }
 
@@ -34,6 +34,8 @@ import CoreLocation
 /// ## Threading Model
 /// - **Main thread only**: All MapLibre operations must occur on main thread (UIKit requirement)
 /// - Kotlin callers are responsible for dispatching to main thread before calling bridge methods
+/// - Wave polygon shapes are built on the wrapper's `WaveShapePipeline` queue; bridge methods
+///   return once the work is queued, and the style is mutated back on main
 ///
 /// ## Registry Pattern
 /// Uses MapWrapperRegistry (Kotlin/Native singleton) to store weak references to MapLibreViewWrapper:
@@ -101,6 +103,36 @@ import CoreLocation
         wrapper.addWavePolygons(polygons: polygons, clearExisting: clearExisting)
     }
 
+    /// Renders wave polygons from a packed coordinate buffer.
+    ///
+    /// ## Purpose
+    /// Same as `renderWavePolygons`, but takes the flat form produced by Kotlin's
+    /// `PackedPolygonBuffer` so that no per-vertex objects are created on either side of the bridge.
+    ///
+    /// ## Threading Model
+    /// Main thread only (MapLibre/UIKit requirement)
+    ///
+    /// - Parameters:
+    ///   - eventId: Unique event identifier (registry key)
+    ///   - coordinates: Interleaved lat/lng doubles for all rings
+    ///   - ringOffsets: Int32 vertex offsets, ringCount + 1 entries
+    ///   - clearExisting: Whether to clear existing polygons before adding new ones
+    /// - Important: Must be called on main thread
+    /// - Note: Called from Kotlin via @objc bridge
+    @objc public static func renderPackedWavePolygons(
+        eventId: String,
+        coordinates: Data,
+        ringOffsets: Data,
+        clearExisting: Bool
+    ) {
+        guard let wrapper = Shared.MapWrapperRegistry.shared.getWrapper(eventId: eventId) as? MapLibreViewWrapper else {
+            WWWLog.w("IOSMapBridge", "No wrapper found for event: \(eventId)")
+            return
+        }
+
+        wrapper.addWavePolygons(packedCoordinates: coordinates, ringOffsets: ringOffsets, clearExisting: clearExisting)
+    }
+
     /// Checks for pending polygons in the registry and renders them if found.
     ///
     /// ## Purpose
@@ -115,30 +147,28 @@ import CoreLocation
     ///
     /// ## Rendering Flow
     /// 1. Check if MapLibreViewWrapper is registered (map must exist)
-    /// 2. Check if pending polygons exist in registry
-    /// 3. Retrieve polygon coordinate data from registry
-    /// 4. Convert Kotlin coordinate pairs to Swift CLLocationCoordinate2D
-    /// 5. Render polygons on map via wrapper
-    /// 6. Clear pending polygons from registry (consumed)
+    /// 2. Take pending polygon data from registry (atomic get-and-clear)
+    /// 3. Hand the packed coordinate buffer to the wrapper as NSData
+    /// 4. Render polygons on map via wrapper
     ///
     /// ## Threading Model
     /// Main thread only (MapLibre/UIKit requirement)
     ///
-    /// ## Coordinate Conversion
-    /// Converts Kotlin Pair<Double, Double> to Swift CLLocationCoordinate2D:
-    /// - Kotlin: `Pair(latitude: Double, longitude: Double)`
-    /// - Swift: `CLLocationCoordinate2D(latitude: Double, longitude: Double)`
+    /// ## Coordinate Format
+    /// Pending polygons are stored as a Kotlin `PackedPolygonBuffer`:
+    /// - coordinates: interleaved lat/lng doubles (same layout as CLLocationCoordinate2D)
+    /// - ringOffsets: Int32 vertex offsets, ringCount + 1 entries
     ///
     /// ## Error Handling
     /// - No wrapper registered: Logs warning, returns (polygons remain pending for retry)
     /// - No pending polygons: Logs verbose, returns (normal case)
-    /// - Invalid coordinates: Filtered out via compactMap (nil coordinates dropped)
+    /// - Malformed offsets: Rings past the end of the buffer are dropped by the wrapper
     ///
     /// - Parameters:
     ///   - eventId: Unique event identifier (registry key)
     /// - Important: Must be called on main thread
     /// - Important: Call periodically after map style loads to catch pending polygons
-    /// - Note: Clears pending polygons after successful rendering (one-time consumption)
+    /// - Note: Pending polygons are consumed when taken (one-time consumption)
     @objc public static func renderPendingPolygons(eventId: String) -> Bool {
         WWWLog.v("IOSMapBridge", "renderPendingPolygons called for: \(eventId)")
 
@@ -147,43 +177,82 @@ import CoreLocation
             return false
         }
 
-        let hasPending = Shared.MapWrapperRegistry.shared.hasPendingPolygons(eventId: eventId)
-
-        guard hasPending else {
+        // Take atomically: a frame Kotlin publishes while this one renders stays pending
+        guard let polygonData = Shared.MapWrapperRegistry.shared.takePendingPolygons(eventId: eventId) else {
             WWWLog.v("IOSMapBridge", "No pending polygons for event: \(eventId)")
             return false
         }
 
-        guard let polygonData = Shared.MapWrapperRegistry.shared.getPendingPolygons(eventId: eventId) else {
-            WWWLog.w(
-                "IOSMapBridge",
-                "[WARNING] hasPendingPolygons=true but getPendingPolygons returned nil for event: \(eventId)"
-            )
-            return false
+        if let delta = polygonData.delta {
+            return WWWSignposts.shared.measure(
+                .bridgeRender,
+                eventId: eventId,
+                polygons: Int(delta.ringCount),
+                vertices: Int(delta.changed.vertexCount)
+            ) {
+                renderPendingDelta(
+                    delta,
+                    eventId: eventId,
+                    wrapper: wrapper,
+                    singleSource: polygonData.renderMode == WavePolygonRenderMode.singleSource
+                )
+            }
         }
 
+        let packed = polygonData.packed
         WWWLog.i(
             "IOSMapBridge",
-            "[WAVE] Rendering \(polygonData.coordinates.count) pending polygons for event: \(eventId)"
+            "[WAVE] Rendering \(packed.ringCount) pending polygons for event: \(eventId)"
         )
 
-        // Convert coordinate pairs to CLLocationCoordinate2D arrays
-        let coordinateArrays: [[CLLocationCoordinate2D]] = polygonData.coordinates.map { polygon in
-            polygon.compactMap { coordPair -> CLLocationCoordinate2D? in
-                guard let lat = coordPair.first?.doubleValue, let lng = coordPair.second?.doubleValue else {
-                    return nil
-                }
-                return CLLocationCoordinate2D(latitude: lat, longitude: lng)
-            }
+        WWWSignposts.shared.measure(
+            .bridgeRender,
+            eventId: eventId,
+            polygons: Int(packed.ringCount),
+            vertices: Int(packed.vertexCount)
+        ) {
+            // Packed buffers cross the bridge as two NSData blobs (no per-vertex boxing)
+            wrapper.addWavePolygons(
+                packedCoordinates: packed.coordinateData(),
+                ringOffsets: packed.ringOffsetData(),
+                clearExisting: polygonData.clearExisting,
+                singleSource: polygonData.renderMode == WavePolygonRenderMode.singleSource
+            )
         }
 
-        // Render on map
-        wrapper.addWavePolygons(polygons: coordinateArrays, clearExisting: polygonData.clearExisting)
+        WWWLog.i("IOSMapBridge", "[SUCCESS] Rendered \(packed.ringCount) polygons")
+        return true
+    }
 
-        // Clear after rendering - next update will overwrite with latest state
-        // This is OK: we only need to show the LATEST wave state, intermediate updates can be skipped
-        Shared.MapWrapperRegistry.shared.clearPendingPolygons(eventId: eventId)
-        WWWLog.i("IOSMapBridge", "[SUCCESS] Rendered \(polygonData.coordinates.count) polygons, cleared from registry")
+    /// Applies a pending incremental update (Kotlin `WavePolygonDelta`).
+    ///
+    /// Only the rings that changed since the previous frame cross the bridge. If the wrapper's
+    /// rings no longer match the delta base, the delta is dropped and Kotlin is asked to send
+    /// the next frame in full.
+    private static func renderPendingDelta(
+        _ delta: WavePolygonDelta,
+        eventId: String,
+        wrapper: MapLibreViewWrapper,
+        singleSource: Bool
+    ) -> Bool {
+        let applied = wrapper.applyWavePolygonDelta(
+            baseRingCount: Int(delta.baseRingCount),
+            ringCount: Int(delta.ringCount),
+            changedIndices: delta.changedIndexData(),
+            packedCoordinates: delta.changed.coordinateData(),
+            ringOffsets: delta.changed.ringOffsetData(),
+            singleSource: singleSource
+        )
+
+        guard applied else {
+            Shared.MapWrapperRegistry.shared.requestFullPolygonResync(eventId: eventId)
+            return false
+        }
+
+        WWWLog.v(
+            "IOSMapBridge",
+            "[WAVE] Applied delta: \(delta.changed.ringCount)/\(delta.ringCount) rings for event: \(eventId)"
+        )
         return true
     }
 
@@ -220,6 +289,8 @@ import CoreLocation
 
         WWWLog.d("IOSMapBridge", "Clearing wave polygons for event: \(eventId)")
         wrapper.clearWavePolygons()
+        // Kotlin's delta encoder still holds the old rings: next frame must be complete
+        Shared.MapWrapperRegistry.shared.requestFullPolygonResync(eventId: eventId)
     }
 
     // MARK: - Attribution
@@ -276,8 +347,8 @@ import CoreLocation
     /// Main thread only (UIKit requirement)
     ///
     /// ## Use Cases
-    /// - Called from IosMapLibreAdapter.getMinZoomLevel() before constraint enforcement
-    /// - Prevents infinite unzoom when constraints are applied before registry updates
+    /// - Diagnostics: checks the applied value against the one solved by `CameraConstraintSolver`
+    ///   (IosMapLibreAdapter.getMinZoomLevel() returns the solved value without calling Swift)
     ///
     /// - Parameters:
     ///   - eventId: Unique event identifier (registry key)
@@ -488,7 +559,8 @@ import CoreLocation
 
             // Only clear command if execution succeeded
             if success {
-                Shared.MapWrapperRegistry.shared.clearPendingCameraCommand(eventId: eventId)
+                // Clear this command only: an animation Kotlin stored meanwhile stays pending
+                Shared.MapWrapperRegistry.shared.clearPendingCameraCommand(eventId: eventId, command: command)
                 WWWLog.i(
                     "IOSMapBridge",
                     "[SUCCESS] Camera command executed and cleared for event: \(eventId)"
@@ -627,7 +699,10 @@ import CoreLocation
         let originalBbox = command.originalEventBounds
         let isWindowMode = command.applyZoomSafetyMargin
 
-        WWWLog.i("IOSMapBridge", "Setting camera constraint bounds (WINDOW mode: \(isWindowMode))")
+        WWWLog.i(
+            "IOSMapBridge",
+            "Setting camera constraint bounds (WINDOW mode: \(isWindowMode), minZoom: \(command.minZoom))"
+        )
         WWWLog.d(
             "IOSMapBridge",
             """
@@ -650,11 +725,7 @@ import CoreLocation
             constraintSwLng: constraintBbox.minLongitude,
             constraintNeLat: constraintBbox.maxLatitude,
             constraintNeLng: constraintBbox.maxLongitude,
-            eventSwLat: originalBbox?.minLatitude ?? constraintBbox.minLatitude,
-            eventSwLng: originalBbox?.minLongitude ?? constraintBbox.minLongitude,
-            eventNeLat: originalBbox?.maxLatitude ?? constraintBbox.maxLatitude,
-            eventNeLng: originalBbox?.maxLongitude ?? constraintBbox.maxLongitude,
-            isWindowMode: isWindowMode
+            minZoom: command.minZoom
         )
     }
 
@@ -49,6 +49,23 @@ NS_ASSUME_NONNULL_BEGIN
 - (double)getMinZoom;
 - (void)setAttributionMarginsWithLeft:(NSInteger)left top:(NSInteger)top right:(NSInteger)right bottom:(NSInteger)bottom;
 - (void)addWavePolygons:(NSArray<NSArray<id> *> *)polygons clearExisting:(BOOL)clearExisting;
+// Packed variant: interleaved lat/lng doubles plus Int32 ring offsets (ringCount + 1 entries)
+- (void)addWavePolygonsWithPackedCoordinates:(NSData *)packedCoordinates
+                                 ringOffsets:(NSData *)ringOffsets
+                               clearExisting:(BOOL)clearExisting;
+// singleSource=YES renders every polygon through one MLNMultiPolygon source and one fill layer
+- (void)addWavePolygonsWithPackedCoordinates:(NSData *)packedCoordinates
+                                 ringOffsets:(NSData *)ringOffsets
+                               clearExisting:(BOOL)clearExisting
+                                singleSource:(BOOL)singleSource;
+// Ring-level delta: resize to ringCount, replace rings at changedIndices (Int32) with the packed rings.
+// Returns NO when the current ring count differs from baseRingCount.
+- (BOOL)applyWavePolygonDeltaWithBaseRingCount:(NSInteger)baseRingCount
+                                     ringCount:(NSInteger)ringCount
+                                changedIndices:(NSData *)changedIndices
+                             packedCoordinates:(NSData *)packedCoordinates
+                                   ringOffsets:(NSData *)ringOffsets
+                                  singleSource:(BOOL)singleSource;
 - (void)clearWavePolygons;
 - (void)drawOverrideBboxWithSwLat:(double)swLat swLng:(double)swLng neLat:(double)neLat neLng:(double)neLng;
 - (void)setOnMapClickListener:(void (^)(double latitude, double longitude))listener;
@@ -65,6 +82,10 @@ NS_ASSUME_NONNULL_BEGIN
 + (void)renderWavePolygons:(NSString *)eventId
                   polygons:(NSArray<NSArray<id> *> *)polygons
              clearExisting:(BOOL)clearExisting;
++ (void)renderPackedWavePolygons:(NSString *)eventId
+                     coordinates:(NSData *)coordinates
+                     ringOffsets:(NSData *)ringOffsets
+                   clearExisting:(BOOL)clearExisting;
 + (void)clearWavePolygons:(NSString *)eventId;
 @end
 
@@ -22,7 +22,6 @@ import Foundation
 import MapLibre
 import UIKit
 import CoreLocation
-import MapKit
 import Shared
 
 // Note: File exceeds 1000 lines due to comprehensive MapLibre feature set
@@ -44,24 +43,24 @@ import Shared
     private var waveLayerIds: [String] = []
     private var waveSourceIds: [String] = []
 
+    // Single-source render mode: one multi-polygon source + one fill layer for the whole wave
+    private static let waveSingleSourceId = "wave-polygons-source"
+    private static let waveSingleLayerId = "wave-polygons-layer"
+    private var waveSingleSource: MLNShapeSource?
+
+    // Shapes and accessibility geometry are built off main; only style mutation happens here
+    private let wavePipeline = WaveShapePipeline()
+
+    // Wave update waiting for MapLibre to render it (RenderStage.FRAME)
+    private var pendingFrameInterval: WWWSignposts.Interval?
+
     // Queue for polygons that arrive before style loads
-    // Wave progression is cumulative - only most recent set needed
-    private var pendingPolygons: [[CLLocationCoordinate2D]]?
+    // Wave progression is cumulative - only most recent prepared frame needed
+    private var pendingWaveFrame: PreparedWaveFrame?
     private var styleIsLoaded: Bool = false
 
-    // Queue for constraint bounds that arrive before style loads
-    private var pendingConstraintBounds: MLNCoordinateBounds?
-    private var pendingEventBounds: MLNCoordinateBounds?
-    private var pendingIsWindowMode: Bool = false
-
     // Constraint bounds for gesture clamping
     private var currentConstraintBounds: MLNCoordinateBounds?
-    private var currentEventBounds: MLNCoordinateBounds?
-
-    // Min zoom locking (matches Android minZoomLocked mechanism)
-    private var minZoomLocked: Bool = false
-    private var lockedMinZoom: Double = 0.0
-    private var minZoomUsedInvalidDimensions: Bool = false
 
     // MARK: - Accessibility State
     private var currentUserPosition: CLLocationCoordinate2D?
@@ -69,14 +68,26 @@ import Shared
     private var currentEventRadius: Double = 0
     private var currentEventName: String?
     private var currentWavePolygons: [[CLLocationCoordinate2D]] = []
+    private var currentWaveCenters: [CLLocationCoordinate2D?] = []
+
+    // Elements are reused across updates (only labels and frames change); see updateMapAccessibility
+    private static let accessibilityUpdateDelay: TimeInterval = 0.5
+    private var accessibilityUpdateScheduled = false
+    private var accessibilityDirty = false
+    private var accessibilityStatusObserver: NSObjectProtocol?
+    private var summaryElement: UIAccessibilityElement?
+    private var userPositionElement: UIAccessibilityElement?
+    private var eventAreaElement: UIAccessibilityElement?
+    private var waveElements: [UIAccessibilityElement] = []
 
     // MARK: - Location Component
 
-    /// User location annotation (matches Android styling)
-    private var userLocationAnnotation: MLNPointAnnotation?
+    /// User location marker: style source updated in place (matches Android styling)
+    private let userLocationLayer = UserLocationLayer()
     private var isLocationComponentEnabled: Bool = false
-    private var userLocationAnnotationView: MKAnnotationView?
-    private var pulseLayer: CAShapeLayer?
+
+    // Tap recognizer added by setMapView (removed again when the view returns to MapViewPool)
+    private var mapTapGesture: UITapGestureRecognizer?
 
     @objc public override init() {
         super.init()
@@ -86,6 +97,14 @@ import Shared
     deinit {
         WWWLog.w(Self.tag, "[MEMORY] Deinitializing MapLibreViewWrapper for event: \(eventId ?? "unknown")")
 
+        if let observer = accessibilityStatusObserver {
+            NotificationCenter.default.removeObserver(observer)
+        }
+
+        if let eventId = eventId {
+            MapRenderScheduler.shared.cancel(eventId: eventId)
+        }
+
         // Clean up to prevent memory leaks
         if let mapView = mapView {
             // Remove all gesture recognizers
@@ -95,11 +114,8 @@ import Shared
                 }
             }
 
-            // Remove user location annotation if present
-            if let annotation = userLocationAnnotation {
-                mapView.removeAnnotation(annotation)
-                userLocationAnnotation = nil
-            }
+            // Remove user location layers if present
+            userLocationLayer.removeFromStyle()
 
             // Clear delegate to prevent retention cycle
             mapView.delegate = nil
@@ -127,24 +143,69 @@ import Shared
         tapGesture.numberOfTouchesRequired = 1
         tapGesture.delegate = self  // Allow simultaneous recognition with MapLibre gestures
         mapView.addGestureRecognizer(tapGesture)
+        mapTapGesture = tapGesture
 
         WWWLog.d(Self.tag, "Map view configured successfully for event: \(eventId ?? "nil")")
     }
 
+    /// Bound map view, if still alive (MapViewPool checks it is off screen before detaching it).
+    var attachedMapView: MLNMapView? { mapView }
+
+    /// Unbinds the map view so MapViewPool can hand it to another screen.
+    ///
+    /// Removes everything this wrapper added (wave and bbox style objects, location marker,
+    /// tap recognizer, delegate, zoom limits) and keeps the loaded style itself.
+    /// - Returns: The detached map view, or nil if it was already released
+    @objc public func detachMapView() -> MLNMapView? {
+        guard let mapView = mapView else { return nil }
+        WWWLog.d(Self.tag, "Detaching map view for event: \(eventId ?? "nil")")
+
+        clearWavePolygons()
+        if let style = mapView.style {
+            if let layer = style.layer(withIdentifier: "bbox-override-line") {
+                style.removeLayer(layer)
+            }
+            if let source = style.source(withIdentifier: "bbox-override-source") {
+                style.removeSource(source)
+            }
+        }
+
+        userLocationLayer.removeFromStyle()
+        mapView.accessibilityElements = nil
+        resetAccessibilityElements()
+        if let tapGesture = mapTapGesture {
+            mapView.removeGestureRecognizer(tapGesture)
+            mapTapGesture = nil
+        }
+
+        currentConstraintBounds = nil
+        mapView.delegate = nil
+        self.mapView = nil
+        return mapView
+    }
+
+    /// Replays style-loaded handling for a pooled map view whose style is already loaded
+    /// (MapLibre does not call didFinishLoading again for it).
+    @objc public func replayStyleLoaded() {
+        guard let mapView = mapView, let style = mapView.style else { return }
+        WWWLog.i(Self.tag, "[STYLE] Reusing loaded style for event: \(eventId ?? "unknown")")
+        self.mapView(mapView, didFinishLoading: style)
+    }
+
     // Justified: Initial setup with multiple callbacks registration (hard to split without breaking flow)
     @objc public func setEventId(_ eventId: String) {
         self.eventId = eventId
 
-        // Register render callback - invoked immediately when polygons update
+        // Register render callback - polygon updates are coalesced to one flush per display refresh
         Shared.MapWrapperRegistry.shared.setRenderCallback(eventId: eventId) { [weak self] in
             guard self != nil else { return }
-            _ = IOSMapBridge.renderPendingPolygons(eventId: eventId)
+            MapRenderScheduler.shared.schedulePolygons(eventId: eventId)
         }
 
-        // Register camera callback - invoked immediately when camera commands arrive
+        // Register camera callback - camera commands run in the same per-frame flush, before polygons
         Shared.MapWrapperRegistry.shared.setCameraCallback(eventId: eventId) { [weak self] in
             guard self != nil else { return }
-            IOSMapBridge.executePendingCameraCommand(eventId: eventId)
+            MapRenderScheduler.shared.scheduleCamera(eventId: eventId)
         }
 
         // Register map click callback - stores callback directly on wrapper (no registry lookup)
@@ -157,13 +218,6 @@ import Shared
             }
         }
 
-        // Register min zoom callback - provides real-time min zoom to Kotlin
-        Shared.MapWrapperRegistry.shared.setGetActualMinZoomCallback(eventId: eventId) { [weak self] in
-            guard let self = self, let mapView = self.mapView else { return }
-            let actualMinZoom = mapView.minimumZoomLevel
-            Shared.MapWrapperRegistry.shared.updateActualMinZoom(eventId: eventId, actualMinZoom: actualMinZoom)
-        }
-
         // Register location component callback - controls user position marker
         Shared.MapWrapperRegistry.shared.setLocationComponentCallback(eventId: eventId) { [weak self] enabled in
             guard let self = self else { return }
@@ -355,18 +409,17 @@ import Shared
 
     // MARK: - Camera Constraints
 
-    // swiftlint:disable function_parameter_count function_body_length cyclomatic_complexity
-    // Justified: Camera constraint logic requires validation, bounds setup, and multiple conditionals
+    /// Applies camera constraints solved in Kotlin (`CameraConstraintSolver`).
+    ///
+    /// `constraint*` bound the camera center (gesture clamping in `shouldChangeFrom`), `minZoom`
+    /// keeps pixels outside the event area off screen; NaN keeps the current min zoom. Neither
+    /// needs the style, so they apply immediately.
     @objc public func setBoundsForCameraTarget(
         constraintSwLat: Double,
         constraintSwLng: Double,
         constraintNeLat: Double,
         constraintNeLng: Double,
-        eventSwLat: Double,
-        eventSwLng: Double,
-        eventNeLat: Double,
-        eventNeLng: Double,
-        isWindowMode: Bool
+        minZoom: Double
     ) -> Bool {
         guard let mapView = mapView else {
             WWWLog.w(Self.tag, "Cannot set bounds - mapView is nil")
@@ -395,209 +448,23 @@ import Shared
             return false
         }
 
-        // Create constraint bounds (shrunk bounds for gesture enforcement)
-        let constraintSouthwest = CLLocationCoordinate2D(latitude: constraintSwLat, longitude: constraintSwLng)
-        let constraintNortheast = CLLocationCoordinate2D(latitude: constraintNeLat, longitude: constraintNeLng)
-        let constraintBounds = MLNCoordinateBounds(sw: constraintSouthwest, ne: constraintNortheast)
-
-        // Create event bounds (original bounds for min zoom calculation)
-        let eventSouthwest = CLLocationCoordinate2D(latitude: eventSwLat, longitude: eventSwLng)
-        let eventNortheast = CLLocationCoordinate2D(latitude: eventNeLat, longitude: eventNeLng)
-        let eventBounds = MLNCoordinateBounds(sw: eventSouthwest, ne: eventNortheast)
-
-        // If style not loaded yet, queue bounds for later application
-        guard styleIsLoaded, mapView.style != nil else {
-            WWWLog.i(
-                Self.tag,
-                "Style not loaded - queueing constraint bounds and event bounds"
-            )
-            pendingConstraintBounds = constraintBounds
-            pendingEventBounds = eventBounds
-            pendingIsWindowMode = isWindowMode
-            return true  // Return true - will be applied when style loads
-        }
-
-        // Check if min zoom already locked (matches Android minZoomLocked mechanism)
-        // Allow recalculation only if previously used invalid dimensions
-        if minZoomLocked {
-            let currentScreenWidth = Double(mapView.bounds.size.width)
-            let currentScreenHeight = Double(mapView.bounds.size.height)
-            let nowHaveValidDimensions = currentScreenWidth > 0 && currentScreenHeight > 0
-
-            if minZoomUsedInvalidDimensions && nowHaveValidDimensions {
-                // Unlock and recalculate with real dimensions
-                minZoomLocked = false
-                minZoomUsedInvalidDimensions = false
-            } else {
-                currentConstraintBounds = constraintBounds
-                return true
-            }
-        }
-
-        // Style is loaded - apply bounds and calculate min zoom
         WWWLog.i(
             Self.tag,
             "Setting camera constraint bounds: " +
-            "SW(\(constraintSwLat),\(constraintSwLng)) NE(\(constraintNeLat),\(constraintNeLng))"
-        )
-        WWWLog.i(
-            Self.tag,
-            "Using event bounds for min zoom: SW(\(eventSwLat),\(eventSwLng)) NE(\(eventNeLat),\(eventNeLng))"
+            "SW(\(constraintSwLat),\(constraintSwLng)) NE(\(constraintNeLat),\(constraintNeLng)), minZoom=\(minZoom)"
         )
 
-        // CRITICAL: Use EVENT bounds (not constraint bounds) for min zoom calculation
-        // Constraint bounds may be shrunk by viewport padding, giving incorrect min zoom
-        let eventWidth = eventBounds.ne.longitude - eventBounds.sw.longitude
-        let eventHeight = eventBounds.ne.latitude - eventBounds.sw.latitude
-
-        let screenWidth = Double(mapView.bounds.size.width)
-        let screenHeight = Double(mapView.bounds.size.height)
-
-        // Detect if MapView hasn't been laid out yet
-        let hasInvalidDimensions = screenWidth <= 0 || screenHeight <= 0
-        if hasInvalidDimensions {
-            WWWLog.w(Self.tag, "[WARNING] MapView not laid out yet - min zoom may need recalculation")
-        }
-
-        // Calculate min zoom differently for BOUNDS vs WINDOW mode (matches Android)
-        let baseMinZoom: Double
-
-        if isWindowMode {
-            // WINDOW MODE: Fit the smallest event dimension (prevents showing pixels outside event area)
-
-            // Validate dimensions before calculation (prevent division by zero)
-            guard screenWidth > 0 && screenHeight > 0 && eventWidth > 0 && eventHeight > 0 else {
-                WWWLog.w(
-                    Self.tag,
-                    "Invalid dimensions: screen=\(screenWidth)x\(screenHeight), event=\(eventWidth)x\(eventHeight), " +
-                    "queueing bounds for retry"
-                )
-                pendingConstraintBounds = constraintBounds
-                pendingEventBounds = eventBounds
-                pendingIsWindowMode = isWindowMode
-                return true
-            }
-
-            let eventAspect = eventWidth / eventHeight
-            let screenAspect = screenWidth / screenHeight
-
-            // Create bounds matching the constraining dimension
-            let constrainingBounds: MLNCoordinateBounds
-            if eventAspect > screenAspect {
-                // Event wider than screen → constrained by HEIGHT
-                let constrainedWidth = eventHeight * screenAspect
-                let centerLng = (eventBounds.sw.longitude + eventBounds.ne.longitude) / 2.0
-                constrainingBounds = MLNCoordinateBounds(
-                    sw: CLLocationCoordinate2D(
-                        latitude: eventBounds.sw.latitude,
-                        longitude: centerLng - constrainedWidth / 2
-                    ),
-                    ne: CLLocationCoordinate2D(
-                        latitude: eventBounds.ne.latitude,
-                        longitude: centerLng + constrainedWidth / 2
-                    )
-                )
-                WWWLog.d(
-                    Self.tag,
-                    "Constraining bounds (HEIGHT-constrained): \(eventHeight)° x \(constrainedWidth)° " +
-                    "(event width \(eventWidth)° reduced to \(constrainedWidth)°)"
-                )
-            } else {
-                // Event taller than screen → constrained by WIDTH
-                let constrainedHeight = eventWidth / screenAspect
-                let centerLat = (eventBounds.sw.latitude + eventBounds.ne.latitude) / 2.0
-                constrainingBounds = MLNCoordinateBounds(
-                    sw: CLLocationCoordinate2D(
-                        latitude: centerLat - constrainedHeight / 2,
-                        longitude: eventBounds.sw.longitude
-                    ),
-                    ne: CLLocationCoordinate2D(
-                        latitude: centerLat + constrainedHeight / 2,
-                        longitude: eventBounds.ne.longitude
-                    )
-                )
-                WWWLog.d(
-                    Self.tag,
-                    "Constraining bounds (WIDTH-constrained): \(constrainedHeight)° x \(eventWidth)° " +
-                    "(event height \(eventHeight)° reduced to \(constrainedHeight)°)"
-                )
-            }
-
-            // Calculate zoom directly (cameraThatFitsCoordinateBounds produces incorrect altitude)
-            let centerLat = (constrainingBounds.sw.latitude + constrainingBounds.ne.latitude) / 2.0
-            let latRadians = centerLat * .pi / 180.0
-
-            // For wide event (fit by HEIGHT): calculate zoom from HEIGHT dimension only
-            // For tall event (fit by WIDTH): calculate zoom from WIDTH dimension only
-            let boundsHeight = constrainingBounds.ne.latitude - constrainingBounds.sw.latitude
-            let boundsWidth = constrainingBounds.ne.longitude - constrainingBounds.sw.longitude
-
-            // Web Mercator: degrees per point at zoom level Z
-            // MapLibre uses 512px tiles (not 256px) per web search results
-            // degreesPerPoint = (360 / (512 * 2^Z)) for latitude (no cos adjustment)
-            // degreesPerPoint = (360 / (512 * 2^Z)) * cos(lat) for longitude
-            //
-            // Rearranged to solve for Z:
-            // 2^Z = (screenPoints * 360) / (bounds * 512) for latitude
-            // 2^Z = (screenPoints * 360 * cos(lat)) / (bounds * 512) for longitude
-
-            let zoomForHeight = log2((screenHeight * 360.0) / (boundsHeight * 512.0))
-            let zoomForWidth = log2((screenWidth * 360.0 * cos(latRadians)) / (boundsWidth * 512.0))
-
-            // Use the constraining dimension zoom (ensures that dimension fills screen)
-            if eventAspect > screenAspect {
-                // Wide event → HEIGHT constrains
-                baseMinZoom = zoomForHeight
-                WWWLog.d(
-                    Self.tag,
-                    "WINDOW (HEIGHT): zoomH=\(zoomForHeight), zoomW=\(zoomForWidth), using HEIGHT zoom"
-                )
-            } else {
-                // Tall event → WIDTH constrains
-                baseMinZoom = zoomForWidth
-                WWWLog.d(
-                    Self.tag,
-                    "WINDOW (WIDTH): zoomH=\(zoomForHeight), zoomW=\(zoomForWidth), using WIDTH zoom"
-                )
-            }
-
-            WWWLog.i(
-                Self.tag,
-                "[AIM] WINDOW mode: eventAspect=\(eventAspect), screenAspect=\(screenAspect), " +
-                "constrainedBy=\(eventAspect > screenAspect ? "HEIGHT" : "WIDTH"), minZoom=\(baseMinZoom)"
-            )
-        } else {
-            // BOUNDS MODE: Use MapLibre's calculation (shows entire event)
-            let camera = mapView.cameraThatFitsCoordinateBounds(eventBounds, edgePadding: .zero)
-
-            let centerLat = (eventBounds.sw.latitude + eventBounds.ne.latitude) / 2.0
-            let latRadians = centerLat * .pi / 180.0
-            baseMinZoom = log2(40_075_016.686 * cos(latRadians) / camera.altitude) - 1.0
+        currentConstraintBounds = MLNCoordinateBounds(
+            sw: CLLocationCoordinate2D(latitude: constraintSwLat, longitude: constraintSwLng),
+            ne: CLLocationCoordinate2D(latitude: constraintNeLat, longitude: constraintNeLng)
+        )
 
-            WWWLog.i(Self.tag, "[AIM] BOUNDS mode: base=\(baseMinZoom) (entire event visible)")
+        if !minZoom.isNaN {
+            // Set minimum zoom to prevent zooming out beyond event bounds
+            mapView.minimumZoomLevel = max(0, minZoom)
         }
-
-        let finalMinZoom = baseMinZoom
-
-        // Lock min zoom to prevent recalculation
-        lockedMinZoom = finalMinZoom
-        minZoomLocked = true
-        minZoomUsedInvalidDimensions = hasInvalidDimensions
-
-        // Set minimum zoom to prevent zooming out beyond event bounds
-        mapView.minimumZoomLevel = max(0, finalMinZoom)
-        WWWLog.i(Self.tag, "[SUCCESS] Min zoom set to \(finalMinZoom) (prevents showing pixels outside event area)")
-
-        // Store constraint bounds for gesture enforcement
-        currentConstraintBounds = constraintBounds
-        currentEventBounds = eventBounds
-
-        pendingConstraintBounds = nil
-        pendingEventBounds = nil
-        pendingIsWindowMode = false
         return true
     }
-    // swiftlint:enable function_parameter_count function_body_length cyclomatic_complexity
 
     @objc public func setMinZoom(_ minZoom: Double) {
         mapView?.minimumZoomLevel = minZoom
@@ -682,22 +549,148 @@ import Shared
     // MARK: - Wave Polygons
 
     @objc public func addWavePolygons(polygons: [[CLLocationCoordinate2D]], clearExisting: Bool) {
-        // Queue polygons if style not loaded yet
+        addWavePolygons(polygons: polygons, clearExisting: clearExisting, singleSource: false)
+    }
+
+    /// Adds wave polygons, choosing the style layout.
+    /// - singleSource=false: one source/layer per polygon (legacy)
+    /// - singleSource=true: all polygons in one MLNMultiPolygon source with a single fill layer,
+    ///   so a fragmented wave costs one shape assignment and one draw batch per update
+    @objc public func addWavePolygons(
+        polygons: [[CLLocationCoordinate2D]],
+        clearExisting: Bool,
+        singleSource: Bool
+    ) {
+        wavePipeline.submit(rings: polygons, singleSource: singleSource) { [weak self] frame in
+            self?.applyPreparedWaveFrame(frame)
+        }
+    }
+
+    /// Main-thread stage: assigns prepared shapes to the style and refreshes accessibility.
+    private func applyPreparedWaveFrame(_ frame: PreparedWaveFrame) {
+        // Queue frame if style not loaded yet
         guard styleIsLoaded, let mapView = mapView, let style = mapView.style else {
-            pendingPolygons = polygons
+            pendingWaveFrame = frame
             return
         }
 
         // Render polygons - updates existing layers to prevent flickering
-        updatePolygonLayers(polygons: polygons, style: style)
+        let vertexCount = frame.rings.reduce(0) { $0 + $1.count }
+        WWWSignposts.shared.measure(.layerUpdate, eventId: eventId ?? "", polygons: frame.rings.count, vertices: vertexCount) {
+            if frame.singleSource {
+                removePerPolygonLayers(style: style)
+                updateSingleSourceLayer(frame: frame, style: style)
+            } else {
+                removeSingleSourceLayer(style: style)
+                updatePolygonLayers(frame: frame, style: style)
+            }
+        }
+
+        // Closed by the next rendered frame (mapViewDidFinishRenderingFrame)
+        if pendingFrameInterval == nil {
+            pendingFrameInterval = WWWSignposts.shared.beginInterval(.frame, eventId: eventId ?? "")
+        }
 
         // Update accessibility state
-        currentWavePolygons = polygons
-        updateMapAccessibility()
+        currentWavePolygons = frame.rings
+        currentWaveCenters = frame.centers
+        scheduleAccessibilityUpdate()
+    }
+
+    /// Applies a ring-level delta produced by Kotlin's `WavePolygonDelta`.
+    ///
+    /// The last submitted rings are resized to `ringCount` and ring `changedIndices[i]` is
+    /// replaced by packed ring `i`. Only those rings get new shapes. Validation runs here on main;
+    /// unpacking and shape construction run on the pipeline queue.
+    ///
+    /// - Returns: false when the delta does not apply to the current rings (ring count differs
+    ///   from `baseRingCount` or the payload is malformed); the caller must request a full frame.
+    @objc public func applyWavePolygonDelta(
+        baseRingCount: Int,
+        ringCount: Int,
+        changedIndices: Data,
+        packedCoordinates: Data,
+        ringOffsets: Data,
+        singleSource: Bool
+    ) -> Bool {
+        guard let indices = wavePipeline.validateDelta(
+            baseRingCount: baseRingCount,
+            ringCount: ringCount,
+            changedIndices: changedIndices,
+            ringOffsets: ringOffsets
+        ) else {
+            return false
+        }
+
+        wavePipeline.submitDelta(
+            ringCount: ringCount,
+            changedIndices: indices,
+            packedCoordinates: packedCoordinates,
+            ringOffsets: ringOffsets,
+            singleSource: singleSource
+        ) { [weak self] frame in
+            self?.applyPreparedWaveFrame(frame)
+        }
+        return true
+    }
+
+    /// Adds wave polygons from a packed buffer (interleaved lat/lng doubles + Int32 ring offsets).
+    /// Each ring is copied out with a single memcpy; no per-vertex NSNumber unboxing.
+    @objc public func addWavePolygons(packedCoordinates: Data, ringOffsets: Data, clearExisting: Bool) {
+        addWavePolygons(
+            packedCoordinates: packedCoordinates,
+            ringOffsets: ringOffsets,
+            clearExisting: clearExisting,
+            singleSource: false
+        )
+    }
+
+    @objc public func addWavePolygons(
+        packedCoordinates: Data,
+        ringOffsets: Data,
+        clearExisting: Bool,
+        singleSource: Bool
+    ) {
+        // Unpacking happens on the pipeline queue
+        wavePipeline.submit(
+            packedCoordinates: packedCoordinates,
+            ringOffsets: ringOffsets,
+            singleSource: singleSource
+        ) { [weak self] frame in
+            self?.applyPreparedWaveFrame(frame)
+        }
+    }
+
+    /// Splits a packed coordinate buffer into per-ring coordinate arrays.
+    /// Rings whose offsets fall outside the buffer are dropped.
+    static func unpackPolygons(coordinates: Data, ringOffsets: Data) -> [[CLLocationCoordinate2D]] {
+        return coordinates.withUnsafeBytes { coordinateBytes in
+            ringOffsets.withUnsafeBytes { offsetBytes in
+                let coords = coordinateBytes.bindMemory(to: CLLocationCoordinate2D.self)
+                let offsets = offsetBytes.bindMemory(to: Int32.self)
+                guard offsets.count > 1 else { return [] }
+
+                var polygons: [[CLLocationCoordinate2D]] = []
+                polygons.reserveCapacity(offsets.count - 1)
+                for ring in 0..<(offsets.count - 1) {
+                    let start = Int(offsets[ring])
+                    let end = Int(offsets[ring + 1])
+                    guard start >= 0, start <= end, end <= coords.count else {
+                        WWWLog.w(Self.tag, "Dropping malformed packed ring \(ring): [\(start), \(end))")
+                        continue
+                    }
+                    polygons.append(Array(UnsafeBufferPointer(rebasing: coords[start..<end])))
+                }
+                return polygons
+            }
+        }
     }
 
     /// Updates polygon layers by reusing existing layers (prevents flickering).
-    private func updatePolygonLayers(polygons: [[CLLocationCoordinate2D]], style: MLNStyle) {
+    private func updatePolygonLayers(frame: PreparedWaveFrame, style: MLNStyle) {
+        let polygons = frame.rings
+        let changedIndices = frame.changedIndices
+
         // Remove excess layers if polygon count decreased
         if polygons.count < waveLayerIds.count {
             for index in polygons.count..<waveLayerIds.count {
@@ -714,11 +707,17 @@ import Shared
 
         // Update or create each polygon layer
         for (index, coordinates) in polygons.enumerated() {
+            // Existing layers for untouched rings already show the right shape
+            if let changedIndices = changedIndices, index < waveSourceIds.count, !changedIndices.contains(index) {
+                continue
+            }
+
             let sourceId = index < waveSourceIds.count ? waveSourceIds[index] : "wave-polygons-source-\(index)"
             let layerId = index < waveLayerIds.count ? waveLayerIds[index] : "wave-polygons-layer-\(index)"
 
-            // Create polygon shape
-            let polygon = MLNPolygon(coordinates: coordinates, count: UInt(coordinates.count))
+            // Prepared off main; degenerate rings (< 3 points) get a trivial shape here
+            let polygon = frame.shapes[index]
+                ?? MLNPolygon(coordinates: coordinates, count: UInt(coordinates.count))
 
             if index < waveSourceIds.count {
                 // Update existing source (no flickering)
@@ -736,6 +735,62 @@ import Shared
         }
     }
 
+    /// Pushes the prepared multi-polygon into the shared source (created on first use).
+    private func updateSingleSourceLayer(frame: PreparedWaveFrame, style: MLNStyle) {
+        let multiPolygon = frame.multiPolygon ?? MLNMultiPolygon(polygons: frame.shapes.compactMap { $0 })
+
+        if let source = waveSingleSource {
+            source.shape = multiPolygon
+            return
+        }
+
+        // Source may survive from a previous wrapper binding to the same style
+        if let existing = style.source(withIdentifier: Self.waveSingleSourceId) as? MLNShapeSource {
+            existing.shape = multiPolygon
+            waveSingleSource = existing
+            return
+        }
+
+        let source = MLNShapeSource(identifier: Self.waveSingleSourceId, shape: multiPolygon, options: nil)
+        style.addSource(source)
+
+        let fillLayer = MLNFillStyleLayer(identifier: Self.waveSingleLayerId, source: source)
+        fillLayer.fillColor = NSExpression(forConstantValue: UIColor(hex: "#00008B"))
+        fillLayer.fillOpacity = NSExpression(forConstantValue: 0.20)
+        addOverlayLayer(fillLayer, to: style)
+
+        waveSingleSource = source
+    }
+
+    /// Removes the shared multi-polygon layer and source, if present.
+    private func removeSingleSourceLayer(style: MLNStyle) {
+        guard waveSingleSource != nil else { return }
+        if let layer = style.layer(withIdentifier: Self.waveSingleLayerId) {
+            style.removeLayer(layer)
+        }
+        if let source = style.source(withIdentifier: Self.waveSingleSourceId) {
+            style.removeSource(source)
+        }
+        waveSingleSource = nil
+    }
+
+    /// Removes all per-polygon layers and sources (used when switching to single-source mode).
+    private func removePerPolygonLayers(style: MLNStyle) {
+        guard !waveLayerIds.isEmpty else { return }
+        for layerId in waveLayerIds {
+            if let layer = style.layer(withIdentifier: layerId) {
+                style.removeLayer(layer)
+            }
+        }
+        for sourceId in waveSourceIds {
+            if let source = style.source(withIdentifier: sourceId) {
+                style.removeSource(source)
+            }
+        }
+        waveLayerIds.removeAll()
+        waveSourceIds.removeAll()
+    }
+
     /// Updates existing polygon source (prevents flickering).
     private func updateExistingPolygon(
         index: Int,
@@ -754,7 +809,7 @@ import Shared
             let fillLayer = MLNFillStyleLayer(identifier: layerId, source: source)
             fillLayer.fillColor = NSExpression(forConstantValue: UIColor(hex: "#00008B"))
             fillLayer.fillOpacity = NSExpression(forConstantValue: 0.20)
-            style.addLayer(fillLayer)
+            addOverlayLayer(fillLayer, to: style)
         }
     }
 
@@ -772,34 +827,27 @@ import Shared
         let fillLayer = MLNFillStyleLayer(identifier: layerId, source: source)
         fillLayer.fillColor = NSExpression(forConstantValue: UIColor(hex: "#00008B"))
         fillLayer.fillOpacity = NSExpression(forConstantValue: 0.20)
-        style.addLayer(fillLayer)
+        addOverlayLayer(fillLayer, to: style)
 
         waveSourceIds.append(sourceId)
         waveLayerIds.append(layerId)
     }
 
     @objc public func clearWavePolygons() {
-        guard let style = mapView?.style else { return }
-
-        // Remove all tracked wave layers and sources
-        for layerId in waveLayerIds {
-            if let layer = style.layer(withIdentifier: layerId) {
-                style.removeLayer(layer)
-            }
-        }
+        // In-flight frames belong to the cleared state
+        wavePipeline.reset()
+        pendingWaveFrame = nil
 
-        for sourceId in waveSourceIds {
-            if let source = style.source(withIdentifier: sourceId) {
-                style.removeSource(source)
-            }
-        }
+        guard let style = mapView?.style else { return }
 
-        waveLayerIds.removeAll()
-        waveSourceIds.removeAll()
+        // Remove all tracked wave layers and sources (both render modes)
+        removePerPolygonLayers(style: style)
+        removeSingleSourceLayer(style: style)
 
         // Update accessibility state (no more polygons)
         currentWavePolygons.removeAll()
-        updateMapAccessibility()
+        currentWaveCenters.removeAll()
+        scheduleAccessibilityUpdate()
     }
 
     // MARK: - Override BBox Drawing
@@ -824,7 +872,7 @@ import Shared
         lineLayer.lineOpacity = NSExpression(forConstantValue: 1.0)
         lineLayer.lineDashPattern = NSExpression(forConstantValue: [5, 2])
 
-        style.addLayer(lineLayer)
+        addOverlayLayer(lineLayer, to: style)
     }
 
     // MARK: - Event Listeners
@@ -870,34 +918,74 @@ import Shared
         guard let mapView = mapView else { return }
         mapView.isAccessibilityElement = false
         mapView.accessibilityNavigationStyle = .combined
+        resetAccessibilityElements()
+
+        // Updates are skipped while no assistive technology reads them; catch up when one starts
+        if accessibilityStatusObserver == nil {
+            let refresh: (Notification) -> Void = { [weak self] _ in self?.scheduleAccessibilityUpdate() }
+            accessibilityStatusObserver = NotificationCenter.default.addObserver(
+                forName: UIAccessibility.voiceOverStatusDidChangeNotification,
+                object: nil,
+                queue: .main,
+                using: refresh
+            )
+        }
+        scheduleAccessibilityUpdate()
+    }
+
+    /// Requests an accessibility refresh. Position, polygon and camera changes arrive many times
+    /// per second during a wave; they are coalesced into one update per `accessibilityUpdateDelay`.
+    private func scheduleAccessibilityUpdate() {
+        accessibilityDirty = true
+        guard !accessibilityUpdateScheduled else { return }
+        accessibilityUpdateScheduled = true
+        DispatchQueue.main.asyncAfter(deadline: .now() + Self.accessibilityUpdateDelay) { [weak self] in
+            guard let self = self else { return }
+            self.accessibilityUpdateScheduled = false
+            self.updateMapAccessibility()
+        }
     }
 
     /// Updates accessibility elements based on current map state.
+    ///
+    /// Existing elements are updated in place; `accessibilityElements` is only reassigned when
+    /// the set of elements changes (user position appears, wave ring count changes, ...).
     private func updateMapAccessibility() {
-        guard let mapView = mapView else { return }
+        guard accessibilityDirty, let mapView = mapView else { return }
+        guard UIAccessibility.isVoiceOverRunning || UIAccessibility.isSwitchControlRunning else { return }
+        accessibilityDirty = false
 
-        var accessibilityElements: [Any] = []
-        accessibilityElements.append(createMapSummaryElement())
+        var accessibilityElements: [UIAccessibilityElement] = [updateMapSummaryElement(in: mapView)]
 
-        if let userElement = createUserPositionElement() {
+        if let userElement = updateUserPositionElement(in: mapView) {
             accessibilityElements.append(userElement)
         }
 
-        if let areaElement = createEventAreaElement() {
+        if let areaElement = updateEventAreaElement(in: mapView) {
             accessibilityElements.append(areaElement)
         }
 
-        accessibilityElements.append(contentsOf: createWaveProgressionElements())
+        accessibilityElements.append(contentsOf: updateWaveProgressionElements(in: mapView))
+
+        if let current = mapView.accessibilityElements as? [UIAccessibilityElement],
+           current.elementsEqual(accessibilityElements, by: ===) {
+            return
+        }
         mapView.accessibilityElements = accessibilityElements
     }
 
-    /// Creates a summary element describing the overall map state.
-    private func createMapSummaryElement() -> UIAccessibilityElement {
-        guard let mapView = mapView else {
-            return UIAccessibilityElement(accessibilityContainer: self)
-        }
+    /// Drops cached elements (their container is the map view they were created for).
+    private func resetAccessibilityElements() {
+        summaryElement = nil
+        userPositionElement = nil
+        eventAreaElement = nil
+        waveElements.removeAll()
+    }
 
-        let summaryElement = UIAccessibilityElement(accessibilityContainer: mapView)
+    /// Updates the summary element describing the overall map state.
+    private func updateMapSummaryElement(in mapView: MLNMapView) -> UIAccessibilityElement {
+        let summaryElement = self.summaryElement ?? UIAccessibilityElement(accessibilityContainer: mapView)
+        self.summaryElement = summaryElement
         summaryElement.accessibilityTraits = .staticText
 
         // Build summary text
@@ -936,13 +1024,15 @@ import Shared
         return summaryElement
     }
 
-    /// Creates accessibility element for user position marker.
-    private func createUserPositionElement() -> UIAccessibilityElement? {
-        guard let mapView = mapView, let userPos = currentUserPosition else {
+    /// Updates the accessibility element for the user position marker.
+    private func updateUserPositionElement(in mapView: MLNMapView) -> UIAccessibilityElement? {
+        guard let userPos = currentUserPosition else {
+            userPositionElement = nil
             return nil
         }
 
-        let userElement = UIAccessibilityElement(accessibilityContainer: mapView)
+        let userElement = userPositionElement ?? UIAccessibilityElement(accessibilityContainer: mapView)
+        userPositionElement = userElement
         userElement.accessibilityLabel = "Your current position"
         userElement.accessibilityTraits = .updatesFrequently
 
@@ -952,13 +1042,15 @@ import Shared
         return userElement
     }
 
-    /// Creates accessibility element for event area boundary.
-    private func createEventAreaElement() -> UIAccessibilityElement? {
-        guard let mapView = mapView, let eventCenter = currentEventCenter else {
+    /// Updates the accessibility element for the event area boundary.
+    private func updateEventAreaElement(in mapView: MLNMapView) -> UIAccessibilityElement? {
+        guard let eventCenter = currentEventCenter else {
+            eventAreaElement = nil
             return nil
         }
 
-        let areaElement = UIAccessibilityElement(accessibilityContainer: mapView)
+        let areaElement = eventAreaElement ?? UIAccessibilityElement(accessibilityContainer: mapView)
+        eventAreaElement = areaElement
 
         var label = "Event area boundary"
         if let eventName = currentEventName {
@@ -978,25 +1070,28 @@ import Shared
         return areaElement
     }
 
-    /// Creates accessibility elements for wave progression circles.
-    private func createWaveProgressionElements() -> [UIAccessibilityElement] {
-        guard let mapView = mapView else { return [] }
-
-        var elements: [UIAccessibilityElement] = []
-
-        for (index, polygon) in currentWavePolygons.enumerated() {
-            guard let centerCoord = calculatePolygonCenter(polygon) else { continue }
+    /// Updates the accessibility elements for wave progression circles, reusing existing ones.
+    private func updateWaveProgressionElements(in mapView: MLNMapView) -> [UIAccessibilityElement] {
+        // Centers are computed with the shapes on the pipeline queue
+        let centers = currentWaveCenters.enumerated().compactMap { index, center in
+            center.map { (index, $0) }
+        }
 
+        if waveElements.count > centers.count {
+            waveElements.removeLast(waveElements.count - centers.count)
+        }
+        while waveElements.count < centers.count {
             let circleElement = UIAccessibilityElement(accessibilityContainer: mapView)
-            circleElement.accessibilityLabel = "Wave progression circle \(index + 1) of \(currentWavePolygons.count)"
             circleElement.accessibilityTraits = .updatesFrequently
+            waveElements.append(circleElement)
+        }
 
+        for (circleElement, (index, centerCoord)) in zip(waveElements, centers) {
+            circleElement.accessibilityLabel = "Wave progression circle \(index + 1) of \(currentWavePolygons.count)"
             circleElement.accessibilityFrame = calculateFrameForCoordinate(centerCoord, in: mapView)
-
-            elements.append(circleElement)
         }
 
-        return elements
+        return waveElements
     }
 
     // MARK: - Accessibility Helpers
@@ -1015,84 +1110,57 @@ import Shared
         return fromLocation.distance(from: toLocation)
     }
 
-    /// Calculates the center coordinate of a polygon.
-    private func calculatePolygonCenter(_ polygon: [CLLocationCoordinate2D]) -> CLLocationCoordinate2D? {
-        guard !polygon.isEmpty else { return nil }
-
-        var totalLat: Double = 0
-        var totalLng: Double = 0
-
-        for coord in polygon {
-            totalLat += coord.latitude
-            totalLng += coord.longitude
-        }
-
-        let count = Double(polygon.count)
-        return CLLocationCoordinate2D(
-            latitude: totalLat / count,
-            longitude: totalLng / count
-        )
-    }
-
     // MARK: - Accessibility State Updates
 
     /// Updates user position and location marker.
     @objc public func setUserPosition(latitude: Double, longitude: Double) {
-        currentUserPosition = CLLocationCoordinate2D(latitude: latitude, longitude: longitude)
-        updateMapAccessibility()
+        let coordinate = CLLocationCoordinate2D(latitude: latitude, longitude: longitude)
+        currentUserPosition = coordinate
+        scheduleAccessibilityUpdate()
 
         if isLocationComponentEnabled {
-            updateUserLocationMarker(coordinate: currentUserPosition!)
+            updateUserLocationMarker(coordinate: coordinate)
         }
     }
 
     // MARK: - Location Component
 
-    /// Enable/disable user location marker (uses custom annotation with PositionManager).
+    /// Enable/disable user location marker (style layers fed by PositionManager positions).
     @objc public func enableLocationComponent(_ enabled: Bool) {
-        guard let mapView = mapView else { return }
+        guard mapView != nil else { return }
 
         isLocationComponentEnabled = enabled
 
         if enabled {
-            if userLocationAnnotation == nil {
-                let annotation = MLNPointAnnotation()
-                annotation.title = "Your Location"
-                userLocationAnnotation = annotation
-
-                if let currentPos = currentUserPosition {
-                    annotation.coordinate = currentPos
-                    mapView.addAnnotation(annotation)
-                }
-            } else if let currentPos = currentUserPosition {
+            installUserLocationLayer()
+            if let currentPos = currentUserPosition {
                 updateUserLocationMarker(coordinate: currentPos)
             }
         } else {
-            if let annotation = userLocationAnnotation {
-                mapView.removeAnnotation(annotation)
-                userLocationAnnotation = nil
-            }
+            userLocationLayer.removeFromStyle()
         }
     }
 
-    /// Updates user location marker position (remove and re-add for coordinate update).
-    private func updateUserLocationMarker(coordinate: CLLocationCoordinate2D) {
-        guard let mapView = mapView else { return }
-
-        if let annotation = userLocationAnnotation {
-            mapView.removeAnnotation(annotation)
-            annotation.coordinate = coordinate
-            mapView.addAnnotation(annotation)
+    /// Adds a wave/bbox layer below the user location marker, which stays on top as annotations did.
+    private func addOverlayLayer(_ layer: MLNStyleLayer, to style: MLNStyle) {
+        if let markerLayer = userLocationLayer.lowestLayer(in: style) {
+            style.insertLayer(layer, below: markerLayer)
         } else {
-            // Create if missing
-            let annotation = MLNPointAnnotation()
-            annotation.title = "Your Location"
-            annotation.coordinate = coordinate
-            userLocationAnnotation = annotation
-            mapView.addAnnotation(annotation)
+            style.addLayer(layer)
         }
     }
 
+    /// Adds the marker layers once the style is loaded (again after a style reload).
+    private func installUserLocationLayer() {
+        guard isLocationComponentEnabled, styleIsLoaded, let style = mapView?.style else { return }
+        userLocationLayer.install(on: style)
+    }
+
+    /// Updates user location marker position (in-place source update, no annotation churn).
+    private func updateUserLocationMarker(coordinate: CLLocationCoordinate2D) {
+        userLocationLayer.update(coordinate: coordinate)
+    }
+
     /// Updates event metadata for accessibility.
     @objc public func setEventInfo(
         centerLatitude: Double,
@@ -1103,7 +1171,7 @@ import Shared
         currentEventCenter = CLLocationCoordinate2D(latitude: centerLatitude, longitude: centerLongitude)
         currentEventRadius = radius
         currentEventName = eventName
-        updateMapAccessibility()
+        scheduleAccessibilityUpdate()
     }
 }
 
@@ -1135,30 +1203,18 @@ extension MapLibreViewWrapper: MLNMapViewDelegate {
         )
         WWWLog.d(Self.tag, "Map dimensions updated: \(mapView.bounds.size.width) x \(mapView.bounds.size.height)")
 
-        // Execute pending commands in order: constraints first, then camera movements (matches Android)
-        if let bounds = pendingConstraintBounds {
+        // Style objects from a previous style are gone after a reload
+        waveSingleSource = nil
+        userLocationLayer.styleDidReload()
+        installUserLocationLayer()
 
-            // Use MapLibre's native camera calculation to get accurate zoom level
-            let camera = mapView.cameraThatFitsCoordinateBounds(bounds, edgePadding: .zero)
-
-            // Convert camera altitude to zoom level using MapLibre's formula
-            let earthCircumference = 40_075_016.686
-            let centerLat = (bounds.sw.latitude + bounds.ne.latitude) / 2.0
-            let latRadians = centerLat * .pi / 180.0
-            let calculatedMinZoom = log2(earthCircumference * cos(latRadians) / camera.altitude) - 1.0
-
-            mapView.minimumZoomLevel = max(0, calculatedMinZoom)
-            currentConstraintBounds = bounds
-            pendingConstraintBounds = nil
+        if let frame = pendingWaveFrame {
+            pendingWaveFrame = nil
+            applyPreparedWaveFrame(frame.asFullFrame)
         }
 
-        if let polygons = pendingPolygons {
-            addWavePolygons(polygons: polygons, clearExisting: true)
-            pendingPolygons = nil
-        }
-
-        IOSMapBridge.executePendingCameraCommand(eventId: eventId)
-        _ = IOSMapBridge.renderPendingPolygons(eventId: eventId)
+        // Flush synchronously: map-ready callbacks expect camera and polygons already applied
+        MapRenderScheduler.shared.flushNow(eventId: eventId)
         IOSMapBridge.invokeMapReadyCallbacks(eventId: eventId)
     }
 
@@ -1192,42 +1248,26 @@ extension MapLibreViewWrapper: MLNMapViewDelegate {
         onCameraIdle?()
 
         if let eventId = eventId {
-            Shared.MapWrapperRegistry.shared.invokeCameraIdleListener(eventId: eventId)
-
-            Shared.MapWrapperRegistry.shared.updateCameraPosition(
-                eventId: eventId,
-                latitude: mapView.centerCoordinate.latitude,
-                longitude: mapView.centerCoordinate.longitude
-            )
-            Shared.MapWrapperRegistry.shared.updateCameraZoom(
-                eventId: eventId,
-                zoom: mapView.zoomLevel
-            )
-
+            // One interop call per region change (runs continuously during pan/pinch).
+            // The registry stores the snapshot, then invokes the camera idle listeners.
+            let center = mapView.centerCoordinate
             let bounds = mapView.visibleCoordinateBounds
-            let latSpan = bounds.ne.latitude - bounds.sw.latitude
-            let lngSpan = bounds.ne.longitude - bounds.sw.longitude
-
-            // Only update if bounds are reasonable (< 10°) to prevent fallback world bounds
-            if latSpan < 10.0 && lngSpan < 10.0 {
-                let bbox = BoundingBox(
-                    swLat: bounds.sw.latitude,
-                    swLng: bounds.sw.longitude,
-                    neLat: bounds.ne.latitude,
-                    neLng: bounds.ne.longitude
-                )
-                Shared.MapWrapperRegistry.shared.updateVisibleRegion(eventId: eventId, bbox: bbox)
-            }
-
-            Shared.MapWrapperRegistry.shared.updateMinZoom(eventId: eventId, minZoom: mapView.minimumZoomLevel)
-            Shared.MapWrapperRegistry.shared.updateMapWidth(eventId: eventId, width: Double(mapView.bounds.size.width))
-            Shared.MapWrapperRegistry.shared.updateMapHeight(
+            Shared.MapWrapperRegistry.shared.updateViewportSnapshot(
                 eventId: eventId,
+                centerLatitude: center.latitude,
+                centerLongitude: center.longitude,
+                zoom: mapView.zoomLevel,
+                minZoom: mapView.minimumZoomLevel,
+                swLat: bounds.sw.latitude,
+                swLng: bounds.sw.longitude,
+                neLat: bounds.ne.latitude,
+                neLng: bounds.ne.longitude,
+                width: Double(mapView.bounds.size.width),
                 height: Double(mapView.bounds.size.height)
             )
         }
 
-        updateMapAccessibility()
+        scheduleAccessibilityUpdate()
     }
 
     public func mapViewDidFailLoadingMap(_ mapView: MLNMapView, withError error: Error) {
@@ -1255,6 +1295,13 @@ extension MapLibreViewWrapper: MLNMapViewDelegate {
         // - didFinishLoading style: = style JSON parsed and layers created
     }
 
+    public func mapViewDidFinishRenderingFrame(_ mapView: MLNMapView, fullyRendered: Bool) {
+        if let interval = pendingFrameInterval {
+            pendingFrameInterval = nil
+            WWWSignposts.shared.endInterval(interval)
+        }
+    }
+
     public func mapViewDidBecomeIdle(_ mapView: MLNMapView) {
         WWWLog.d(Self.tag, "[IDLE] Map became idle for event: \(eventId ?? "unknown")")
     }
@@ -1262,61 +1309,6 @@ extension MapLibreViewWrapper: MLNMapViewDelegate {
     public func mapView(_ mapView: MLNMapView, didSelect annotation: MLNAnnotation) {
         WWWLog.d(Self.tag, "[LOCATION] Annotation selected: \(annotation)")
     }
-
-    /// Add pulse animation to match Android's pulsing location marker.
-    /// Creates a repeating scale animation on the pulse circle.
-    private func addPulseAnimation(to view: UIView) {
-        let pulseAnimation = CABasicAnimation(keyPath: "transform.scale")
-        pulseAnimation.duration = 1.5
-        pulseAnimation.fromValue = 1.0
-        pulseAnimation.toValue = 1.3
-        pulseAnimation.timingFunction = CAMediaTimingFunction(name: .easeInEaseOut)
-        pulseAnimation.autoreverses = true
-        pulseAnimation.repeatCount = .infinity
-        view.layer.add(pulseAnimation, forKey: "pulse")
-    }
-
-    public func mapView(_ mapView: MLNMapView, viewFor annotation: MLNAnnotation) -> MLNAnnotationView? {
-        // Customize user location annotation to match Android style
-        if let userAnnotation = userLocationAnnotation, annotation === userAnnotation {
-            let reuseIdentifier = "userLocation"
-
-            // Try to reuse existing annotation view
-            var annotationView = mapView.dequeueReusableAnnotationView(withIdentifier: reuseIdentifier)
-
-            if annotationView == nil {
-                // Create new annotation view - matches Android style
-                annotationView = MLNAnnotationView(reuseIdentifier: reuseIdentifier)
-                annotationView?.frame = CGRect(x: 0, y: 0, width: 40, height: 40)
-
-                // Red pulse circle (matches Android pulseColor with full opacity)
-                let pulseView = UIView(frame: CGRect(x: 0, y: 0, width: 40, height: 40))
-                pulseView.backgroundColor = UIColor(red: 1.0, green: 0.0, blue: 0.0, alpha: 1.0)
-                pulseView.layer.cornerRadius = 20
-                pulseView.tag = 100 // Tag for animation
-
-                // Black center dot (matches Android foregroundTintColor)
-                let dotView = UIView(frame: CGRect(x: 15, y: 15, width: 10, height: 10))
-                dotView.backgroundColor = UIColor.black
-                dotView.layer.cornerRadius = 5
-                dotView.layer.borderWidth = 2
-                dotView.layer.borderColor = UIColor.white.cgColor
-
-                pulseView.addSubview(dotView)
-                annotationView?.addSubview(pulseView)
-
-                // Center the annotation on the coordinate
-                annotationView?.centerOffset = CGVector(dx: 0, dy: 0)
-
-                // Add pulse animation (matches Android pulse effect)
-                addPulseAnimation(to: pulseView)
-            }
-
-            return annotationView
-        }
-
-        return nil
-    }
 }
 
 // MARK: - Camera Callback Wrapper
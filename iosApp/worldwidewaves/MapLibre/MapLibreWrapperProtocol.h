@@ -53,6 +53,24 @@
 
 // Wave Polygons
 - (void)addWavePolygons:(NSArray<NSArray<NSValue *> *> *)polygons clearExisting:(BOOL)clearExisting;
+// Zero-boxing variant: coordinates are interleaved lat/lng doubles (CLLocationCoordinate2D layout),
+// ringOffsets holds ringCount + 1 Int32 vertex indices
+- (void)addWavePolygonsWithPackedCoordinates:(NSData *)packedCoordinates
+                                 ringOffsets:(NSData *)ringOffsets
+                               clearExisting:(BOOL)clearExisting;
+// singleSource=YES renders every polygon through one MLNMultiPolygon source and one fill layer
+- (void)addWavePolygonsWithPackedCoordinates:(NSData *)packedCoordinates
+                                 ringOffsets:(NSData *)ringOffsets
+                               clearExisting:(BOOL)clearExisting
+                                singleSource:(BOOL)singleSource;
+// Ring-level delta: resize to ringCount, replace rings at changedIndices (Int32) with the packed rings.
+// Returns NO when the current ring count differs from baseRingCount.
+- (BOOL)applyWavePolygonDeltaWithBaseRingCount:(NSInteger)baseRingCount
+                                     ringCount:(NSInteger)ringCount
+                                changedIndices:(NSData *)changedIndices
+                             packedCoordinates:(NSData *)packedCoordinates
+                                   ringOffsets:(NSData *)ringOffsets
+                                  singleSource:(BOOL)singleSource;
 - (void)clearWavePolygons;
 
 // Override BBox
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural boundaries, fostering unity,
+ * community, and shared human experience by leveraging real-time coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import Foundation
+import QuartzCore
+
+/// Coalesces map render requests into at most one flush per display refresh.
+///
+/// ## Purpose
+/// Kotlin produces wave polygons, camera commands and bbox draws at its own pace and triggers
+/// Swift through several paths (render callback, `requestImmediateRender`, `updateUIView`,
+/// style load). Without coalescing, a burst of updates causes one style mutation each within
+/// the same frame. The scheduler only records *which* work is due; the data itself stays in
+/// `MapWrapperRegistry`, which already keeps the latest state per event (latest wins).
+///
+/// ## Flush Order (per event)
+/// 1. Camera commands (constraints must be in place before drawing)
+/// 2. Wave polygons
+/// 3. Debug bbox
+///
+/// ## Lifecycle
+/// The `CADisplayLink` is paused whenever nothing is pending, so an idle map costs no frames.
+///
+/// - Important: All methods hop to the main thread if called elsewhere
+@objc public final class MapRenderScheduler: NSObject {
+    private static let tag = "MapRenderScheduler"
+
+    @objc public static let shared = MapRenderScheduler()
+
+    /// Kinds of deferred map work.
+    struct Work: OptionSet {
+        let rawValue: Int
+
+        static let camera = Work(rawValue: 1 << 0)
+        static let polygons = Work(rawValue: 1 << 1)
+        static let bbox = Work(rawValue: 1 << 2)
+        static let all: Work = [.camera, .polygons, .bbox]
+    }
+
+    private var pending: [String: Work] = [:]
+    private var displayLink: CADisplayLink?
+
+    // MARK: - Scheduling
+
+    @objc public func schedulePolygons(eventId: String) {
+        schedule(eventId: eventId, work: .polygons)
+    }
+
+    @objc public func scheduleCamera(eventId: String) {
+        schedule(eventId: eventId, work: .camera)
+    }
+
+    @objc public func scheduleAll(eventId: String) {
+        schedule(eventId: eventId, work: .all)
+    }
+
+    func schedule(eventId: String, work: Work) {
+        guard Thread.isMainThread else {
+            DispatchQueue.main.async { self.schedule(eventId: eventId, work: work) }
+            return
+        }
+
+        pending[eventId, default: []].formUnion(work)
+        ensureDisplayLinkRunning()
+    }
+
+    /// Runs pending work for `eventId` now instead of waiting for the next frame.
+    /// Used when ordering matters (e.g. style load must render before map-ready callbacks fire).
+    @objc public func flushNow(eventId: String) {
+        pending.removeValue(forKey: eventId)
+        perform(.all, eventId: eventId)
+        pauseIfIdle()
+    }
+
+    /// Drops pending work for an event whose map is going away.
+    @objc public func cancel(eventId: String) {
+        guard Thread.isMainThread else {
+            DispatchQueue.main.async { self.cancel(eventId: eventId) }
+            return
+        }
+
+        pending.removeValue(forKey: eventId)
+        pauseIfIdle()
+    }
+
+    // MARK: - Display Link
+
+    private func ensureDisplayLinkRunning() {
+        if let link = displayLink {
+            link.isPaused = false
+            return
+        }
+
+        // CADisplayLink retains its target: go through a weak proxy
+        let link = CADisplayLink(target: DisplayLinkProxy(owner: self), selector: #selector(DisplayLinkProxy.tick))
+        link.add(to: .main, forMode: .common)
+        displayLink = link
+        WWWLog.d(Self.tag, "Display link started")
+    }
+
+    private func pauseIfIdle() {
+        if pending.isEmpty {
+            displayLink?.isPaused = true
+        }
+    }
+
+    fileprivate func flush() {
+        guard !pending.isEmpty else {
+            pauseIfIdle()
+            return
+        }
+
+        // Swap out first: work performed here may schedule more for the next frame
+        let batch = pending
+        pending.removeAll(keepingCapacity: true)
+
+        for (eventId, work) in batch {
+            perform(work, eventId: eventId)
+        }
+        pauseIfIdle()
+    }
+
+    private func perform(_ work: Work, eventId: String) {
+        if work.contains(.camera) {
+            IOSMapBridge.executePendingCameraCommand(eventId: eventId)
+        }
+        if work.contains(.polygons) {
+            _ = IOSMapBridge.renderPendingPolygons(eventId: eventId)
+        }
+        if work.contains(.bbox) {
+            _ = IOSMapBridge.renderPendingBbox(eventId: eventId)
+        }
+    }
+}
+
+/// Weak trampoline so the display link does not keep the scheduler alive.
+private final class DisplayLinkProxy: NSObject {
+    private weak var owner: MapRenderScheduler?
+
+    init(owner: MapRenderScheduler) {
+        self.owner = owner
+    }
+
+    @objc func tick() {
+        owner?.flush()
+    }
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural boundaries, fostering unity,
+ * community, and shared human experience by leveraging real-time coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import Foundation
+import MapLibre
+import UIKit
+
+/// Warms MapLibre for an event map before the user opens it (driven by Kotlin `MapPrefetcher`).
+///
+/// ## Purpose
+/// Renders offscreen snapshots of the event bbox with `MLNMapSnapshotter` and discards them.
+/// Style, sprites, glyphs and the mbtiles tiles of each warmed zoom level are read once, so
+/// the first frames of the wave screen do not wait on them (blank tiles at wave start).
+///
+/// ## Zoom Levels
+/// The bbox is rendered at its fit zoom (the minimum zoom the camera constraints allow for a
+/// full-screen map) and at the next level, never beyond the event max zoom. The snapshot size
+/// grows with the level so the whole bbox stays in frame.
+///
+/// ## Lifecycle
+/// Snapshots run one at a time; each event is warmed once per process. Pending work is
+/// dropped on memory warnings.
+///
+/// - Important: Main thread only (`prefetch` hops to main if called elsewhere)
+final class MapTilePrefetcher {
+    private static let tag = "MapTilePrefetcher"
+    private static let warmedLevels = 2
+    private static let tileSize = 512.0
+
+    static let shared = MapTilePrefetcher()
+
+    private var warmedEvents: Set<String> = []
+    private var pending: [MLNMapSnapshotOptions] = []
+    private var snapshotter: MLNMapSnapshotter?
+    private var memoryWarningObserver: NSObjectProtocol?
+
+    private init() {
+        memoryWarningObserver = NotificationCenter.default.addObserver(
+            forName: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil,
+            queue: .main
+        ) { [weak self] _ in
+            self?.cancelAll()
+        }
+    }
+
+    /// Queues snapshots of `bounds` for the event, unless it was already warmed.
+    func prefetch(eventId: String, styleURL: URL, bounds: MLNCoordinateBounds, maxZoom: Double) {
+        guard Thread.isMainThread else {
+            DispatchQueue.main.async { self.prefetch(eventId: eventId, styleURL: styleURL, bounds: bounds, maxZoom: maxZoom) }
+            return
+        }
+        guard warmedEvents.insert(eventId).inserted else { return }
+
+        let screenSize = UIScreen.main.bounds.size
+        let fitZoom = Self.zoomToFit(bounds, in: screenSize)
+        let center = CLLocationCoordinate2D(
+            latitude: (bounds.sw.latitude + bounds.ne.latitude) / 2,
+            longitude: (bounds.sw.longitude + bounds.ne.longitude) / 2
+        )
+
+        for level in 0..<Self.warmedLevels {
+            let zoom = min(fitZoom + Double(level), maxZoom)
+            let growth = CGFloat(pow(2.0, zoom - fitZoom))
+            let camera = MLNMapCamera()
+            camera.centerCoordinate = center
+            let options = MLNMapSnapshotOptions(
+                styleURL: styleURL,
+                camera: camera,
+                size: CGSize(width: screenSize.width * growth, height: screenSize.height * growth)
+            )
+            options.zoomLevel = zoom
+            options.scale = 1 // Tiles are what we warm, not pixels
+            pending.append(options)
+            if zoom >= maxZoom { break }
+        }
+
+        WWWLog.i(Self.tag, "Warming map for event: \(eventId), fitZoom=\(fitZoom), snapshots=\(pending.count)")
+        startNext()
+    }
+
+    private func startNext() {
+        guard snapshotter == nil, !pending.isEmpty else { return }
+
+        let options = pending.removeFirst()
+        let snapshotter = MLNMapSnapshotter(options: options)
+        self.snapshotter = snapshotter
+        snapshotter.start { [weak self] _, error in
+            if let error = error {
+                WWWLog.w(Self.tag, "Warm-up snapshot failed: \(error.localizedDescription)")
+            } else {
+                WWWLog.d(Self.tag, "Warm-up snapshot done at zoom \(options.zoomLevel)")
+            }
+            self?.snapshotter = nil
+            self?.startNext()
+        }
+    }
+
+    private func cancelAll() {
+        guard snapshotter != nil || !pending.isEmpty else { return }
+        WWWLog.w(Self.tag, "[MEMORY] Cancelling map warm-up (\(pending.count) pending)")
+        pending.removeAll()
+        snapshotter?.cancel()
+        snapshotter = nil
+    }
+
+    /// Zoom at which `bounds` fills `size` (Web Mercator, 512pt tiles as in MapLibre).
+    private static func zoomToFit(_ bounds: MLNCoordinateBounds, in size: CGSize) -> Double {
+        func mercatorY(_ latitude: Double) -> Double { log(tan(.pi / 4 + latitude * .pi / 360)) }
+
+        let lngSpan = max(bounds.ne.longitude - bounds.sw.longitude, 1e-6)
+        let ySpan = max(mercatorY(bounds.ne.latitude) - mercatorY(bounds.sw.latitude), 1e-9)
+        let lngZoom = log2(Double(size.width) * 360 / (lngSpan * tileSize))
+        let latZoom = log2(Double(size.height) * 2 * .pi / (ySpan * tileSize))
+        return max(0, min(lngZoom, latZoom))
+    }
+}
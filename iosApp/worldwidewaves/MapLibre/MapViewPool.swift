@@ -0,0 +1,131 @@
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural boundaries, fostering unity,
+ * community, and shared human experience by leveraging real-time coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import MapLibre
+import Shared
+import UIKit
+
+/// Keeps recently used `MLNMapView` instances alive between event map screens.
+///
+/// ## Purpose
+/// Opening an event map used to allocate a new `MLNMapView` every time: renderer setup, style
+/// parse, sprite and glyph resolution. When `MapWrapperRegistry.unregisterWrapper` releases a
+/// wrapper, its map view is reset and parked here; the next `EventMapView` reuses it, keeping
+/// the loaded style as-is when the style URL matches (event list <-> same event map).
+///
+/// ## Sizing
+/// At most `maxIdleViews` idle views are kept; all of them are dropped on memory warnings.
+/// Views are never created ahead of use: an `MLNMapView` without style URL loads MapLibre's
+/// default remote style.
+///
+/// - Important: Main thread only
+final class MapViewPool {
+    private static let tag = "MapViewPool"
+    private static let maxIdleViews = 2
+
+    static let shared = MapViewPool()
+
+    private var idleViews: [MLNMapView] = []
+    private var memoryWarningObserver: NSObjectProtocol?
+
+    // Zoom limits of a fresh view, restored on recycle (the wrapper tightens them per event)
+    private var defaultZoomRange: (min: Double, max: Double)?
+
+    private init() {}
+
+    /// Hooks the pool to wrapper releases and memory warnings. Safe to call more than once.
+    func install() {
+        guard memoryWarningObserver == nil else { return }
+
+        Shared.MapWrapperRegistry.shared.setWrapperReleasedListener { [weak self] eventId, wrapper in
+            guard let mapWrapper = wrapper as? MapLibreViewWrapper,
+                  let attachedView = mapWrapper.attachedMapView else { return }
+            // LRU-evicted wrapper whose map is still on screen: the view keeps its delegate,
+            // gestures and layers, it must not be touched
+            guard attachedView.window == nil else {
+                WWWLog.d(Self.tag, "Map view of \(eventId) still on screen, not recycled")
+                return
+            }
+            guard let mapView = mapWrapper.detachMapView() else { return }
+            WWWLog.d(Self.tag, "Map view released by event: \(eventId)")
+            self?.recycle(mapView)
+        }
+
+        memoryWarningObserver = NotificationCenter.default.addObserver(
+            forName: UIApplication.didReceiveMemoryWarningNotification,
+            object: nil,
+            queue: .main
+        ) { [weak self] _ in
+            self?.drain()
+        }
+        WWWLog.i(Self.tag, "Map view pool installed (max idle views: \(Self.maxIdleViews))")
+    }
+
+    /// Returns a map view for `styleURL`, reusing an idle one when possible.
+    ///
+    /// - Returns: The view, and whether its style is already loaded from `styleURL`
+    ///   (the caller must then skip setting the style and replay style-loaded handling)
+    func dequeue(styleURL: URL) -> (mapView: MLNMapView, styleReused: Bool) {
+        if let index = idleViews.firstIndex(where: { $0.styleURL == styleURL && $0.style != nil }) {
+            WWWLog.i(Self.tag, "Reusing map view with loaded style: \(styleURL.lastPathComponent)")
+            return (idleViews.remove(at: index), true)
+        }
+        if let mapView = idleViews.popLast() {
+            WWWLog.i(Self.tag, "Reusing map view, rebinding style: \(styleURL.lastPathComponent)")
+            return (mapView, false)
+        }
+        return (makeMapView(), false)
+    }
+
+    /// Parks a detached `mapView` for reuse. Views still on screen are left alone.
+    func recycle(_ mapView: MLNMapView) {
+        guard mapView.window == nil else {
+            WWWLog.d(Self.tag, "Map view still on screen, not recycled")
+            return
+        }
+        mapView.removeFromSuperview()
+
+        guard idleViews.count < Self.maxIdleViews, !idleViews.contains(where: { $0 === mapView }) else {
+            return
+        }
+        if let zoomRange = defaultZoomRange {
+            mapView.minimumZoomLevel = zoomRange.min
+            mapView.maximumZoomLevel = zoomRange.max
+        }
+        idleViews.append(mapView)
+        WWWLog.d(Self.tag, "Map view recycled (idle views: \(idleViews.count))")
+    }
+
+    /// Drops every idle view (memory warning).
+    func drain() {
+        guard !idleViews.isEmpty else { return }
+        WWWLog.w(Self.tag, "[MEMORY] Dropping \(idleViews.count) idle map view(s)")
+        idleViews.removeAll()
+    }
+
+    private func makeMapView() -> MLNMapView {
+        let mapView = MLNMapView(frame: .zero)
+        mapView.autoresizingMask = [.flexibleWidth, .flexibleHeight]
+        if defaultZoomRange == nil {
+            defaultZoomRange = (mapView.minimumZoomLevel, mapView.maximumZoomLevel)
+        }
+        return mapView
+    }
+}
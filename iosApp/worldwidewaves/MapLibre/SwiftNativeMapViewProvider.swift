@@ -6,6 +6,7 @@
  */
 
 import Foundation
+import MapLibre
 import UIKit
 import Shared
 
@@ -142,4 +143,34 @@ public class SwiftNativeMapViewProvider: NativeMapViewProvider {
         WWWLog.v("SwiftNativeMapViewProvider", "Getting map wrapper for event: \(eventId)")
         return Shared.MapWrapperRegistry.shared.getWrapper(eventId: eventId)
     }
+
+    /// Warms MapLibre for an event map ahead of its first display (called by Kotlin `MapPrefetcher`).
+    ///
+    /// - Parameters:
+    ///   - eventId: Unique event identifier
+    ///   - styleURL: Resolved style path (same value later passed to `createMapView`)
+    ///   - maxZoom: Event max zoom (upper bound of warmed levels)
+    /// - Note: Fire-and-forget, callable from any thread (work hops to main)
+    public func prefetchMap(
+        eventId: String,
+        styleURL: String,
+        swLat: Double,
+        swLng: Double,
+        neLat: Double,
+        neLng: Double,
+        maxZoom: Double
+    ) {
+        // Same URL resolution as EventMapView (getStyleUri returns a local path)
+        let url: URL
+        if styleURL.hasPrefix("http://") || styleURL.hasPrefix("https://"), let remoteURL = URL(string: styleURL) {
+            url = remoteURL
+        } else {
+            url = URL(fileURLWithPath: styleURL)
+        }
+        let bounds = MLNCoordinateBounds(
+            sw: CLLocationCoordinate2D(latitude: swLat, longitude: swLng),
+            ne: CLLocationCoordinate2D(latitude: neLat, longitude: neLng)
+        )
+        MapTilePrefetcher.shared.prefetch(eventId: eventId, styleURL: url, bounds: bounds, maxZoom: maxZoom)
+    }
 }
@@ -0,0 +1,160 @@
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural boundaries, fostering unity,
+ * community, and shared human experience by leveraging real-time coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import Foundation
+import MapLibre
+import UIKit
+
+/// User position marker drawn by the style: one point source and two circle layers.
+///
+/// ## Purpose
+/// The marker used to be an `MLNPointAnnotation` removed and re-added on every position update,
+/// which rebuilt its annotation view each time. Here the source keeps a stable identity and a
+/// position update is a single shape assignment, cheap enough for high-frequency GPS.
+///
+/// ## Styling
+/// Matches the Android location component: red pulse circle (40pt) around a black dot with a
+/// white border. The pulse is a radius transition toggled every `pulseDuration`, so it costs
+/// one style property change per half-cycle instead of a Core Animation layer.
+///
+/// ## Style Reloads
+/// Style objects are gone after a style reload; `install(on:)` must be called again from
+/// `didFinishLoading` (the last coordinate is kept and re-applied).
+///
+/// - Important: Main thread only
+final class UserLocationLayer {
+    private static let tag = "UserLocationLayer"
+    private static let sourceId = "user-location-source"
+    private static let pulseLayerId = "user-location-pulse"
+    private static let dotLayerId = "user-location-dot"
+
+    private static let pulseRadius = 20.0
+    private static let pulseExpandedRadius = 26.0 // Android pulse scale (1.3)
+    private static let dotRadius = 5.0
+    private static let dotBorderWidth = 2.0
+    private static let pulseDuration: TimeInterval = 1.5
+
+    private weak var style: MLNStyle?
+    private var source: MLNShapeSource?
+    private var pulseLayer: MLNCircleStyleLayer?
+    private var pulseTimer: Timer?
+    private var pulseExpanded = false
+    private let point = MLNPointFeature()
+
+    private(set) var coordinate: CLLocationCoordinate2D?
+
+    deinit {
+        pulseTimer?.invalidate()
+    }
+
+    /// Adds the source and layers to `style` (on top of every other layer, as annotations were).
+    func install(on style: MLNStyle) {
+        guard self.style !== style || source == nil else { return }
+        removeFromStyle()
+
+        // Leftovers from a previous wrapper bound to a pooled map view
+        if let staleLayer = style.layer(withIdentifier: Self.dotLayerId) { style.removeLayer(staleLayer) }
+        if let staleLayer = style.layer(withIdentifier: Self.pulseLayerId) { style.removeLayer(staleLayer) }
+        if let staleSource = style.source(withIdentifier: Self.sourceId) { style.removeSource(staleSource) }
+
+        let source = MLNShapeSource(identifier: Self.sourceId, shape: coordinate != nil ? point : nil, options: nil)
+        style.addSource(source)
+
+        let pulse = MLNCircleStyleLayer(identifier: Self.pulseLayerId, source: source)
+        pulse.circleColor = NSExpression(forConstantValue: UIColor(red: 1.0, green: 0.0, blue: 0.0, alpha: 1.0))
+        pulse.circleRadius = NSExpression(forConstantValue: Self.pulseRadius)
+        pulse.circleRadiusTransition = MLNTransition(duration: Self.pulseDuration, delay: 0)
+        pulse.circlePitchAlignment = NSExpression(forConstantValue: "viewport")
+        style.addLayer(pulse)
+
+        let dot = MLNCircleStyleLayer(identifier: Self.dotLayerId, source: source)
+        dot.circleColor = NSExpression(forConstantValue: UIColor.black)
+        dot.circleRadius = NSExpression(forConstantValue: Self.dotRadius)
+        dot.circleStrokeColor = NSExpression(forConstantValue: UIColor.white)
+        dot.circleStrokeWidth = NSExpression(forConstantValue: Self.dotBorderWidth)
+        style.addLayer(dot)
+
+        self.style = style
+        self.source = source
+        pulseLayer = pulse
+        pulseExpanded = false
+        startPulse()
+        WWWLog.d(Self.tag, "User location layers installed")
+    }
+
+    /// Bottom marker layer in `style`, for callers adding layers that must stay under the marker.
+    func lowestLayer(in style: MLNStyle) -> MLNStyleLayer? {
+        guard self.style === style else { return nil }
+        return pulseLayer
+    }
+
+    /// Moves the marker: one shape assignment on the existing source.
+    func update(coordinate: CLLocationCoordinate2D) {
+        let firstFix = self.coordinate == nil
+        self.coordinate = coordinate
+        point.coordinate = coordinate
+        // MLNShapeSource copies the shape on assignment, so re-assigning the same feature is enough
+        if let source = source {
+            source.shape = point
+            if firstFix { startPulse() }
+        }
+    }
+
+    /// Removes the source and layers from the style they were installed on.
+    func removeFromStyle() {
+        pulseTimer?.invalidate()
+        pulseTimer = nil
+        if let style = style {
+            if let layer = style.layer(withIdentifier: Self.dotLayerId) { style.removeLayer(layer) }
+            if let layer = style.layer(withIdentifier: Self.pulseLayerId) { style.removeLayer(layer) }
+            if let source = style.source(withIdentifier: Self.sourceId) { style.removeSource(source) }
+        }
+        style = nil
+        source = nil
+        pulseLayer = nil
+    }
+
+    /// Style objects of a reloaded style are new; forget the old ones without touching them.
+    func styleDidReload() {
+        pulseTimer?.invalidate()
+        pulseTimer = nil
+        style = nil
+        source = nil
+        pulseLayer = nil
+    }
+
+    private func startPulse() {
+        guard pulseTimer == nil, coordinate != nil, pulseLayer != nil else { return }
+        let timer = Timer(timeInterval: Self.pulseDuration, repeats: true) { [weak self] _ in
+            self?.togglePulse()
+        }
+        timer.tolerance = Self.pulseDuration * 0.1
+        RunLoop.main.add(timer, forMode: .common)
+        pulseTimer = timer
+        togglePulse()
+    }
+
+    private func togglePulse() {
+        guard let pulseLayer = pulseLayer else { return }
+        pulseExpanded.toggle()
+        let radius = pulseExpanded ? Self.pulseExpandedRadius : Self.pulseRadius
+        pulseLayer.circleRadius = NSExpression(forConstantValue: radius)
+    }
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural boundaries, fostering unity,
+ * community, and shared human experience by leveraging real-time coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import Foundation
+import MapLibre
+import CoreLocation
+
+/// Wave geometry prepared off the main thread, ready to be applied to the style.
+struct PreparedWaveFrame {
+    let generation: Int
+    let rings: [[CLLocationCoordinate2D]]
+    /// One shape per ring (nil for degenerate rings), aligned with `rings`
+    let shapes: [MLNPolygon?]
+    /// Combined shape for single-source mode (nil in per-polygon mode)
+    let multiPolygon: MLNMultiPolygon?
+    /// Ring centroids for accessibility elements, aligned with `rings`
+    let centers: [CLLocationCoordinate2D?]
+    /// Rings whose shape changed since the previous frame (nil = all)
+    let changedIndices: IndexSet?
+    let singleSource: Bool
+
+    /// Same geometry, but every layer must be rewritten (e.g. replay after a style reload).
+    var asFullFrame: PreparedWaveFrame {
+        PreparedWaveFrame(
+            generation: generation,
+            rings: rings,
+            shapes: shapes,
+            multiPolygon: multiPolygon,
+            centers: centers,
+            changedIndices: nil,
+            singleSource: singleSource
+        )
+    }
+}
+
+/// Two-stage wave polygon pipeline.
+///
+/// ## Stages
+/// 1. **Background** (serial user-initiated queue): unpack the Kotlin buffers, apply deltas, build
+///    `MLNPolygon` / `MLNMultiPolygon` objects and accessibility centroids. Shape objects are
+///    plain model objects and are safe to create off main; nothing here touches the style.
+/// 2. **Main**: the completion receives a `PreparedWaveFrame` and only assigns shapes to
+///    sources and refreshes accessibility elements.
+///
+/// ## Ordering
+/// Inputs are applied in submission order on the serial queue. Every `reset()` bumps the
+/// generation; frames prepared for an older generation are dropped on main, so a clear can
+/// never be overtaken by a frame that was still in flight.
+///
+/// - Important: `submit*`, `reset` and `submittedRingCount` are main-thread only
+final class WaveShapePipeline {
+    private static let tag = "WaveShapePipeline"
+
+    private let queue = DispatchQueue(label: "com.worldwidewaves.wave-shapes", qos: .userInitiated)
+
+    // Main-thread mirror of the ring count the next delta will be applied to
+    private(set) var submittedRingCount = 0
+    private var generation = 0
+
+    // Owned by `queue`
+    private var rings: [[CLLocationCoordinate2D]] = []
+    private var shapes: [MLNPolygon?] = []
+    private var centers: [CLLocationCoordinate2D?] = []
+
+    /// Replaces all rings.
+    func submit(
+        rings newRings: [[CLLocationCoordinate2D]],
+        singleSource: Bool,
+        completion: @escaping (PreparedWaveFrame) -> Void
+    ) {
+        submittedRingCount = newRings.count
+        enqueue(singleSource: singleSource, completion: completion) { pipeline in
+            pipeline.rings = newRings
+            return nil
+        }
+    }
+
+    /// Replaces all rings from a packed buffer; unpacking happens on the background queue.
+    func submit(
+        packedCoordinates: Data,
+        ringOffsets: Data,
+        singleSource: Bool,
+        completion: @escaping (PreparedWaveFrame) -> Void
+    ) {
+        submittedRingCount = max(0, ringOffsets.count / MemoryLayout<Int32>.size - 1)
+        enqueue(singleSource: singleSource, completion: completion) { pipeline in
+            pipeline.rings = MapLibreViewWrapper.unpackPolygons(coordinates: packedCoordinates, ringOffsets: ringOffsets)
+            return nil
+        }
+    }
+
+    /// Applies a ring-level delta (Kotlin `WavePolygonDelta`) on top of the last submitted frame.
+    /// Caller validates the payload first (see `validateDelta`).
+    func submitDelta(
+        ringCount: Int,
+        changedIndices: [Int],
+        packedCoordinates: Data,
+        ringOffsets: Data,
+        singleSource: Bool,
+        completion: @escaping (PreparedWaveFrame) -> Void
+    ) {
+        submittedRingCount = ringCount
+        enqueue(singleSource: singleSource, completion: completion) { pipeline in
+            let changedRings = MapLibreViewWrapper.unpackPolygons(
+                coordinates: packedCoordinates,
+                ringOffsets: ringOffsets
+            )
+            pipeline.resizeRings(to: ringCount)
+            var changed = IndexSet()
+            for (ring, index) in zip(changedRings, changedIndices) {
+                pipeline.rings[index] = ring
+                changed.insert(index)
+            }
+            return changed
+        }
+    }
+
+    /// Checks a delta against the last submitted frame. Cheap (O(changed rings)), runs on main.
+    func validateDelta(baseRingCount: Int, ringCount: Int, changedIndices: Data, ringOffsets: Data) -> [Int]? {
+        guard baseRingCount == submittedRingCount, ringCount >= 0 else {
+            WWWLog.w(Self.tag, "Wave delta base \(baseRingCount) does not match \(submittedRingCount) current rings")
+            return nil
+        }
+
+        let indices = changedIndices.withUnsafeBytes { Array($0.bindMemory(to: Int32.self)).map(Int.init) }
+        let packedRingCount = ringOffsets.count / MemoryLayout<Int32>.size - 1
+        guard indices.count == packedRingCount, indices.allSatisfy({ $0 >= 0 && $0 < ringCount }) else {
+            WWWLog.w(Self.tag, "Malformed wave delta: \(indices.count) indices, \(packedRingCount) rings")
+            return nil
+        }
+        return indices
+    }
+
+    /// Drops all prepared state; frames still in flight are discarded on arrival.
+    func reset() {
+        generation += 1
+        submittedRingCount = 0
+        queue.async { [self] in
+            rings.removeAll()
+            shapes.removeAll()
+            centers.removeAll()
+        }
+    }
+
+    // MARK: - Background stage
+
+    private func enqueue(
+        singleSource: Bool,
+        completion: @escaping (PreparedWaveFrame) -> Void,
+        update: @escaping (WaveShapePipeline) -> IndexSet?
+    ) {
+        let frameGeneration = generation
+        queue.async { [self] in
+            let changed = update(self)
+            let frame = prepare(changedIndices: changed, singleSource: singleSource, generation: frameGeneration)
+
+            DispatchQueue.main.async { [weak self] in
+                guard let self = self, frame.generation == self.generation else { return }
+                completion(frame)
+            }
+        }
+    }
+
+    private func prepare(changedIndices: IndexSet?, singleSource: Bool, generation: Int) -> PreparedWaveFrame {
+        let incremental = changedIndices != nil && shapes.count == rings.count
+        if incremental, let changedIndices = changedIndices {
+            for index in changedIndices {
+                shapes[index] = Self.makeShape(rings[index])
+                centers[index] = Self.center(of: rings[index])
+            }
+        } else {
+            shapes = rings.map(Self.makeShape)
+            centers = rings.map(Self.center(of:))
+        }
+
+        return PreparedWaveFrame(
+            generation: generation,
+            rings: rings,
+            shapes: shapes,
+            multiPolygon: singleSource ? MLNMultiPolygon(polygons: shapes.compactMap { $0 }) : nil,
+            centers: centers,
+            changedIndices: incremental ? changedIndices : nil,
+            singleSource: singleSource
+        )
+    }
+
+    private func resizeRings(to count: Int) {
+        if count < rings.count {
+            rings.removeSubrange(count...)
+            shapes.removeSubrange(min(count, shapes.count)...)
+            centers.removeSubrange(min(count, centers.count)...)
+        } else if count > rings.count {
+            let added = count - rings.count
+            rings.append(contentsOf: repeatElement([], count: added))
+            shapes.append(contentsOf: repeatElement(nil, count: added))
+            centers.append(contentsOf: repeatElement(nil, count: added))
+        }
+    }
+
+    private static func makeShape(_ coordinates: [CLLocationCoordinate2D]) -> MLNPolygon? {
+        guard coordinates.count >= 3 else { return nil }
+        return MLNPolygon(coordinates: coordinates, count: UInt(coordinates.count))
+    }
+
+    /// Vertex average of a ring (good enough to anchor an accessibility element).
+    private static func center(of polygon: [CLLocationCoordinate2D]) -> CLLocationCoordinate2D? {
+        guard !polygon.isEmpty else { return nil }
+
+        var totalLat: Double = 0
+        var totalLng: Double = 0
+
+        for coord in polygon {
+            totalLat += coord.latitude
+            totalLng += coord.longitude
+        }
+
+        let count = Double(polygon.count)
+        return CLLocationCoordinate2D(
+            latitude: totalLat / count,
+            longitude: totalLng / count
+        )
+    }
+}
@@ -436,6 +436,12 @@ class SceneDelegate: UIResponder, UIWindowSceneDelegate {
         }
         WWWLog.i(tag, "Locale change observer installed")
 
+        // Recycle map views between event map screens (trimmed on memory warnings)
+        MapViewPool.shared.install()
+
+        // Render chain signposts for Instruments (no-op unless recording)
+        WWWSignposts.shared.install()
+
         // Observe memory warnings for leak detection and monitoring
         memoryPressureObserver = NotificationCenter.default.addObserver(
             forName: UIApplication.didReceiveMemoryWarningNotification,
@@ -588,6 +594,11 @@ class SceneDelegate: UIResponder, UIWindowSceneDelegate {
 
         // Note: MapWrapperRegistry.wrappers is private - cannot access from Swift
         // Wrapper count monitoring would require adding a public method to MapWrapperRegistry
+        do {
+            try RootControllerKt.trimMemory()
+        } catch {
+            WWWLog.e(tag, "[MEMORY] Failed to trim geometry cache", error: error)
+        }
     }
 
     /// Report current memory usage in megabytes.
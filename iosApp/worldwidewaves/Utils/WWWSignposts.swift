@@ -0,0 +1,123 @@
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural boundaries, fostering unity,
+ * community, and shared human experience by leveraging real-time coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import Foundation
+import os
+import Shared
+
+/// `os_signpost` intervals for the wave render chain (Kotlin `RenderStage`), visible in
+/// Instruments under the "RenderPipeline" category (Points of Interest / os_signpost).
+///
+/// ## Kotlin Stages
+/// Installed as Kotlin's `SignpostSink`: `RenderTrace` reports observer, event map and registry
+/// stages through it, already tagged with event id, polygon count and vertex count.
+///
+/// ## Swift Stages
+/// `measure` and `beginInterval`/`endInterval` time the bridge, layer update and frame stages
+/// and feed the same in-app aggregate (`RenderTrace.recordNanos`, p50/p95 in `PerformanceReport`).
+///
+/// Signposts are only emitted while Instruments records; the aggregate always runs.
+///
+/// - Important: Swift stages are main-thread only
+final class WWWSignposts: NSObject, SignpostSink {
+    static let shared = WWWSignposts()
+
+    /// A running Swift-side interval
+    struct Interval {
+        let stage: RenderStage
+        let id: OSSignpostID?
+        let startNanos: UInt64
+    }
+
+    private let log = OSLog(subsystem: Bundle.main.bundleIdentifier ?? "com.worldwidewaves", category: "RenderPipeline")
+
+    private override init() {
+        super.init()
+    }
+
+    /// Routes Kotlin render stages to os_signpost. Safe to call more than once.
+    func install() {
+        SignpostBridge.shared.sink = self
+    }
+
+    // MARK: - Swift Stages
+
+    /// Runs `block` as `stage` of the render chain.
+    @discardableResult
+    func measure<T>(
+        _ stage: RenderStage,
+        eventId: String,
+        polygons: Int = 0,
+        vertices: Int = 0,
+        _ block: () throws -> T
+    ) rethrows -> T {
+        let interval = beginInterval(stage, eventId: eventId, polygons: polygons, vertices: vertices)
+        defer { endInterval(interval) }
+        return try block()
+    }
+
+    func beginInterval(_ stage: RenderStage, eventId: String, polygons: Int = 0, vertices: Int = 0) -> Interval {
+        var id: OSSignpostID?
+        if log.signpostsEnabled {
+            let signpostID = OSSignpostID(log: log)
+            os_signpost(
+                .begin, log: log, name: Self.name(of: stage.traceName), signpostID: signpostID,
+                "event=%{public}s polygons=%ld vertices=%ld", eventId, polygons, vertices
+            )
+            id = signpostID
+        }
+        return Interval(stage: stage, id: id, startNanos: DispatchTime.now().uptimeNanoseconds)
+    }
+
+    func endInterval(_ interval: Interval) {
+        let elapsed = DispatchTime.now().uptimeNanoseconds - interval.startNanos
+        RenderTrace.shared.recordNanos(stage: interval.stage, nanos: Int64(elapsed))
+        if let id = interval.id {
+            os_signpost(.end, log: log, name: Self.name(of: interval.stage.traceName), signpostID: id)
+        }
+    }
+
+    // MARK: - SignpostSink (Kotlin stages)
+
+    func isRecording() -> Bool {
+        log.signpostsEnabled
+    }
+
+    func beginInterval(name: String, detail: String, id: Int32) {
+        os_signpost(.begin, log: log, name: Self.name(of: name), signpostID: OSSignpostID(UInt64(id)), "%{public}s", detail)
+    }
+
+    func endInterval(name: String, id: Int32) {
+        os_signpost(.end, log: log, name: Self.name(of: name), signpostID: OSSignpostID(UInt64(id)))
+    }
+
+    /// os_signpost needs static names: one per `RenderStage.traceName`.
+    private static func name(of traceName: String) -> StaticString {
+        switch traceName {
+        case "observer.updateStates": return "observer.updateStates"
+        case "map.updateWavePolygons": return "map.updateWavePolygons"
+        case "registry.setPendingPolygons": return "registry.setPendingPolygons"
+        case "bridge.renderPendingPolygons": return "bridge.renderPendingPolygons"
+        case "map.updatePolygonLayers": return "map.updatePolygonLayers"
+        case "map.frame": return "map.frame"
+        default: return "render"
+        }
+    }
+}
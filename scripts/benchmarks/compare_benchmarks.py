@@ -0,0 +1,127 @@
+# Copyright 2025 DrWave
+#
+# WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+# countries. The project aims to transcend physical and cultural
+# boundaries, fostering unity, community, and shared human experience by leveraging real-time
+# coordination and location-based services.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Collects `WWW-BENCH` result lines from Gradle test reports and compares them with the
+per-platform baselines in scripts/benchmarks/baselines/<platform>.json.
+
+Exits with 1 when a benchmark is slower than its baseline by more than the threshold.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+import xml.etree.ElementTree as ET
+from pathlib import Path
+
+REPORT_PREFIX = "WWW-BENCH "
+BASELINE_DIR = Path(__file__).resolve().parent / "baselines"
+
+
+def collect(results_dir: Path) -> dict[str, dict[str, dict]]:
+    """Benchmark results by platform, then by benchmark name."""
+    results: dict[str, dict[str, dict]] = {}
+    for report in sorted(results_dir.rglob("*.xml")):
+        try:
+            root = ET.parse(report).getroot()
+        except ET.ParseError as e:
+            print(f"[WARNING] Cannot parse {report}: {e}", file=sys.stderr)
+            continue
+        for node in root.iter("system-out"):
+            for line in (node.text or "").splitlines():
+                line = line.strip()
+                if not line.startswith(REPORT_PREFIX):
+                    continue
+                result = json.loads(line[len(REPORT_PREFIX):])
+                results.setdefault(result["platform"], {})[result["name"]] = result
+    return results
+
+
+def nanos_per_op(result: dict) -> float:
+    return result["medianNanos"] / max(1, result["operationsPerIteration"])
+
+
+def compare(platform: str, current: dict[str, dict], baseline: dict[str, dict], threshold: float) -> list[str]:
+    regressions = []
+    print(f"\n== {platform} ==")
+    print(f"{'benchmark':<60} {'baseline ns/op':>16} {'current ns/op':>16} {'change':>9}")
+    for name in sorted(current):
+        now = nanos_per_op(current[name])
+        if name not in baseline:
+            print(f"{name:<60} {'-':>16} {now:>16.0f} {'new':>9}")
+            continue
+        before = nanos_per_op(baseline[name])
+        change = (now - before) / before if before > 0 else 0.0
+        flag = ""
+        if change > threshold:
+            flag = "  REGRESSION"
+            regressions.append(f"{platform}/{name}: {change:+.1%}")
+        print(f"{name:<60} {before:>16.0f} {now:>16.0f} {change:>+8.1%}{flag}")
+    for name in sorted(set(baseline) - set(current)):
+        print(f"{name:<60} {'(not run)':>16}")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--results-dir", type=Path, default=Path("shared/build/test-results"))
+    parser.add_argument("--output", type=Path, help="Directory receiving <platform>.json result files")
+    parser.add_argument("--threshold", type=float, default=0.15, help="Allowed slowdown (default: 0.15 = 15%%)")
+    parser.add_argument("--update-baseline", action="store_true", help="Record the results as new baselines")
+    args = parser.parse_args()
+
+    results = collect(args.results_dir)
+    if not results:
+        print(f"[ERROR] No benchmark results found in {args.results_dir}", file=sys.stderr)
+        return 1
+
+    if args.output:
+        args.output.mkdir(parents=True, exist_ok=True)
+        for platform, current in results.items():
+            (args.output / f"{platform}.json").write_text(json.dumps(current, indent=2, sort_keys=True) + "\n")
+
+    if args.update_baseline:
+        BASELINE_DIR.mkdir(parents=True, exist_ok=True)
+        for platform, current in results.items():
+            path = BASELINE_DIR / f"{platform}.json"
+            path.write_text(json.dumps(current, indent=2, sort_keys=True) + "\n")
+            print(f"[INFO] Baseline updated: {path} ({len(current)} benchmarks)")
+        return 0
+
+    regressions = []
+    for platform, current in sorted(results.items()):
+        path = BASELINE_DIR / f"{platform}.json"
+        baseline = json.loads(path.read_text()) if path.exists() else {}
+        if not baseline:
+            print(f"[WARNING] No baseline for {platform} (record one with --update-baseline)")
+        regressions += compare(platform, current, baseline, args.threshold)
+
+    if regressions:
+        print(f"\n[ERROR] {len(regressions)} benchmark(s) regressed by more than {args.threshold:.0%}:")
+        for regression in regressions:
+            print(f"  {regression}")
+        return 1
+    print("\n[INFO] No benchmark regression")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
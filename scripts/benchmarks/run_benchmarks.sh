@@ -0,0 +1,58 @@
+#!/bin/bash
+#
+# Copyright 2025 DrWave
+#
+# WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+# countries. The project aims to transcend physical and cultural
+# boundaries, fostering unity, community, and shared human experience by leveraging real-time
+# coordination and location-based services.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# Runs the shared benchmark suite and compares the results with the committed baselines.
+#
+# Usage:
+#   ./scripts/benchmarks/run_benchmarks.sh                     # Run and compare
+#   ./scripts/benchmarks/run_benchmarks.sh --update-baseline   # Run and record new baselines
+#   ./scripts/benchmarks/run_benchmarks.sh --jvm-only          # Skip the iOS simulator run
+#
+# JVM benchmarks run everywhere; Kotlin/Native benchmarks need macOS (iOS simulator).
+
+set -e
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+ROOT_DIR="$(cd "$SCRIPT_DIR/../.." && pwd)"
+
+JVM_ONLY=false
+COMPARE_ARGS=()
+for arg in "$@"; do
+    case "$arg" in
+        --jvm-only) JVM_ONLY=true ;;
+        *) COMPARE_ARGS+=("$arg") ;;
+    esac
+done
+
+TASKS=(":shared:testDebugUnitTest")
+if [[ "$JVM_ONLY" == false && "$(uname)" == "Darwin" ]]; then
+    TASKS+=(":shared:iosSimulatorArm64Test")
+else
+    echo "[INFO] Skipping Kotlin/Native benchmarks (macOS only or --jvm-only)"
+fi
+
+cd "$ROOT_DIR"
+rm -rf shared/build/test-results
+./gradlew "${TASKS[@]}" -Pbenchmarks --rerun-tasks
+
+python3 "$SCRIPT_DIR/compare_benchmarks.py" \
+    --results-dir shared/build/test-results \
+    --output shared/build/benchmarks \
+    ${COMPARE_ARGS[@]+"${COMPARE_ARGS[@]}"}
@@ -24,24 +24,16 @@ cd "$(dirname "$0")" || exit # always work from executable folder
 
 #set -x
 
-# Parse command line arguments
-FORCE_GENERATION=false
-EVENT_PARAM=""
-
-while [[ "$#" -gt 0 ]]; do
-  case $1 in
-    -f|--force) FORCE_GENERATION=true ;;
-    *)
-      if [ -z "$EVENT_PARAM" ]; then
-        EVENT_PARAM="$1"
-      else
-        echo "Unknown parameter: $1"
-        exit 1
-      fi
-      ;;
-  esac
-  shift
-done
+# Parse command line arguments (-f/--force, -j/--jobs N, see libs/build.inc.sh)
+. ./libs/build.inc.sh
+parse_build_options "$@"
+set -- "${BUILD_ARGS[@]}"
+
+EVENT_PARAM="${1:-}"
+if [ "$#" -gt 1 ]; then
+  echo "Unknown parameter: $2"
+  exit 1
+fi
 
 mkdir -p ./bin
 mkdir -p ./data
@@ -73,40 +65,35 @@ if [ ! -z "$EVENT_PARAM" ]; then
   fi
 fi
 
-for event in $EVENTS; do # Download OSM area as PBF file
-                         # and generates a dedicated PBF file for corresponding BBOX
-                         # EVENTS is defined in lib.inc.sh
-  echo "==> EVENT $event"
+# Extract the event BBOX from its (already downloaded) OSM area and generate the
+# OpenMapTiles environment. Runs in a worker (see run_parallel), output goes to its log.
+# The extract is reused while the area file and the BBOX are unchanged.
+extract_event() {
+  local event="$1"
+  local TYPE BBOX AREAZONE SPBF DPBF key
   TYPE=$(conf "$event" type)
 
-  if [ "$TYPE" = "world" ]; then
-    echo "Skip the world"
-    continue
-  fi
-
   # Get the BBOX for this event using the helper function
   if ! BBOX=$(get_event_bbox "$event"); then
     echo "Failed to get BBOX for event $event"
-    continue
+    return 1
   fi
 
   echo "Retrieved BBOX for event $event : $BBOX"
 
-  set -x
   AREAZONE=$(conf "$event" map.zone)
   SPBF=data/osm-${AREAZONE//\//_}.osm.pbf
   DPBF=data/www-${event}.osm.pbf
-  set +x
 
-  [ ! -f "$SPBF" ] && echo "-- Download area $AREAZONE from OSM.." && download-osm "$AREAZONE" -o "$SPBF"
-
-   if [ "$FORCE_GENERATION" = true ] || [ ! -f "$DPBF" ]; then
+  key=$(inputs_hash "=$(cat "$STAMPS_DIR/zones/$(basename "$SPBF").hash")" "=$BBOX")
+  if is_up_to_date extract "$event" "$key" "$DPBF"; then
+    echo "   DPBF file is up to date. Use -f to force regeneration."
+  else
     echo "-- Extract bbox $BBOX from area $AREAZONE.."
     set -x
-    ./bin/osmconvert "$SPBF" -b="$BBOX" -o="$DPBF" && ./bin/osmconvert "$DPBF" --out-statistics
+    ./bin/osmconvert "$SPBF" -b="$BBOX" -o="$DPBF" && ./bin/osmconvert "$DPBF" --out-statistics || return 1
     set +x
-  else
-    echo "   DPBF file already exists. Use -f to force regeneration."
+    record_build extract "$event" "$key"
   fi
 
   echo "-- Generates OpenMapTiles environment for event $event"
@@ -114,5 +101,36 @@ for event in $EVENTS; do # Download OSM area as PBF file
 
   echo "-- Generates OpenMapTiles tileset definition for event $event"
   tpl "$event" templates/template-omt-"${TYPE}".yaml data/"${event}".yaml
+}
 
+# Download every OSM area once, sequentially (events of the same zone share it)
+MAP_EVENTS=()
+mkdir -p "$STAMPS_DIR/zones"
+for event in $EVENTS; do # EVENTS is defined in lib.inc.sh
+  echo "==> EVENT $event"
+  TYPE=$(conf "$event" type)
+
+  if [ "$TYPE" = "world" ]; then
+    echo "Skip the world"
+    continue
+  fi
+
+  AREAZONE=$(conf "$event" map.zone)
+  SPBF=data/osm-${AREAZONE//\//_}.osm.pbf
+  ZONE_HASH="$STAMPS_DIR/zones/$(basename "$SPBF").hash"
+
+  if [ ! -f "$SPBF" ]; then
+    echo "-- Download area $AREAZONE from OSM.."
+    download-osm "$AREAZONE" -o "$SPBF"
+    rm -f "$ZONE_HASH"
+  fi
+  # Hash each area once per download, not once per event
+  [ -f "$ZONE_HASH" ] && [ "$ZONE_HASH" -nt "$SPBF" ] || inputs_hash "$SPBF" > "$ZONE_HASH"
+
+  MAP_EVENTS+=("$event")
 done
+
+# Extract the events BBOX concurrently
+if [ ${#MAP_EVENTS[@]} -gt 0 ]; then
+  run_parallel extract extract_event "${MAP_EVENTS[@]}"
+fi
@@ -44,6 +44,9 @@ cd "$(dirname "$0")" || exit # always work from executable folder
 
 # ---------- Vars and support functions ---------------------------------------
 . ./libs/lib.inc.sh
+. ./libs/build.inc.sh
+parse_build_options "$@" # -f/--force to rebuild up-to-date tiles
+set -- "${BUILD_ARGS[@]}"
 
 # -----------------------------------------------------------------------------
 
@@ -80,11 +83,14 @@ fi
 
 # -----------------------------------------------------------------------------
 
+# Tiles are generated one event at a time: every generation runs in the single
+# openmaptiles checkout against the same PostGIS container. They are only
+# regenerated when the extract, the tileset definition or the generation setup changed.
+
 for event in $EVENTS; do # Generate MBTILES files from PBF area files 
                          # EVENTS is defined in lib.inc.sh
 
   echo "==> EVENT $event"
-  rm -f "./data/$event.mbtiles" # Clean previous MBTILES
 
   TYPE=$(conf "$event" type)
 
@@ -93,7 +99,33 @@ for event in $EVENTS; do # Generate MBTILES files from PBF area files
     continue
   fi
 
+  MBTILES="./data/$event.mbtiles"
+  KEY=$(inputs_hash "./data/www-$event.osm.pbf" "./data/.env-$event" "./data/$event.yaml" \
+    .omt-env-global ./libs/generate_map.dep.sh)
+  if is_up_to_date mbtiles "$event" "$KEY" "$MBTILES"; then
+    echo "   MBTILES file is up to date. Use -f to force regeneration."
+    continue
+  fi
+
+  rm -f "$MBTILES" # Clean previous MBTILES
+
   echo
-  [ ! -f "./data/$event.mbtiles" ] && ./libs/generate_map.dep.sh "$event"
+  if ./libs/generate_map.dep.sh "$event" && [ -f "$MBTILES" ]; then
+    record_build mbtiles "$event" "$KEY"
+  else
+    echo "MBTILES generation failed for event $event"
+  fi
 
 done
+
+# -----------------------------------------------------------------------------
+
+# Size and tile count of every generated MBTILES file (see the README tile profile)
+REPORT_FILES=()
+for event in $EVENTS; do
+  [ -f "./data/$event.mbtiles" ] && REPORT_FILES+=("./data/$event.mbtiles")
+done
+if [ ${#REPORT_FILES[@]} -gt 0 ]; then
+  echo "==> MBTILES report"
+  python3 ./mbtiles-report.py --json ./data/tiles-report.json "${REPORT_FILES[@]}"
+fi
@@ -32,6 +32,9 @@ mkdir -p $DEST_DIR
 
 # ---------- Vars and support functions ---------------------------------------
 . ./libs/lib.inc.sh
+. ./libs/build.inc.sh
+parse_build_options "$@" # -f/--force to download again, -j N workers
+set -- "${BUILD_ARGS[@]}"
 
 # -----------------------------------------------------------------------------
 
@@ -109,62 +112,92 @@ merge_geojsons() {
     }' "${input_files[@]}" > "$output_file"
 }
 
-for event in $EVENTS; do # Retrieve Geojson files from OSM
-  echo "==> EVENT $event"
-  echo
-
-  TYPE=$(conf "$event" type)
-
-  if [ "$TYPE" = "world" ]; then
-    echo "Skip the world"
-    continue
-  fi
+# Retrieve the GeoJSON area of an event from OSM and convert it to a binary area.
+# Runs in a worker (see run_parallel). The GeoJSON is downloaded again only when the
+# admin ids changed (or with --force), the binary area only when the GeoJSON or the
+# converter changed.
+retrieve_event() {
+  local event="$1"
+  local ADMINIDS MERGED_GEOJSON AREA_FILE key
 
   # Get the OSM admin IDs for this event
   ADMINIDS=$(get_osmAdminids "$event")
 
   if [ -z "$ADMINIDS" ]; then
     echo "Error: No area.osmAdminids found for event $event"
-    continue
+    return 1
   fi
 
   echo "Retrieved OSM Admin IDs for event $event: $ADMINIDS"
 
-  # Array to store the paths of downloaded GeoJSON files
-  geojson_files=()
-
-  # Download GeoJSON for each admin ID
-  for admin_id in $(echo "$ADMINIDS" | tr ',' ' '); do
-    echo "Downloading GeoJSON for OSM Admin ID: $admin_id"
-    # Create a unique temporary filename for each admin ID
-    temp_geojson="data/${event}_${admin_id}.geojson"
-    wget "http://polygons.openstreetmap.fr/get_geojson.py?id=${admin_id}&params=0" -O "$temp_geojson"
-
-    # Add this file to our array if the download was successful
-    if [ -s "$temp_geojson" ]; then
-      geojson_files+=("$temp_geojson")
-    else
-      echo "Warning: Failed to download GeoJSON for admin ID $admin_id"
-    fi
-  done
-
-  # Merge all downloaded GeoJSON files into a single one
-  #DEST_GEOJSON=$DEST_DIR/$event.geojson
   MERGED_GEOJSON="data/${event}.geojson"
+  key=$(inputs_hash "=$ADMINIDS")
+
+  if is_up_to_date geojson "$event" "$key" "$MERGED_GEOJSON"; then
+    echo "GeoJSON for event $event is up to date. Use -f to force download."
+  else
+    # Array to store the paths of downloaded GeoJSON files
+    local geojson_files=()
+    local admin_id temp_geojson temp_file
+
+    # Download GeoJSON for each admin ID
+    for admin_id in $(echo "$ADMINIDS" | tr ',' ' '); do
+      echo "Downloading GeoJSON for OSM Admin ID: $admin_id"
+      # Create a unique temporary filename for each admin ID
+      temp_geojson="data/${event}_${admin_id}.geojson"
+      wget "http://polygons.openstreetmap.fr/get_geojson.py?id=${admin_id}&params=0" -O "$temp_geojson"
+
+      # Add this file to our array if the download was successful
+      if [ -s "$temp_geojson" ]; then
+        geojson_files+=("$temp_geojson")
+      else
+        echo "Warning: Failed to download GeoJSON for admin ID $admin_id"
+      fi
+    done
+
+    # Merge all downloaded GeoJSON files into a single one
+    echo "Merging ${#geojson_files[@]} GeoJSON files for event $event"
+    merge_geojsons "$MERGED_GEOJSON" "${geojson_files[@]}"
+    echo "Created GeoJSON for event $event at $MERGED_GEOJSON"
+
+    # Clean up temporary files if needed
+    for temp_file in "${geojson_files[@]}"; do
+      if [ "$temp_file" != "$MERGED_GEOJSON" ]; then
+        rm "$temp_file"
+      fi
+    done
+
+    # A partial download is not reused
+    if [ ${#geojson_files[@]} -eq "$(echo "$ADMINIDS" | tr ',' '\n' | wc -l)" ]; then
+      record_build geojson "$event" "$key"
+    fi
+  fi
 
-  echo "Merging ${#geojson_files[@]} GeoJSON files for event $event"
-  merge_geojsons "$MERGED_GEOJSON" "${geojson_files[@]}"
-
-  # Copy the final merged GeoJSON to the destination
-  #cp "$MERGED_GEOJSON" "$DEST_GEOJSON"
-  echo "Created GeoJSON for event $event at $MERGED_GEOJSON"
-
-  # Clean up temporary files if needed
-  for temp_file in "${geojson_files[@]}"; do
-    if [ "$temp_file" != "$MERGED_GEOJSON" ]; then
-      rm "$temp_file"
+  # Preprocessed binary area read by the app instead of parsing the GeoJSON (optional)
+  AREA_FILE="data/${event}.wwa"
+  if command -v node &> /dev/null; then
+    key=$(inputs_hash "$MERGED_GEOJSON" geojson-to-area.js)
+    if is_up_to_date area "$event" "$key" "$AREA_FILE"; then
+      echo "Binary area for event $event is up to date"
+    elif node geojson-to-area.js "$MERGED_GEOJSON" "$AREA_FILE"; then
+      record_build area "$event" "$key"
+    else
+      echo "Warning: Failed to generate binary area for event $event"
     fi
-  done
+  else
+    echo "Warning: node not found, skipping binary area for event $event"
+  fi
+}
 
-  echo
+MAP_EVENTS=()
+for event in $EVENTS; do
+  if [ "$(conf "$event" type)" = "world" ]; then
+    echo "Skip the world"
+    continue
+  fi
+  MAP_EVENTS+=("$event")
 done
+
+if [ ${#MAP_EVENTS[@]} -gt 0 ]; then
+  run_parallel geojson retrieve_event "${MAP_EVENTS[@]}"
+fi
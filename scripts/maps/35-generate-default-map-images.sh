@@ -44,6 +44,9 @@ fi
 # ---------- Vars and support functions ---------------------------------------
 cd "$(dirname "$0")" || exit # always work from executable folder
 . ./libs/lib.inc.sh
+. ./libs/build.inc.sh
+parse_build_options "$@" # -f/--force to render up-to-date images, -j N workers
+set -- "${BUILD_ARGS[@]}"
 # shellcheck disable=SC2164
 cd "$(dirname "$0")" # always work from executable folder
 
@@ -179,37 +182,41 @@ echo
 # Ensure output directory exists
 mkdir -p "$OUTPUT_DIR"
 
-# Process each event
-for event in $EVENTS; do
-    echo -e "${GREEN}==> Processing event $event${NC}"
-    
-    TYPE=$(conf "$event" type)
-    if [ "$TYPE" = "world" ]; then
-        echo "Skip the world"
-        continue
-    fi
-    
+# Render the default map image of an event. Runs in a worker (see run_parallel).
+# The image is rendered again only when one of its inputs changed: GeoJSON, MBTiles,
+# style, renderer, bbox or dimensions.
+render_event() {
+    local event="$1"
+    local GEOJSON_FILE MBTILES_FILE OUTPUT_FILE BBOX_RAW NODE_EXTRA_ARGS key
+
     # Check if GeoJSON file exists
     GEOJSON_FILE="$GEOJSON_DIR/${event}.geojson"
     if [ ! -f "$GEOJSON_FILE" ]; then
         echo -e "${YELLOW}GeoJSON file not found for $event. Skipping.${NC}"
-        continue
+        return 0
     fi
 
     # Check if MBTiles file exists
     MBTILES_FILE="$MBTILES_DIR/${event}.mbtiles"
     if [ ! -f "$MBTILES_FILE" ]; then
         echo -e "${YELLOW}MBTILES file not found for $event. Skipping.${NC}"
-        continue
+        return 0
     fi
-    
+
     # Output file path
     OUTPUT_FILE="$OUTPUT_DIR/e_map_${event}.png"
-    
+
     # Detect if we have an explicit bbox in events.json.
     BBOX_RAW=$(get_event_bbox "$event")
     NODE_EXTRA_ARGS=""
 
+    key=$(inputs_hash "$GEOJSON_FILE" "$MBTILES_FILE" "$STYLE_DIR/mapstyle.json" "$NODE_SCRIPT" \
+        "=$BBOX_RAW" "=${IMAGE_WIDTH}x${IMAGE_HEIGHT}")
+    if is_up_to_date image "$event" "$key" "$OUTPUT_FILE"; then
+        echo -e "${GREEN}Map image for $event is up to date: $OUTPUT_FILE${NC}"
+        return 0
+    fi
+
     if [ -n "$BBOX_RAW" ] && [ "$BBOX_RAW" != "null" ]; then
         IFS=',' read -r MIN_LNG MIN_LAT MAX_LNG MAX_LAT <<< "$BBOX_RAW"
         NODE_EXTRA_ARGS="$MIN_LNG $MIN_LAT $MAX_LNG $MAX_LAT"
@@ -217,25 +224,37 @@ for event in $EVENTS; do
     else
         echo "Rendering map for $event (bbox will be derived from GeoJSON)"
     fi
-    
+
     # Render the map using the Node.js script.
     # shellcheck disable=SC2086 # intentional word-splitting for NODE_EXTRA_ARGS
-    node "$NODE_SCRIPT" \
+    if node "$NODE_SCRIPT" \
         "$GEOJSON_FILE" \
         "$MBTILES_FILE" \
         "$STYLE_DIR/mapstyle.json" \
         "$OUTPUT_FILE" \
         "$IMAGE_WIDTH" \
         "$IMAGE_HEIGHT" \
-        $NODE_EXTRA_ARGS
-    
-    if [ $? -eq 0 ]; then
+        $NODE_EXTRA_ARGS; then
+        record_build image "$event" "$key"
         echo -e "${GREEN}Successfully generated map image for $event: $OUTPUT_FILE${NC}"
     else
         echo -e "${RED}Failed to generate map image for $event${NC}"
+        return 1
     fi
-    
-    echo
+}
+
+# Process the events concurrently (renderers share the X display)
+MAP_EVENTS=()
+for event in $EVENTS; do
+    if [ "$(conf "$event" type)" = "world" ]; then
+        echo "Skip the world"
+        continue
+    fi
+    MAP_EVENTS+=("$event")
 done
 
+if [ ${#MAP_EVENTS[@]} -gt 0 ]; then
+    run_parallel image render_event "${MAP_EVENTS[@]}"
+fi
+
 echo -e "${GREEN}Map image generation complete!${NC}"
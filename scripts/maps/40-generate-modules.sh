@@ -104,6 +104,13 @@ for event in $EVENTS; do # Retrieve Geojson files from OSM
       echo "Copied $event.geojson because it did not exist or differed by MD5."
   fi
 
+  # 3) Check the binary area file (optional, generated from the GeoJSON)
+  if [ -f "data/$event.wwa" ] && { [ ! -f "$DEST_DIR_MODULE_FILES/$event.wwa" ] || \
+     [ "$(md5sum "data/$event.wwa" | awk '{print $1}')" != "$(md5sum "$DEST_DIR_MODULE_FILES/$event.wwa" 2>/dev/null | awk '{print $1}')" ]; }; then
+      cp -f "data/$event.wwa" "$DEST_DIR_MODULE_FILES/"
+      echo "Copied $event.wwa because it did not exist or differed by MD5."
+  fi
+
   [ ! -f "$DEST_DIR_MODULE/.gitignore" ] && echo "/build" > "$DEST_DIR_MODULE/.gitignore"
 
   INCLUDE_GRADLE='include(":maps:'$event'")'
@@ -150,6 +157,9 @@ add_odr_entries_to_plist() {
             # Add geojson and mbtiles file references
             plutil -insert NSBundleResourceRequestTags."$event" -string "$event.geojson" -append "$temp_plist"
             plutil -insert NSBundleResourceRequestTags."$event" -string "$event.mbtiles" -append "$temp_plist"
+            if [ -f "../../maps/$event/src/main/assets/$event.wwa" ]; then
+                plutil -insert NSBundleResourceRequestTags."$event" -string "$event.wwa" -append "$temp_plist"
+            fi
             echo "Added ODR tag for $event (geojson + mbtiles)"
         else
             echo "ODR tag for $event already exists, skipping"
@@ -244,6 +254,18 @@ create_ios_odr_files() {
         else
             echo "ODR file up to date: $event.mbtiles"
         fi
+
+        # Binary area is optional (older modules only ship geojson + mbtiles)
+        local area_source="$source_dir/$event.wwa"
+        local area_dest="$event_dir/$event.wwa"
+        if [ -f "$area_source" ]; then
+            if [ ! -f "$area_dest" ] || [ "$area_source" -nt "$area_dest" ]; then
+                cp "$area_source" "$area_dest"
+                echo "Copied ODR file: $event.wwa"
+            else
+                echo "ODR file up to date: $event.wwa"
+            fi
+        fi
     done
 }
 
@@ -299,6 +321,9 @@ add_odr_tags_to_xcode() {
         # Reference files in iOS project structure
         asset_tags_entries="${asset_tags_entries}				Maps/${event}/${event}.geojson = (${event}, );\n"
         asset_tags_entries="${asset_tags_entries}				Maps/${event}/${event}.mbtiles = (${event}, );\n"
+        if [ -f "$ios_maps_dir/$event/$event.wwa" ]; then
+            asset_tags_entries="${asset_tags_entries}				Maps/${event}/${event}.wwa = (${event}, );\n"
+        fi
     done
 
     # Generate known asset tags entries
@@ -0,0 +1,121 @@
+/* * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+// Converts an event GeoJSON area into the binary .wwa format read by the app
+// (shared/.../events/io/BinaryAreaFormat.kt). Keep both in sync.
+//
+// Usage: node geojson-to-area.js <input.geojson> <output.wwa>
+//
+// Only Node built-ins are used so the map pipeline does not need `npm install` for this step.
+
+const fs = require('fs');
+
+const MAGIC = 0x41575757; // "WWWA" little-endian
+const VERSION = 1;
+const SCALE = 10_000_000;
+const HEADER_INTS = 9;
+const BBOX_INTS = 4;
+
+/** Collects every ring of every Polygon/MultiPolygon, in document order (as GeoJsonAreaParser). */
+function collectRings(geojson) {
+  const rings = [];
+  const visitGeometry = (geometry) => {
+    if (!geometry) return;
+    if (geometry.type === 'Polygon') {
+      geometry.coordinates.forEach((ring) => rings.push(ring));
+    } else if (geometry.type === 'MultiPolygon') {
+      geometry.coordinates.forEach((polygon) => polygon.forEach((ring) => rings.push(ring)));
+    }
+  };
+
+  if (geojson.type === 'FeatureCollection') {
+    (geojson.features || []).forEach((feature) => visitGeometry(feature.geometry));
+  } else if (geojson.type === 'Feature') {
+    visitGeometry(geojson.geometry);
+  } else {
+    visitGeometry(geojson);
+  }
+  return rings;
+}
+
+function encode(rings) {
+  const vertexCount = rings.reduce((sum, ring) => sum + ring.length, 0);
+  const ringCount = rings.length;
+  const ints = new Int32Array(HEADER_INTS + (ringCount + 1) + ringCount * BBOX_INTS + vertexCount * 2);
+  const q = (value) => Math.round(value * SCALE);
+
+  ints[0] = MAGIC;
+  ints[1] = VERSION;
+  ints[2] = SCALE;
+  ints[3] = ringCount;
+  ints[4] = vertexCount;
+
+  const areaBbox = [Infinity, Infinity, -Infinity, -Infinity];
+  let offsetIndex = HEADER_INTS;
+  let bboxIndex = HEADER_INTS + ringCount + 1;
+  let coordinateIndex = bboxIndex + ringCount * BBOX_INTS;
+  let vertex = 0;
+  ints[offsetIndex++] = 0;
+
+  for (const ring of rings) {
+    const bbox = [Infinity, Infinity, -Infinity, -Infinity];
+    for (const [lng, lat] of ring) { // GeoJSON is [lng, lat]
+      const qLat = q(lat);
+      const qLng = q(lng);
+      ints[coordinateIndex++] = qLat;
+      ints[coordinateIndex++] = qLng;
+      bbox[0] = Math.min(bbox[0], qLat);
+      bbox[1] = Math.min(bbox[1], qLng);
+      bbox[2] = Math.max(bbox[2], qLat);
+      bbox[3] = Math.max(bbox[3], qLng);
+    }
+    vertex += ring.length;
+    ints[offsetIndex++] = vertex;
+    if (ring.length > 0) {
+      ints.set(bbox, bboxIndex);
+      for (let k = 0; k < 4; k++) {
+        areaBbox[k] = k < 2 ? Math.min(areaBbox[k], bbox[k]) : Math.max(areaBbox[k], bbox[k]);
+      }
+    }
+    bboxIndex += BBOX_INTS;
+  }
+  if (vertexCount > 0) ints.set(areaBbox, 5);
+
+  // Int32Array is platform-endian: write explicitly little-endian
+  const buffer = Buffer.alloc(ints.length * 4);
+  ints.forEach((value, i) => buffer.writeInt32LE(value, i * 4));
+  return buffer;
+}
+
+function main() {
+  const [input, output] = process.argv.slice(2);
+  if (!input || !output) {
+    console.error('Usage: node geojson-to-area.js <input.geojson> <output.wwa>');
+    process.exit(1);
+  }
+
+  const rings = collectRings(JSON.parse(fs.readFileSync(input, 'utf8')));
+  const buffer = encode(rings);
+  fs.writeFileSync(output, buffer);
+
+  const vertices = rings.reduce((sum, ring) => sum + ring.length, 0);
+  console.log(`Wrote ${output}: ${rings.length} rings, ${vertices} vertices, ${buffer.length} bytes`);
+}
+
+main();
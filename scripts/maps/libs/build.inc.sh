@@ -0,0 +1,150 @@
+#!/bin/bash
+
+#
+# Copyright 2025 DrWave
+#
+# WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+# countries. The project aims to transcend physical and cultural
+# boundaries, fostering unity, community, and shared human experience by leveraging real-time
+# coordination and location-based services.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+# Incremental, parallel build support for the map pipeline scripts.
+#
+# • Stamps: every stage records, per event, a content hash of its inputs in
+#   data/.stamps/<stage>/<event>. A stage skips an event when the hash of its
+#   current inputs matches the stamp and the outputs are still there.
+# • Worker pool: run_parallel runs one function per event, at most MAP_JOBS at a
+#   time, each event logging to data/logs/<stage>/<event>.log.
+#
+# Source after lib.inc.sh. Options (see parse_build_options):
+#   -f | --force     rebuild even when the stamps are up to date
+#   -j N | --jobs N  number of concurrent workers (default: MAP_JOBS or CPU count)
+
+STAMPS_DIR=./data/.stamps
+LOGS_DIR=./data/logs
+
+MAP_JOBS=${MAP_JOBS:-$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 2)}
+FORCE_GENERATION=${FORCE_GENERATION:-false}
+
+if command -v sha256sum &> /dev/null; then
+  _sha256() { sha256sum | awk '{print $1}'; }
+else
+  _sha256() { shasum -a 256 | awk '{print $1}'; }
+fi
+
+# Parse the build options out of the script arguments.
+# Sets FORCE_GENERATION and MAP_JOBS, leaves the other arguments in BUILD_ARGS.
+# Usage: parse_build_options "$@"; set -- "${BUILD_ARGS[@]}"
+parse_build_options() {
+  BUILD_ARGS=()
+  while [ "$#" -gt 0 ]; do
+    case $1 in
+      -f|--force) FORCE_GENERATION=true ;;
+      -j|--jobs) shift; MAP_JOBS="$1" ;;
+      -j*) MAP_JOBS="${1#-j}" ;;
+      *) BUILD_ARGS+=("$1") ;;
+    esac
+    shift
+  done
+
+  if ! [[ $MAP_JOBS =~ ^[1-9][0-9]*$ ]]; then
+    echo "Invalid number of jobs: $MAP_JOBS" >&2
+    exit 1
+  fi
+}
+
+# Hash of build inputs: files are hashed by content (a missing file hashes as missing),
+# arguments starting with '=' are hashed as literal values (bbox, dimensions, ...).
+# Usage: inputs_hash <file|=value>...
+inputs_hash() {
+  local item
+  for item in "$@"; do
+    case "$item" in
+      =*) printf 'value:%s\n' "${item#=}" ;;
+      *)
+        if [ -f "$item" ]; then
+          printf 'file:%s:%s\n' "$(basename "$item")" "$(_sha256 < "$item")"
+        else
+          printf 'missing:%s\n' "$(basename "$item")"
+        fi
+        ;;
+    esac
+  done | _sha256
+}
+
+# True when <stage> already built <event> from inputs hashing to <key> and every
+# output still exists (always false with --force).
+# Usage: is_up_to_date <stage> <event> <key> <output>...
+is_up_to_date() {
+  local stage="$1" event="$2" key="$3"
+  shift 3
+
+  [ "$FORCE_GENERATION" = true ] && return 1
+  [ "$(cat "$STAMPS_DIR/$stage/$event" 2>/dev/null)" = "$key" ] || return 1
+
+  local output
+  for output in "$@"; do
+    [ -s "$output" ] || return 1
+  done
+}
+
+# Record that <stage> built <event> from inputs hashing to <key>.
+# Usage: record_build <stage> <event> <key>
+record_build() {
+  mkdir -p "$STAMPS_DIR/$1"
+  echo "$3" > "$STAMPS_DIR/$1/$2"
+}
+
+# Run `<function> <event>` for every event with at most MAP_JOBS running at once.
+# Each event logs to data/logs/<stage>/<event>.log; a failure does not stop the others.
+# Returns non-zero when at least one event failed.
+# Usage: run_parallel <stage> <function> <event>...
+run_parallel() {
+  local stage="$1" fn="$2"
+  shift 2
+
+  local log_dir="$LOGS_DIR/$stage"
+  local event status failures=0
+  mkdir -p "$log_dir"
+  for event in "$@"; do
+    rm -f "${log_dir:?}/$event.status"
+  done
+
+  echo "--> $stage: $# events, $MAP_JOBS at a time (logs in $log_dir)"
+  for event in "$@"; do
+    # jobs -rp (not wait -n) keeps this working with the bash 3.2 shipped on macOS
+    while [ "$(jobs -rp | wc -l)" -ge "$MAP_JOBS" ]; do
+      sleep 1
+    done
+    (
+      "$fn" "$event" > "$log_dir/$event.log" 2>&1
+      echo $? > "$log_dir/$event.status"
+    ) &
+  done
+  wait
+
+  for event in "$@"; do
+    status=$(cat "$log_dir/$event.status" 2>/dev/null || echo 1)
+    if [ "$status" = "0" ]; then
+      echo "   done   $event"
+    else
+      echo "   FAILED $event (see $log_dir/$event.log)"
+      failures=$((failures + 1))
+    fi
+  done
+
+  [ "$failures" -eq 0 ]
+}
@@ -236,6 +236,56 @@ get_event_center() {
   ./libs/get_bbox.dep.sh "$osmAdminids" center
 }
 
+# -----------------------------------------------------------------------------
+# Wave tile profile: zoom range of the tiles generated for an event.
+#   • max: the event max zoom, capped at TILES_DETAIL_ZOOM. OpenMapTiles puts every
+#     feature at full detail in z14 tiles and MapLibre overzooms them up to the map
+#     max zoom, so deeper tiles only duplicate data (and are most of the tiles).
+#   • min: the zoom that fits the whole bbox in the smallest map the app shows: the
+#     16:9 event detail map (WWWGlobals MAP_RATIO) on a 320pt wide screen, i.e.
+#     TILES_MIN_VIEW_WIDTH x TILES_MIN_VIEW_HEIGHT points in MapBoundsEnforcer BOUNDS
+#     mode, rounded down and never below the event min zoom. Below it the map is blank.
+# -----------------------------------------------------------------------------
+TILES_DETAIL_ZOOM=14
+TILES_MIN_VIEW_WIDTH=320
+TILES_MIN_VIEW_HEIGHT=180 # 320 / (16/9)
+
+# Usage: get_tiles_zoom_range <event_id> <bbox>
+# Returns: "minZoom maxZoom"
+get_tiles_zoom_range() {
+  local event="$1"
+  local bbox="$2"
+
+  awk -v bbox="$bbox" \
+      -v minZoom="$(conf "$event" map.minZoom)" \
+      -v maxZoom="$(conf "$event" map.maxZoom)" \
+      -v detailZoom="$TILES_DETAIL_ZOOM" \
+      -v viewWidth="$TILES_MIN_VIEW_WIDTH" \
+      -v viewHeight="$TILES_MIN_VIEW_HEIGHT" 'BEGIN {
+    maxTiles = (maxZoom + 0 < detailZoom + 0) ? maxZoom : detailZoom
+    minTiles = minZoom
+
+    # Web Mercator with 512px tiles, as in MapLibre: the tighter of both axes fits
+    split(bbox, b, ",")
+    pi = atan2(0, -1)
+    lngSpan = b[3] - b[1]
+    ySpan = mercatorY(b[4], pi) - mercatorY(b[2], pi)
+    if (lngSpan > 0 && ySpan > 0) {
+      lngZoom = log(viewWidth * 360 / (lngSpan * 512)) / log(2)
+      latZoom = log(viewHeight * 2 * pi / (ySpan * 512)) / log(2)
+      fitZoom = int(lngZoom < latZoom ? lngZoom : latZoom)
+      if (fitZoom > minTiles + 0) minTiles = fitZoom
+    }
+    if (minTiles + 0 > maxTiles + 0) minTiles = maxTiles
+
+    printf "%d %d\n", minTiles, maxTiles
+  }
+  function mercatorY(lat, pi,   r) {
+    r = lat * pi / 180
+    return log(sin(r) / cos(r) + 1 / cos(r))
+  }'
+}
+
 safe_replace() {
   local pattern=$1
   local value=$2
@@ -256,10 +306,11 @@ tpl() {
   tpl_file=$(mktemp)
   cp "$template_file" "$tpl_file"
 
-  # Get bbox and center information
-  local bbox center
+  # Get bbox, center and tile zoom range information
+  local bbox center tilesMinZoom tilesMaxZoom
   bbox=$(get_event_bbox "$event")
   center=$(get_event_center "$event")
+  read -r tilesMinZoom tilesMaxZoom <<< "$(get_tiles_zoom_range "$event" "$bbox")"
 
   # Replace placeholders with event properties and bbox/center data
 
@@ -268,6 +319,8 @@ tpl() {
     -e "\"$(safe_replace "#id#" "$event")\"" \
     -e "\"$(safe_replace "#map.center#" "$center")\"" \
     -e "\"$(safe_replace "#map.bbox#" "$bbox")\"" \
+    -e "\"$(safe_replace "#tiles.minZoom#" "$tilesMinZoom")\"" \
+    -e "\"$(safe_replace "#tiles.maxZoom#" "$tilesMaxZoom")\"" \
     "$tpl_file"
 
   # Then handle all other properties using the standard approach
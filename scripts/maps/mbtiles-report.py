@@ -0,0 +1,103 @@
+# Copyright 2025 DrWave
+#
+# WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+# countries. The project aims to transcend physical and cultural
+# boundaries, fostering unity, community, and shared human experience by leveraging real-time
+# coordination and location-based services.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Size and tile-count report of generated event MBTiles.
+
+Usage: python3 mbtiles-report.py [--json REPORT.json] data/*.mbtiles
+
+Prints, per event, the file size, the zoom range and the number and size of the
+tiles of each zoom level (the deepest levels are where the bytes are). With
+--json, also writes the report for comparison between tile profiles.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import sqlite3
+import sys
+from pathlib import Path
+
+MB = 1024 * 1024
+
+
+def report(path: Path) -> dict:
+    connection = sqlite3.connect(f"file:{path}?mode=ro", uri=True)
+    try:
+        metadata = dict(connection.execute("SELECT name, value FROM metadata"))
+        zooms = [
+            {"zoom": zoom, "tiles": count, "bytes": size}
+            for zoom, count, size in connection.execute(
+                "SELECT zoom_level, COUNT(*), SUM(LENGTH(tile_data)) FROM tiles GROUP BY zoom_level ORDER BY zoom_level"
+            )
+        ]
+    finally:
+        connection.close()
+
+    return {
+        "event": path.stem,
+        "file_bytes": path.stat().st_size,
+        "tiles": sum(z["tiles"] for z in zooms),
+        "tile_bytes": sum(z["bytes"] for z in zooms),
+        "minzoom": metadata.get("minzoom"),
+        "maxzoom": metadata.get("maxzoom"),
+        "zooms": zooms,
+    }
+
+
+def print_report(entry: dict) -> None:
+    print(
+        f"{entry['event']:<28} {entry['file_bytes'] / MB:8.1f} MB  {entry['tiles']:8d} tiles"
+        f"  z{entry['minzoom']}-{entry['maxzoom']}"
+    )
+    for zoom in entry["zooms"]:
+        print(f"    z{zoom['zoom']:<3} {zoom['tiles']:8d} tiles {zoom['bytes'] / MB:8.2f} MB")
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("mbtiles", nargs="+", type=Path, help="MBTiles files to report on")
+    parser.add_argument("--json", type=Path, help="also write the report as JSON")
+    args = parser.parse_args()
+
+    entries = []
+    for path in args.mbtiles:
+        if not path.is_file():
+            print(f"Skipping {path}: not found", file=sys.stderr)
+            continue
+        try:
+            entries.append(report(path))
+        except sqlite3.Error as e:
+            print(f"Skipping {path}: {e}", file=sys.stderr)
+
+    for entry in entries:
+        print_report(entry)
+    if entries:
+        total = sum(e["file_bytes"] for e in entries)
+        print(f"{'TOTAL':<28} {total / MB:8.1f} MB  {sum(e['tiles'] for e in entries):8d} tiles  ({len(entries)} events)")
+
+    if args.json:
+        args.json.write_text(json.dumps(entries, indent=2) + "\n")
+        print(f"Report written to {args.json}")
+
+    return 0 if entries else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,165 @@
+/* * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License. */
+
+// Compiles a choreography MIDI file into the binary .wwn note stream read by the app
+// (shared/.../sound/midi/BinaryNoteFormat.kt). Tick-to-time conversion and note pairing follow
+// MidiParser / MidiTrackParser exactly, so both sources yield the same notes. Keep them in sync.
+//
+// Usage: node midi-to-notes.js <input.mid> [output.wwn]   (default: input with .wwn extension)
+//
+// Only Node built-ins are used.
+
+const fs = require('fs');
+
+const MAGIC = 0x4e575757; // "WWWN" little-endian
+const VERSION = 1;
+const HEADER_INTS = 5;
+const NOTE_INTS = 3;
+const DEFAULT_MICROSECONDS_PER_BEAT = 500000; // 120 BPM
+const DEFAULT_TICKS_PER_BEAT = 24; // SMPTE time division is not supported (as MidiHeaderValidator)
+
+function parseMidi(bytes) {
+  let pos = 0;
+  const u8 = () => bytes[pos++];
+  const u16 = () => (u8() << 8) | u8();
+  const u32 = () => ((u8() << 24) | (u8() << 16) | (u8() << 8) | u8()) >>> 0;
+  const str = (n) => String.fromCharCode(...bytes.subarray(pos, (pos += n)));
+  const vlq = () => {
+    let value = 0;
+    let b;
+    do {
+      b = u8();
+      value = value * 128 + (b & 0x7f);
+    } while (b & 0x80);
+    return value;
+  };
+
+  if (str(4) !== 'MThd' || u32() !== 6) throw new Error('Not a valid MIDI file');
+  u16(); // format
+  const numTracks = u16();
+  const division = u16();
+  const ticksPerBeat = division & 0x8000 ? DEFAULT_TICKS_PER_BEAT : division;
+
+  const notes = [];
+  const tempoChanges = [{ tick: 0, mpb: DEFAULT_MICROSECONDS_PER_BEAT }];
+
+  for (let t = 0; t < numTracks; t++) {
+    if (str(4) !== 'MTrk') throw new Error(`Invalid track chunk in track ${t}`);
+    const end = pos + u32();
+    const active = new Map();
+    let tick = 0;
+    let running = 0;
+    const noteOff = (channel, pitch) => {
+      const key = `${channel}:${pitch}`;
+      const start = active.get(key);
+      if (!start) return;
+      active.delete(key);
+      if (tick - start.tick > 0) notes.push({ pitch, velocity: start.velocity, startTick: start.tick, durationTicks: tick - start.tick });
+    };
+
+    while (pos < end) {
+      tick += vlq();
+      let status = u8();
+      if ((status & 0x80) === 0) {
+        pos--; // Running status: re-read as data
+        status = running;
+      } else {
+        running = status;
+      }
+
+      if (status === 0xff) {
+        const type = u8();
+        const length = vlq();
+        if (type === 0x51 && length === 3) {
+          tempoChanges.push({ tick, mpb: (u8() << 16) | (u8() << 8) | u8() });
+        } else {
+          pos += length;
+        }
+      } else if ((status & 0xf0) === 0x90) {
+        const pitch = u8();
+        const velocity = u8();
+        if (velocity > 0) active.set(`${status & 0x0f}:${pitch}`, { tick, velocity });
+        else noteOff(status & 0x0f, pitch);
+      } else if ((status & 0xf0) === 0x80) {
+        const pitch = u8();
+        u8();
+        noteOff(status & 0x0f, pitch);
+      } else if (status & 0x80) {
+        pos += (status & 0xe0) === 0xc0 ? 1 : 2;
+      }
+    }
+  }
+
+  // Stable sort, as Kotlin sortBy
+  tempoChanges.sort((a, b) => a.tick - b.tick);
+
+  // Same walk (and remainder step) as MidiTimeConverter.ticksToRealTime
+  const ticksToSeconds = (ticks) => {
+    let seconds = 0;
+    let lastTick = 0;
+    let lastMpb = tempoChanges[0].mpb;
+    for (let i = 1; i < tempoChanges.length; i++) {
+      const change = tempoChanges[i];
+      if (ticks <= change.tick) {
+        seconds += ((ticks - lastTick) / ticksPerBeat) * (lastMpb / 1e6);
+        break;
+      }
+      seconds += ((change.tick - lastTick) / ticksPerBeat) * (lastMpb / 1e6);
+      lastTick = change.tick;
+      lastMpb = change.mpb;
+    }
+    if (ticks > lastTick) seconds += ((ticks - lastTick) / ticksPerBeat) * (lastMpb / 1e6);
+    return seconds;
+  };
+
+  const lastTick = notes.reduce((max, n) => Math.max(max, n.startTick + n.durationTicks), 0);
+  return {
+    notes: notes.map((n) => ({
+      pitch: n.pitch,
+      velocity: n.velocity,
+      start: ticksToSeconds(n.startTick),
+      end: ticksToSeconds(n.startTick + n.durationTicks),
+    })),
+    totalDuration: ticksToSeconds(lastTick),
+    tempo: Math.trunc(60000000 / tempoChanges[tempoChanges.length - 1].mpb),
+  };
+}
+
+function encode(track) {
+  const us = (seconds) => Math.round(seconds * 1e6);
+  const notes = track.notes.slice().sort((a, b) => a.start - b.start); // Stable
+  const ints = new Int32Array(HEADER_INTS + notes.length * NOTE_INTS);
+  ints.set([MAGIC, VERSION, notes.length, us(track.totalDuration), track.tempo]);
+  notes.forEach((note, i) => {
+    const start = us(note.start);
+    ints.set([start, us(note.end) - start, (note.pitch & 0xff) | ((note.velocity & 0xff) << 8)], HEADER_INTS + i * NOTE_INTS);
+  });
+  const out = Buffer.alloc(ints.length * 4);
+  ints.forEach((value, i) => out.writeInt32LE(value, i * 4));
+  return out;
+}
+
+const [input, output = input.replace(/\.[^.]+$/, '') + '.wwn'] = process.argv.slice(2);
+if (!input) {
+  console.error('Usage: node midi-to-notes.js <input.mid> [output.wwn]');
+  process.exit(1);
+}
+const track = parseMidi(fs.readFileSync(input));
+fs.writeFileSync(output, encode(track));
+console.log(`${output}: ${track.notes.length} notes, ${track.totalDuration.toFixed(3)}s, ${track.tempo} BPM`);
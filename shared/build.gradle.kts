@@ -346,6 +346,42 @@ tasks.register("testQuality") {
     }
 }
 
+/*
+ * Benchmarks (commonTest/iosTest/androidUnitTest `benchmark` package) are excluded from regular
+ * test runs and are the only tests run with -Pbenchmarks. Results are printed as `WWW-BENCH`
+ * JSON lines, collected by scripts/benchmarks/run_benchmarks.sh.
+ *
+ *   ./gradlew :shared:testDebugUnitTest :shared:iosSimulatorArm64Test -Pbenchmarks
+ */
+val runBenchmarks = project.hasProperty("benchmarks")
+val benchmarkTests = "com.worldwidewaves.shared.benchmark.*"
+
+tasks.withType<AbstractTestTask>().configureEach {
+    filter {
+        if (runBenchmarks) {
+            // Most test tasks of a module have no benchmark
+            isFailOnNoMatchingTests = false
+            includeTestsMatching(benchmarkTests)
+        } else {
+            excludeTestsMatching(benchmarkTests)
+        }
+    }
+}
+
+// Benchmarks read city GeoJSON and sound resources relative to the repository root
+tasks.withType<Test>().configureEach {
+    systemProperty("wwwRepoRoot", rootDir.absolutePath)
+    // Crowd simulation size: -PcrowdParticipants=5000 -PcrowdSpeed=10 -PcrowdEvent=london_england
+    listOf("crowdParticipants", "crowdSpeed", "crowdEvent").forEach { name ->
+        project.findProperty(name)?.let { systemProperty("www${name.replaceFirstChar(Char::uppercase)}", it) }
+    }
+}
+
+tasks.withType<org.jetbrains.kotlin.gradle.targets.native.tasks.KotlinNativeTest>().configureEach {
+    environment("WWW_REPO_ROOT", rootDir.absolutePath)
+    environment("SIMCTL_CHILD_WWW_REPO_ROOT", rootDir.absolutePath)
+}
+
 // Custom Gradle task for crowd sound choreography simulation
 
 // Dokka API Documentation Configuration
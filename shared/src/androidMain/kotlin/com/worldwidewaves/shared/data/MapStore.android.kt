@@ -35,6 +35,7 @@ import java.io.BufferedOutputStream
 import java.io.File
 import java.io.FileNotFoundException
 import java.io.FileOutputStream
+import java.io.IOException
 import kotlin.time.Duration.Companion.milliseconds
 
 private const val TAG = "MapStore"
@@ -61,25 +62,21 @@ actual suspend fun platformTryCopyInitialTagToCache(
 ): Boolean {
     val base = ctx()
     val assetName = "$eventId.$extension"
-
-    var finalResult: CopyResult? = null
-
-    repeat(MAX_FILE_COPY_RETRIES) { attempt ->
-        val result = attemptFileCopy(base, eventId, assetName, destAbsolutePath)
-        finalResult = result
-        when (result) {
-            CopyResult.Success, CopyResult.FatalError -> return@repeat
-            CopyResult.Retry ->
-                if (attempt < MAX_FILE_COPY_RETRIES - 1) {
-                    delay(RETRY_DELAY_MS.milliseconds)
-                }
-        }
+    // The binary area is optional in map modules: a missing one is expected, not a pending split install
+    val retryWhenMissing = extension != MapFileExtension.AREA.value
+
+    var result = attemptFileCopy(base, eventId, assetName, destAbsolutePath)
+    var attempt = 1
+    while (attempt < MAX_FILE_COPY_RETRIES && result.shouldRetry(retryWhenMissing)) {
+        delay(RETRY_DELAY_MS.milliseconds)
+        result = attemptFileCopy(base, eventId, assetName, destAbsolutePath)
+        attempt++
     }
 
-    if (finalResult != CopyResult.Success) {
+    if (result != CopyResult.Success) {
         Log.d(TAG, "platformTryCopyInitialTagToCache: not found for $assetName")
     }
-    return finalResult == CopyResult.Success
+    return result == CopyResult.Success
 }
 
 /**
@@ -87,8 +84,14 @@ actual suspend fun platformTryCopyInitialTagToCache(
  */
 private enum class CopyResult {
     Success,
+
+    /** Asset not visible (yet): retried for required files, final for optional ones. */
+    NotFound,
     Retry,
     FatalError,
+    ;
+
+    fun shouldRetry(retryWhenMissing: Boolean): Boolean = this == Retry || (this == NotFound && retryWhenMissing)
 }
 
 /**
@@ -109,7 +112,10 @@ private fun attemptFileCopy(
         Log.d(TAG, "platformTryCopyInitialTagToCache: copied $assetName → $destAbsolutePath")
         CopyResult.Success
     } catch (e: FileNotFoundException) {
-        Log.d(TAG, "platformTryCopyInitialTagToCache: file not found for $assetName, will retry: ${e.message}")
+        Log.d(TAG, "platformTryCopyInitialTagToCache: file not found for $assetName: ${e.message}")
+        CopyResult.NotFound
+    } catch (e: IOException) {
+        Log.d(TAG, "platformTryCopyInitialTagToCache: I/O error for $assetName, will retry: ${e.message}")
         CopyResult.Retry
     } catch (e: Exception) {
         Log.d(TAG, "platformTryCopyInitialTagToCache: error for $assetName: ${e.message}")
@@ -194,6 +200,11 @@ actual suspend fun platformReadText(path: String): String =
         File(path).readText()
     }
 
+actual suspend fun platformReadBytes(path: String): ByteArray =
+    withContext(Dispatchers.IO) {
+        File(path).readBytes()
+    }
+
 actual suspend fun platformWriteText(
     path: String,
     content: String,
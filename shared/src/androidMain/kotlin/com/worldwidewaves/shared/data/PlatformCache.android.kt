@@ -170,6 +170,8 @@ fun clearEventCache(eventId: String) {
             "$eventId.mbtiles.metadata",
             "$eventId.geojson",
             "$eventId.geojson.metadata",
+            "$eventId.wwa",
+            "$eventId.wwa.metadata",
             "style-$eventId.json",
             "style-$eventId.json.metadata",
         )
@@ -177,6 +179,7 @@ fun clearEventCache(eventId: String) {
     targets.forEach { name ->
         deleteCachedFile(cacheDir, name)
     }
+    clearEventAreaCache(eventId, cacheDir.absolutePath)
 }
 
 /**
@@ -35,6 +35,7 @@ import kotlinx.coroutines.sync.withLock
 import kotlinx.coroutines.withContext
 import kotlin.time.Duration
 import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.nanoseconds
 
 /**
  * Android implementation of AudioBuffer
@@ -115,6 +116,10 @@ class AndroidSoundPlayer(
     private val context: Context,
 ) : SoundPlayer,
     VolumeController {
+    companion object {
+        private const val NANOS_PER_SECOND = 1_000_000_000L
+    }
+
     private val sampleRate = 44100 // Hz
     private val activeTracks = mutableListOf<AudioTrack>()
     private val playbackMutex = Mutex()
@@ -145,6 +150,20 @@ class AndroidSoundPlayer(
         amplitude: Double,
         duration: Duration,
         waveform: SoundPlayer.Waveform,
+    ) = play(ToneSpec(frequency, amplitude, duration, waveform), startAtNanos = null)
+
+    /**
+     * Prefixes the tone with silence up to the start time, so the AudioTrack clock (not a
+     * coroutine timer) places its first sample [startDelay] from the call.
+     */
+    override suspend fun scheduleTone(
+        tone: ToneSpec,
+        startDelay: Duration,
+    ) = play(tone, startAtNanos = System.nanoTime() + startDelay.inWholeNanoseconds)
+
+    private suspend fun play(
+        tone: ToneSpec,
+        startAtNanos: Long?,
     ) {
         playbackMutex.withLock {
             withContext(Dispatchers.Main) {
@@ -155,34 +174,39 @@ class AndroidSoundPlayer(
                     // Set to maximum volume
                     setVolume(1.0f)
 
-                    // Wait a moment for volume change to take effect
+                    // Wait a moment for volume change to take effect (absorbed by the silence when scheduled)
                     delay(50.milliseconds)
 
                     // Generate waveform on Default dispatcher (CPU-bound mathematical operations)
-                    withContext(Dispatchers.Default) {
-                        // Generate and play
-                        val samples =
-                            WaveformGenerator.generateWaveform(
-                                sampleRate = sampleRate,
-                                frequency = frequency,
-                                amplitude = amplitude,
-                                duration = duration,
-                                waveform = waveform,
-                            )
-
-                        val buffer =
-                            AudioBufferFactory.createFromSamples(
-                                samples = samples,
-                                sampleRate = sampleRate,
-                                bitsPerSample = WWWGlobals.Audio.DEFAULT_BITS_PER_SAMPLE,
-                                channels = WWWGlobals.Audio.DEFAULT_CHANNELS,
-                            )
-
-                        playBuffer(buffer, duration)
-                    }
+                    val playedDuration =
+                        withContext(Dispatchers.Default) {
+                            // Generate and play
+                            val toneSamples =
+                                WaveformGenerator.generateFloatWaveform(
+                                    sampleRate = sampleRate,
+                                    frequency = tone.frequency,
+                                    amplitude = tone.amplitude,
+                                    duration = tone.duration,
+                                    waveform = tone.waveform,
+                                )
+
+                            // Measured last, right before the track is written and started
+                            val silenceFrames =
+                                startAtNanos?.let { ((it - System.nanoTime()) * sampleRate / NANOS_PER_SECOND).toInt() } ?: 0
+                            val samples =
+                                if (silenceFrames > 0) {
+                                    FloatArray(silenceFrames + toneSamples.size).also { toneSamples.copyInto(it, silenceFrames) }
+                                } else {
+                                    toneSamples
+                                }
+
+                            val bufferDuration = (samples.size * NANOS_PER_SECOND / sampleRate).nanoseconds
+                            playBuffer(samples, bufferDuration)
+                            bufferDuration
+                        }
 
                     // Wait for playback to complete
-                    delay(duration + 100.milliseconds)
+                    delay(playedDuration + 100.milliseconds)
                 } finally {
                     // Always restore original volume
                     setVolume(originalVolume)
@@ -191,12 +215,13 @@ class AndroidSoundPlayer(
         }
     }
 
+    // Float PCM straight from the generator: no 16-bit conversion pass
     private suspend fun playBuffer(
-        buffer: AudioBuffer,
+        samples: FloatArray,
         duration: Duration,
     ) = withContext(Dispatchers.Default) {
         // Audio processing and playback, not I/O
-        val bufferSizeInBytes = buffer.getRawBuffer().size
+        val bufferSizeInBytes = samples.size * Float.SIZE_BYTES
 
         val builder =
             AudioTrack
@@ -210,8 +235,8 @@ class AndroidSoundPlayer(
                 ).setAudioFormat(
                     AudioFormat
                         .Builder()
-                        .setEncoding(AudioFormat.ENCODING_PCM_16BIT)
-                        .setSampleRate(buffer.sampleRate)
+                        .setEncoding(AudioFormat.ENCODING_PCM_FLOAT)
+                        .setSampleRate(sampleRate)
                         .setChannelMask(AudioFormat.CHANNEL_OUT_MONO)
                         .build(),
                 ).setBufferSizeInBytes(bufferSizeInBytes)
@@ -229,7 +254,7 @@ class AndroidSoundPlayer(
         }
 
         try {
-            audioTrack.write(buffer.getRawBuffer(), 0, bufferSizeInBytes)
+            audioTrack.write(samples, 0, samples.size, AudioTrack.WRITE_BLOCKING)
             audioTrack.play()
 
             // Wait for completion
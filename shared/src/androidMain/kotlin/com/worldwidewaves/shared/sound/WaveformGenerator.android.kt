@@ -0,0 +1,33 @@
+package com.worldwidewaves.shared.sound
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Android SINE kernel: the shared wavetable loop (a table read and a multiply-add per sample,
+ * no libm call), which ART compiles to tight code.
+ */
+internal actual fun fillSine(
+    output: FloatArray,
+    phase: Double,
+    phaseIncrement: Double,
+    amplitude: Float,
+) = WaveformGenerator.fillSineWavetable(output, phase, phaseIncrement, amplitude)
@@ -0,0 +1,61 @@
+@file:Suppress("MatchingDeclarationName") // expect/actual pattern requires .android.kt suffix
+
+package com.worldwidewaves.shared.utils
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import android.os.Build
+import android.os.Trace
+
+/**
+ * Android render chain sections: async `android.os.Trace` sections, visible in Perfetto
+ * (`atrace` category `app`). Async sections need API 29; older devices report nothing to the
+ * profiler but still feed the in-app aggregate.
+ */
+@PublishedApi
+internal actual object PlatformTraceSection {
+    private const val MAX_SECTION_NAME_LENGTH = 127 // Trace section name limit
+
+    actual val isRecording: Boolean
+        get() = Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q && Trace.isEnabled()
+
+    actual fun begin(
+        stage: RenderStage,
+        detail: String,
+        cookie: Int,
+    ) {
+        if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q) Trace.beginAsyncSection(sectionName(stage, detail), cookie)
+    }
+
+    actual fun end(
+        stage: RenderStage,
+        detail: String,
+        cookie: Int,
+    ) {
+        if (Build.VERSION.SDK_INT >= Build.VERSION_CODES.Q) Trace.endAsyncSection(sectionName(stage, detail), cookie)
+    }
+
+    private fun sectionName(
+        stage: RenderStage,
+        detail: String,
+    ): String = "www.${stage.traceName} $detail".take(MAX_SECTION_NAME_LENGTH)
+}
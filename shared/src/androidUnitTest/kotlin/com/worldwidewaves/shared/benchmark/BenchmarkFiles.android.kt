@@ -0,0 +1,34 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import java.io.File
+
+actual object BenchmarkFiles {
+    actual val platform: String = "jvm"
+
+    actual fun readBytes(relativePath: String): ByteArray? {
+        // Unit tests run from the shared/ module directory
+        val root = System.getProperty("wwwRepoRoot")?.let(::File) ?: File("..")
+        return File(root, relativePath).takeIf { it.isFile }?.readBytes()
+    }
+}
@@ -0,0 +1,356 @@
+package com.worldwidewaves.shared.benchmark
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.WWWSimulation
+import com.worldwidewaves.shared.choreographies.SoundChoreographyPlayer
+import com.worldwidewaves.shared.domain.progression.DefaultWaveProgressionTracker
+import com.worldwidewaves.shared.domain.scheduling.DefaultObservationScheduler
+import com.worldwidewaves.shared.domain.scheduling.ObservationEngine
+import com.worldwidewaves.shared.domain.state.DefaultEventStateHolder
+import com.worldwidewaves.shared.domain.state.EventStateInput
+import com.worldwidewaves.shared.events.IWWWEvent
+import com.worldwidewaves.shared.events.WWWEvent
+import com.worldwidewaves.shared.events.WWWEventArea
+import com.worldwidewaves.shared.events.WWWEventWave
+import com.worldwidewaves.shared.events.WWWEventWaveLinear
+import com.worldwidewaves.shared.events.WWWEventWaveWarming
+import com.worldwidewaves.shared.events.utils.GeoUtils.calculateDistance
+import com.worldwidewaves.shared.events.utils.IClock
+import com.worldwidewaves.shared.events.utils.Position
+import com.worldwidewaves.shared.sound.MidiTrack
+import com.worldwidewaves.shared.sound.SoundChoreographyCoordinator
+import kotlinx.coroutines.asCoroutineDispatcher
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.flow.takeWhile
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.runBlocking
+import kotlinx.coroutines.withTimeoutOrNull
+import java.lang.management.ManagementFactory
+import java.util.concurrent.Executors
+import kotlin.coroutines.cancellation.CancellationException
+import kotlin.math.ceil
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.ZERO
+import kotlin.time.Duration.Companion.minutes
+import kotlin.time.Duration.Companion.seconds
+import kotlin.time.DurationUnit
+import kotlin.time.Instant
+import kotlin.time.TimeSource
+
+/**
+ * [IClock] on a [WWWSimulation] timeline, as SystemClock runs in simulation mode, minus its
+ * 50ms real-time delay floor: at crowd speeds that floor would be seconds of simulated time and
+ * swamp the 50ms ticks of the hit-critical phase.
+ */
+class SimulationClock(
+    private val simulation: WWWSimulation,
+) : IClock {
+    val speed: Int get() = simulation.speed
+
+    override fun now(): Instant = runBlocking { simulation.now() }
+
+    override suspend fun delay(duration: Duration) = kotlinx.coroutines.delay(duration / simulation.speed)
+
+    /** Restarts the timeline from the simulation start (after the setup work). */
+    suspend fun restart() = simulation.reset()
+}
+
+/**
+ * Headless crowd run of the shared wave stack against a real event: [Config.participants]
+ * virtual devices spread over the event area with [WWWEventArea.generateRandomPositionInArea],
+ * run on a fixed thread pool against one speed-scaled [SimulationClock].
+ *
+ * Each participant runs what WWWEventObserver and SoundChoreographyCoordinator run on a device,
+ * with its own instances: wave copy (hit caches), observation scheduler and
+ * engine, state holder and [SoundChoreographyPlayer]. The tone is queued
+ * [SoundChoreographyCoordinator.SCHEDULE_LEAD] before the predicted hit, or played on detection
+ * when no prediction came in time. The observer facade itself is not used: it binds to the
+ * single Koin PositionManager, i.e. one user. The event area (polygons, bbox) is shared
+ * read-only data.
+ *
+ * Measured, against the exact arrival of the front (linear waves only):
+ * - hit detection error: detection instant minus exact arrival (simulated time)
+ * - tone start error: queued or played start minus exact arrival
+ * - CPU time and allocated bytes per participant (JVM thread counters around each tick; ticks
+ *   that resumed on another thread are not counted)
+ *
+ * Needs Koin with [clock] as [IClock], a WWWPlatform without simulation (positions come from
+ * the participants' position requesters), a GeoJsonDataProvider and a SoundPlayer.
+ */
+class CrowdSimulation(
+    private val event: WWWEvent,
+    private val clock: SimulationClock,
+    private val track: MidiTrack?,
+    private val config: Config = Config(),
+) {
+    data class Config(
+        val participants: Int = 1_000,
+        val threads: Int = Runtime.getRuntime().availableProcessors(),
+        /** Real-time limit: participants not hit by then count as missed. */
+        val timeout: Duration = 30.minutes,
+    )
+
+    private val linearWave: WWWEventWaveLinear =
+        requireNotNull(event.wavedef.linear) { "${event.id}: crowd simulation needs a linear wave (exact arrival reference)" }
+
+    private val threadBean = ManagementFactory.getThreadMXBean() as com.sun.management.ThreadMXBean
+
+    suspend fun run(): CrowdReport {
+        val waveStart = event.getWaveStartDateTime()
+        val bbox = event.area.bbox()
+
+        // Setup (polygon load, spawn, arrival reference) happens before the timeline restarts
+        var outsideArea = 0
+        val participants =
+            (0 until config.participants).mapNotNull { id ->
+                val position = event.area.generateRandomPositionInArea()
+                if (!event.area.isPositionWithin(position)) {
+                    outsideArea++ // Generator fell back to an area center outside the area
+                    return@mapNotNull null
+                }
+                val edgeLongitude =
+                    if (linearWave.direction == WWWEventWave.Direction.EAST) bbox.minLongitude else bbox.maxLongitude
+                val exactHit = waveStart + (calculateDistance(edgeLongitude, position.lng, position.lat) / linearWave.speed).seconds
+                Participant(id, position, exactHit)
+            }
+
+        clock.restart()
+        val simulatedStart = clock.now()
+        val wallTime = TimeSource.Monotonic.markNow()
+        val dispatcher = Executors.newFixedThreadPool(config.threads).asCoroutineDispatcher()
+        try {
+            withTimeoutOrNull(config.timeout) {
+                coroutineScope {
+                    participants.forEach { participant -> launch(dispatcher) { participant.run() } }
+                }
+            }
+        } finally {
+            dispatcher.close()
+        }
+        val simulatedEnd = clock.now()
+        val elapsed = wallTime.elapsedNow()
+
+        val allocated = participants.sumOf { it.allocatedBytes }
+        return CrowdReport(
+            eventId = event.id,
+            participants = config.participants,
+            threads = config.threads,
+            speed = clock.speed,
+            outsideArea = outsideArea,
+            hits = participants.count { it.detectedAt != null },
+            missed = participants.count { it.detectedAt == null && !it.failed },
+            failed = participants.count { it.failed },
+            scheduledTones = participants.count { it.toneScheduled },
+            fallbackTones = participants.count { it.toneAt != null && !it.toneScheduled },
+            detectionErrorMillis = Distribution.of(participants.mapNotNull { it.errorMillis(it.detectedAt) }),
+            toneErrorMillis = Distribution.of(participants.mapNotNull { it.errorMillis(it.toneAt) }),
+            cpuMicrosPerParticipant = Distribution.of(participants.map { it.cpuNanos / NANOS_PER_MICRO }),
+            cpuNanosSamples = participants.map { it.cpuNanos },
+            allocatedBytesPerParticipant = Distribution.of(participants.map { it.allocatedBytes.toDouble() }),
+            ticksPerParticipant = Distribution.of(participants.map { it.ticks.toDouble() }),
+            unmeasuredTicks = participants.sumOf { it.unmeasuredTicks },
+            allocationBytesPerSecond = allocated / elapsed.toDouble(DurationUnit.SECONDS).coerceAtLeast(MIN_WALL_SECONDS),
+            wallTime = elapsed,
+            simulatedTime = simulatedEnd - simulatedStart,
+        )
+    }
+
+    // ---------------------------
+
+    /** One virtual device. Its fields are only touched by its own coroutine until [run] returns. */
+    private inner class Participant(
+        val id: Int,
+        val position: Position,
+        val exactHit: Instant,
+    ) {
+        private val wave = linearWave.copy()
+        private val participantEvent = ParticipantEvent(event, wave)
+        private val progressionTracker = DefaultWaveProgressionTracker(clock)
+        private val scheduler = DefaultObservationScheduler(clock, ObservationEngine(clock))
+        private val stateHolder = DefaultEventStateHolder(progressionTracker)
+        private val player = SoundChoreographyPlayer().apply { track?.let { setCurrentTrack(it) } }
+
+        var detectedAt: Instant? = null
+        var toneAt: Instant? = null
+        var toneScheduled = false
+        var failed = false
+        var ticks = 0
+        var unmeasuredTicks = 0
+        var cpuNanos = 0L
+        var allocatedBytes = 0L
+
+        fun errorMillis(instant: Instant?): Double? = instant?.let { (it - exactHit).toDouble(DurationUnit.MILLISECONDS) }
+
+        init {
+            wave.setRelatedEvent<WWWEventWaveLinear>(participantEvent)
+            wave.setPositionRequester { position }
+        }
+
+        suspend fun run() {
+            try {
+                scheduler
+                    .createObservationFlow(participantEvent)
+                    .takeWhile { detectedAt == null }
+                    .collect { measuredTick() }
+            } catch (e: CancellationException) {
+                throw e
+            } catch (e: Exception) {
+                println("Participant $id failed: $e")
+                failed = true
+            }
+        }
+
+        private suspend fun measuredTick() {
+            val thread = Thread.currentThread()
+            val cpuStart = threadBean.currentThreadCpuTime
+            val allocationStart = threadBean.getThreadAllocatedBytes(thread.id)
+            tick()
+            ticks++
+            if (Thread.currentThread() === thread) {
+                cpuNanos += threadBean.currentThreadCpuTime - cpuStart
+                allocatedBytes += threadBean.getThreadAllocatedBytes(thread.id) - allocationStart
+            } else {
+                unmeasuredTicks++
+            }
+        }
+
+        private suspend fun tick() {
+            val now = clock.now()
+            val input =
+                EventStateInput(
+                    progression = progressionTracker.calculateProgression(participantEvent),
+                    status = participantEvent.getStatus(),
+                    userPosition = position,
+                    currentTime = now,
+                )
+            val state = stateHolder.calculateEventState(participantEvent, input, userIsInArea = true)
+
+            // Same decisions as SoundChoreographyCoordinator: queue ahead, else play on detection
+            val isHitImminent = state.timeBeforeHit > ZERO && state.timeBeforeHit <= SoundChoreographyCoordinator.SCHEDULE_LEAD
+            if (toneAt == null && isHitImminent && !state.userHasBeenHit) {
+                player.scheduleSoundTone(participantEvent.getStartDateTime(), state.hitDateTime)
+                toneAt = maxOf(state.hitDateTime, clock.now())
+                toneScheduled = true
+            }
+            if (state.userHasBeenHit) {
+                detectedAt = now
+                if (toneAt == null) {
+                    player.playCurrentSoundTone(participantEvent.getStartDateTime())
+                    toneAt = clock.now()
+                }
+            }
+        }
+    }
+
+    /** The event as seen by one participant: its own wave (and warming on top of it). */
+    private class ParticipantEvent(
+        base: IWWWEvent,
+        override val wave: WWWEventWave,
+    ) : IWWWEvent by base {
+        override val warming = WWWEventWaveWarming(this)
+    }
+
+    private companion object {
+        const val NANOS_PER_MICRO = 1_000.0
+        const val MIN_WALL_SECONDS = 0.001
+    }
+}
+
+/** Percentiles of one crowd measurement. */
+data class Distribution(
+    val count: Int,
+    val min: Double,
+    val p50: Double,
+    val p95: Double,
+    val p99: Double,
+    val max: Double,
+    val mean: Double,
+) {
+    override fun toString(): String =
+        if (count == 0) {
+            "n=0"
+        } else {
+            "n=$count min=${min.fmt()} p50=${p50.fmt()} p95=${p95.fmt()} p99=${p99.fmt()} max=${max.fmt()} mean=${mean.fmt()}"
+        }
+
+    private fun Double.fmt(): String = "%.1f".format(this)
+
+    companion object {
+        fun of(values: List<Double>): Distribution {
+            if (values.isEmpty()) return Distribution(0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0)
+            val sorted = values.sorted()
+            fun percentile(p: Double) = sorted[(ceil(p * sorted.size).toInt() - 1).coerceIn(0, sorted.size - 1)]
+            return Distribution(
+                count = sorted.size,
+                min = sorted.first(),
+                p50 = percentile(0.50),
+                p95 = percentile(0.95),
+                p99 = percentile(0.99),
+                max = sorted.last(),
+                mean = sorted.average(),
+            )
+        }
+    }
+}
+
+data class CrowdReport(
+    val eventId: String,
+    val participants: Int,
+    val threads: Int,
+    val speed: Int,
+    val outsideArea: Int,
+    val hits: Int,
+    val missed: Int,
+    val failed: Int,
+    val scheduledTones: Int,
+    val fallbackTones: Int,
+    val detectionErrorMillis: Distribution,
+    val toneErrorMillis: Distribution,
+    val cpuMicrosPerParticipant: Distribution,
+    val cpuNanosSamples: List<Long>,
+    val allocatedBytesPerParticipant: Distribution,
+    val ticksPerParticipant: Distribution,
+    val unmeasuredTicks: Int,
+    val allocationBytesPerSecond: Double,
+    val wallTime: Duration,
+    val simulatedTime: Duration,
+) {
+    fun summary(): String =
+        """
+        |Crowd simulation $eventId: $participants participants, $threads threads, speed x$speed
+        |  wall $wallTime, simulated $simulatedTime
+        |  hits $hits, missed $missed, failed $failed, outside area $outsideArea
+        |  tones: $scheduledTones queued ahead, $fallbackTones played on detection
+        |  hit detection error (ms): $detectionErrorMillis
+        |  tone start error (ms):    $toneErrorMillis
+        |  CPU per participant (µs): $cpuMicrosPerParticipant
+        |  allocated per participant (bytes): $allocatedBytesPerParticipant
+        |  ticks per participant: $ticksPerParticipant ($unmeasuredTicks unmeasured)
+        |  allocation rate: ${"%.1f".format(allocationBytesPerSecond / BYTES_PER_MB)} MB/s
+        """.trimMargin()
+
+    private companion object {
+        const val BYTES_PER_MB = 1024.0 * 1024.0
+    }
+}
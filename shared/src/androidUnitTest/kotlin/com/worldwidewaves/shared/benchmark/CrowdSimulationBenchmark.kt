@@ -0,0 +1,153 @@
+package com.worldwidewaves.shared.benchmark
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.WWWPlatform
+import com.worldwidewaves.shared.WWWSimulation
+import com.worldwidewaves.shared.events.WWWEvent
+import com.worldwidewaves.shared.events.data.GeoJsonDataProvider
+import com.worldwidewaves.shared.events.decoding.DefaultEventsDecoder
+import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
+import com.worldwidewaves.shared.events.utils.DefaultCoroutineScopeProvider
+import com.worldwidewaves.shared.events.utils.IClock
+import com.worldwidewaves.shared.events.utils.Position
+import com.worldwidewaves.shared.sound.MidiParser
+import com.worldwidewaves.shared.sound.SoundPlayer
+import com.worldwidewaves.shared.sound.ToneSpec
+import kotlinx.coroutines.runBlocking
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonObject
+import kotlinx.serialization.json.jsonObject
+import org.koin.core.context.startKoin
+import org.koin.core.context.stopKoin
+import org.koin.dsl.module
+import java.util.concurrent.atomic.AtomicInteger
+import kotlin.test.AfterTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Crowd-scale run of [CrowdSimulation] on a real event from events.json.
+ *
+ * Defaults keep the run to a couple of minutes; scale it up before a global event with
+ * `-PcrowdParticipants=5000 -PcrowdSpeed=10 -PcrowdEvent=london_england`.
+ * Reports CPU per participant and the hit detection error as benchmark lines.
+ */
+class CrowdSimulationBenchmark {
+    private val participants = System.getProperty("wwwCrowdParticipants")?.toIntOrNull() ?: 300
+    private val speed = System.getProperty("wwwCrowdSpeed")?.toIntOrNull() ?: 20
+    private val eventId = System.getProperty("wwwCrowdEvent") ?: "paris_france"
+
+    private val soundPlayer = CountingSoundPlayer()
+
+    @AfterTest
+    fun tearDown() {
+        stopKoin()
+    }
+
+    @Test
+    fun crowdWave() =
+        runBlocking {
+            val eventsJson = BenchmarkFiles.readText(EVENTS_PATH)
+            val geoJson = BenchmarkFiles.readText("maps/$eventId/src/main/assets/$eventId.geojson")
+            if (eventsJson == null || geoJson == null) {
+                println("Skipping crowd simulation: events.json or $eventId GeoJSON not available")
+                return@runBlocking
+            }
+
+            val event = DefaultEventsDecoder().decodeFromJson(eventsJson).first { it.id == eventId } as WWWEvent
+            // The simulated user position is unused: participants have their own positions
+            val simulation = WWWSimulation(event.getStartDateTime() - OBSERVATION_LEAD, Position(0.0, 0.0), speed)
+            val clock = SimulationClock(simulation)
+            startKoin {
+                modules(
+                    module {
+                        single<IClock> { clock }
+                        single { WWWPlatform("Crowd") } // No simulation: participants have their own positions
+                        single<GeoJsonDataProvider> { FileGeoJsonDataProvider(eventId, geoJson) }
+                        single<CoroutineScopeProvider> { DefaultCoroutineScopeProvider() }
+                        single<SoundPlayer> { soundPlayer }
+                    },
+                )
+            }
+
+            val track = BenchmarkFiles.readBytes(BenchmarkFixtures.MIDI_PATH)?.let { MidiParser.parseMidiBytes(it) }
+            val report = CrowdSimulation(event, clock, track, CrowdSimulation.Config(participants = participants)).run()
+            println(report.summary())
+            println("Sound player: ${soundPlayer.scheduled.get()} tones scheduled, ${soundPlayer.played.get()} played")
+
+            BenchmarkRunner.report("crowd.cpuPerParticipant.$eventId", report.cpuNanosSamples.toLongArray())
+
+            assertEquals(0, report.failed, "Participants failed")
+            assertTrue(report.hits > 0, "No participant was hit")
+            assertEquals(participants - report.outsideArea, report.hits + report.missed + report.failed)
+        }
+
+    /** Serves the one event GeoJSON of the run. */
+    private class FileGeoJsonDataProvider(
+        private val eventId: String,
+        geoJson: String,
+    ) : GeoJsonDataProvider {
+        private val data: JsonObject = Json.parseToJsonElement(geoJson).jsonObject
+
+        override suspend fun getGeoJsonData(eventId: String): JsonObject? = data.takeIf { eventId == this.eventId }
+
+        override fun invalidateCache(eventId: String) = Unit
+
+        override fun clearCache() = Unit
+    }
+
+    /** Counts tones; scheduled tones return at once instead of waiting for their (unscaled) start. */
+    private class CountingSoundPlayer : SoundPlayer {
+        val scheduled = AtomicInteger()
+        val played = AtomicInteger()
+
+        override suspend fun playTone(
+            frequency: Double,
+            amplitude: Double,
+            duration: Duration,
+            waveform: SoundPlayer.Waveform,
+        ) {
+            played.incrementAndGet()
+        }
+
+        override suspend fun scheduleTone(
+            tone: ToneSpec,
+            startDelay: Duration,
+        ) {
+            scheduled.incrementAndGet()
+        }
+
+        override fun release() = Unit
+    }
+
+    private companion object {
+        const val EVENTS_PATH = "shared/src/commonMain/composeResources/files/events.json"
+
+        /** Timeline starts inside the near-time window, so observation is continuous from the start. */
+        val OBSERVATION_LEAD = 10.seconds
+    }
+}
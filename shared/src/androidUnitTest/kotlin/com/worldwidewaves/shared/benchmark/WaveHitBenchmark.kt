@@ -0,0 +1,117 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.WWWPlatform
+import com.worldwidewaves.shared.events.IWWWEvent
+import com.worldwidewaves.shared.events.WWWEventArea
+import com.worldwidewaves.shared.events.WWWEventWave
+import com.worldwidewaves.shared.events.WWWEventWaveLinear
+import com.worldwidewaves.shared.events.geometry.PolygonOperations
+import com.worldwidewaves.shared.events.utils.IClock
+import com.worldwidewaves.shared.events.utils.Position
+import io.mockk.coEvery
+import io.mockk.every
+import io.mockk.mockk
+import kotlinx.coroutines.test.runTest
+import org.koin.core.context.startKoin
+import org.koin.core.context.stopKoin
+import org.koin.dsl.module
+import kotlin.test.AfterTest
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.minutes
+import kotlin.time.Instant
+
+/**
+ * [WWWEventWaveLinear.userHitDateTime] over the Paris bbox (JVM only: the event is a MockK mock).
+ *
+ * The area test is mocked to "inside" since GeometryBenchmark measures it on its own, so this
+ * covers the hit-time model (exact distance computation) plus the mock call overhead.
+ */
+class WaveHitBenchmark {
+    private val waveStart = Instant.parse("2025-01-01T12:00:00Z")
+
+    private val clock =
+        object : IClock {
+            override fun now(): Instant = waveStart
+
+            override suspend fun delay(duration: Duration) = Unit
+        }
+
+    @BeforeTest
+    fun setUp() {
+        startKoin {
+            modules(
+                module {
+                    single<IClock> { clock }
+                    single { WWWPlatform("Benchmark") } // No simulation: the position requester is used
+                },
+            )
+        }
+    }
+
+    @AfterTest
+    fun tearDown() {
+        stopKoin()
+    }
+
+    @Test
+    fun userHitDateTime() =
+        runTest(timeout = 10.minutes) {
+            val area = BenchmarkFixtures.cityArea("paris_france")
+            if (area.isNullOrEmpty()) {
+                println("Skipping userHitDateTime: paris_france GeoJSON not available")
+                return@runTest
+            }
+            val bbox = PolygonOperations.polygonsBbox(area)
+            val probes = BenchmarkFixtures.probePositions(area, PROBES)
+
+            val eventArea = mockk<WWWEventArea>()
+            coEvery { eventArea.bbox() } returns bbox
+            coEvery { eventArea.isPositionWithin(any<Position>()) } returns true
+            val event = mockk<IWWWEvent>()
+            every { event.area } returns eventArea
+            every { event.getWaveStartDateTime() } returns waveStart
+
+            val wave = WWWEventWaveLinear(speed = 5.0, direction = WWWEventWave.Direction.EAST, approxDuration = 60)
+            wave.setRelatedEvent<WWWEventWaveLinear>(event)
+
+            var probe = 0
+            wave.setPositionRequester { probes[probe] }
+            BenchmarkRunner.measure("userHitDateTime.moving.paris_france", operationsPerIteration = PROBES) { index ->
+                probe = index
+                wave.userHitDateTime()
+            }
+
+            // Same position every time: served by the per-position hit cache
+            probe = 0
+            BenchmarkRunner.measure("userHitDateTime.stationary.paris_france", operationsPerIteration = PROBES) {
+                wave.userHitDateTime()
+            }
+        }
+
+    private companion object {
+        const val PROBES = 1_000
+    }
+}
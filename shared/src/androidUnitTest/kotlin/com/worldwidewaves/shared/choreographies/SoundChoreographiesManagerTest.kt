@@ -671,4 +671,32 @@ class SoundChoreographyManagerTest : KoinTest {
             result = manager.playCurrentSoundTone(waveStartTime)
             assertNotNull(result, "Should resume playing with looping re-enabled")
         }
+
+    @Test
+    fun `test scheduleSoundTone picks the note active at the hit time and delays until then`() =
+        runTest {
+            val testTrack =
+                MidiTrack(
+                    name = "Test Track",
+                    notes =
+                        listOf(
+                            MidiNote(60, 80, 0.milliseconds, 300.milliseconds),
+                            MidiNote(72, 80, 1000.milliseconds, 300.milliseconds),
+                        ),
+                    totalDuration = 2000.milliseconds,
+                )
+            manager.setCurrentTrack(testTrack)
+            every { clock.now() } returns Instant.fromEpochMilliseconds(200)
+
+            // Only the second note is active at the hit time
+            val result =
+                manager.scheduleSoundTone(
+                    waveStartTime = Instant.fromEpochMilliseconds(0),
+                    startTime = Instant.fromEpochMilliseconds(1100),
+                )
+
+            assertEquals(72, result)
+            coVerify { soundPlayer.scheduleTone(match { it.duration == 300.milliseconds }, 900.milliseconds) }
+            coVerify(exactly = 0) { soundPlayer.playTone(any(), any(), any(), any()) }
+        }
 }
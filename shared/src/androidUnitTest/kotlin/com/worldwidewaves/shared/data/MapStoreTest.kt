@@ -40,6 +40,7 @@ import org.koin.core.context.stopKoin
 import org.koin.dsl.module
 import java.io.File
 import java.io.FileNotFoundException
+import java.io.IOException
 import kotlin.test.AfterTest
 import kotlin.test.BeforeTest
 import kotlin.test.Test
@@ -174,6 +175,51 @@ class MapStoreTest {
             assertEquals(3, attemptCount, "Should attempt exactly MAX_FILE_COPY_RETRIES (3) times")
         }
 
+    @Test
+    fun `platformTryCopyInitialTagToCache does not retry a missing optional binary area`() =
+        testScope.runTest {
+            // Given: Map module without preprocessed .wwa (expected, not a pending split install)
+            val eventId = "test_event"
+            val extension = MapFileExtension.AREA.value
+            val destPath = "${testCacheDir.absolutePath}/$eventId.$extension"
+            var attemptCount = 0
+            every { mockContext.assets.open(any()) } answers {
+                attemptCount++
+                throw FileNotFoundException("Asset not found")
+            }
+            val startTime = currentTime
+
+            // When: Try to copy
+            val result = platformTryCopyInitialTagToCache(eventId, extension, destPath)
+
+            // Then: One attempt, no retry delay
+            assertFalse(result)
+            assertEquals(1, attemptCount, "A missing optional asset should not be retried")
+            assertEquals(0L, currentTime - startTime)
+        }
+
+    @Test
+    fun `platformTryCopyInitialTagToCache retries I O errors of the binary area`() =
+        testScope.runTest {
+            // Given: Asset present but the first read fails
+            val eventId = "test_event"
+            val extension = MapFileExtension.AREA.value
+            val destPath = "${testCacheDir.absolutePath}/$eventId.$extension"
+            var attemptCount = 0
+            every { mockContext.assets.open(any()) } answers {
+                attemptCount++
+                if (attemptCount == 1) throw IOException("Transient read error")
+                "area".byteInputStream()
+            }
+
+            // When: Try to copy
+            val result = platformTryCopyInitialTagToCache(eventId, extension, destPath)
+
+            // Then: Retried once and copied
+            assertTrue(result)
+            assertEquals(2, attemptCount)
+        }
+
     @Test
     fun `platformTryCopyInitialTagToCache advances virtual time correctly`() =
         testScope.runTest {
@@ -116,6 +116,7 @@ class WWWEventWaveLinearTest : KoinTest {
             )
         waveLinear.setRelatedEvent<WWWEventWaveLinear>(mockEvent)
 
+        every { mockEvent.id } returns "test-event"
         every { mockEvent.area } returns mockArea
         coEvery { mockEvent.isRunning() } returns true
         coEvery { mockEvent.isDone() } returns false
@@ -33,6 +33,7 @@ import io.mockk.coEvery
 import io.mockk.every
 import io.mockk.mockk
 import io.mockk.spyk
+import io.mockk.verify
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.ExperimentalCoroutinesApi
 import kotlinx.coroutines.test.StandardTestDispatcher
@@ -495,6 +496,96 @@ class WWWEventsTest : KoinTest {
             assertTrue(validationErrors.second.contains(validationError2))
         }
 
+    @Test
+    fun `reloadEvents should only decode changed events and keep unchanged instances`() =
+        runTest {
+            // GIVEN
+            val events: WWWEvents by inject()
+            val eventsConfigurationProvider: EventsConfigurationProvider by inject()
+            val eventsDecoder: EventsDecoder by inject()
+            val initFavoriteEvent: InitFavoriteEvent by inject()
+            coEvery { initFavoriteEvent.call(any()) } returns Unit
+
+            fun event(eventId: String) = mockk<IWWWEvent>(relaxed = true) { every { id } returns eventId }
+            val paris = event("paris")
+            val tokyo = event("tokyo")
+            val updatedTokyo = event("tokyo")
+            val rome = event("rome")
+
+            val initialConfiguration = """[{"id":"paris","speed":5},{"id":"tokyo","speed":6}]"""
+            val updatedConfiguration = """[{"id":"paris","speed":5},{"id":"tokyo","speed":7},{"id":"rome","speed":5}]"""
+            coEvery { eventsConfigurationProvider.geoEventsConfiguration() } returns initialConfiguration
+            every { eventsDecoder.decodeFromJson(initialConfiguration) } returns listOf(paris, tokyo)
+            every {
+                eventsDecoder.decodeFromJson("""[{"id":"tokyo","speed":7},{"id":"rome","speed":5}]""")
+            } returns listOf(updatedTokyo, rome)
+
+            events.loadEvents()
+            testScheduler.advanceUntilIdle()
+
+            // WHEN
+            coEvery { eventsConfigurationProvider.geoEventsConfiguration() } returns updatedConfiguration
+            events.reloadEvents()
+            testScheduler.advanceUntilIdle()
+
+            // THEN
+            assertEquals(listOf(paris, updatedTokyo, rome), events.list())
+            verify(exactly = 0) { eventsDecoder.decodeFromJson(updatedConfiguration) }
+            verify(exactly = 1) { tokyo.observer.stopObservation() }
+            verify(exactly = 0) { paris.observer.stopObservation() }
+        }
+
+    @Test
+    fun `reloadEvents should replace the validation errors of modified events`() =
+        runTest {
+            // GIVEN
+            val events: WWWEvents by inject()
+            val eventsConfigurationProvider: EventsConfigurationProvider by inject()
+            val eventsDecoder: EventsDecoder by inject()
+            val initFavoriteEvent: InitFavoriteEvent by inject()
+            coEvery { initFavoriteEvent.call(any()) } returns Unit
+
+            fun event(
+                eventId: String,
+                errors: List<String>?,
+            ) = mockk<IWWWEvent>(relaxed = true) {
+                every { id } returns eventId
+                every { validationErrors() } returns errors
+            }
+            val paris = event("paris", null)
+            val tokyo = event("tokyo", listOf("bad speed"))
+            val updatedTokyo = event("tokyo", listOf("bad speed"))
+            val fixedTokyo = event("tokyo", null)
+
+            val initialConfiguration = """[{"id":"paris","speed":5},{"id":"tokyo","speed":0}]"""
+            val updatedConfiguration = """[{"id":"paris","speed":5},{"id":"tokyo","speed":-1}]"""
+            val fixedConfiguration = """[{"id":"paris","speed":5},{"id":"tokyo","speed":6}]"""
+            coEvery { eventsConfigurationProvider.geoEventsConfiguration() } returns initialConfiguration
+            every { eventsDecoder.decodeFromJson(initialConfiguration) } returns listOf(paris, tokyo)
+            every { eventsDecoder.decodeFromJson("""[{"id":"tokyo","speed":-1}]""") } returns listOf(updatedTokyo)
+            every { eventsDecoder.decodeFromJson("""[{"id":"tokyo","speed":6}]""") } returns listOf(fixedTokyo)
+
+            events.loadEvents()
+            testScheduler.advanceUntilIdle()
+
+            // WHEN
+            coEvery { eventsConfigurationProvider.geoEventsConfiguration() } returns updatedConfiguration
+            events.reloadEvents()
+            testScheduler.advanceUntilIdle()
+
+            // THEN
+            assertEquals(listOf(updatedTokyo), events.getValidationErrors().map { it.first })
+
+            // WHEN
+            coEvery { eventsConfigurationProvider.geoEventsConfiguration() } returns fixedConfiguration
+            events.reloadEvents()
+            testScheduler.advanceUntilIdle()
+
+            // THEN
+            assertTrue(events.getValidationErrors().isEmpty())
+            assertEquals(listOf(paris, fixedTokyo), events.list())
+        }
+
     // ----------------------------
 
     @OptIn(ExperimentalCoroutinesApi::class)
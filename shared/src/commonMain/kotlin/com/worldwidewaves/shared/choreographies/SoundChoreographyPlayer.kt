@@ -23,11 +23,15 @@ package com.worldwidewaves.shared.choreographies
 
 import com.worldwidewaves.shared.WWWGlobals.FileSystem
 import com.worldwidewaves.shared.events.utils.IClock
+import com.worldwidewaves.shared.sound.MidiNote
 import com.worldwidewaves.shared.sound.MidiParser
 import com.worldwidewaves.shared.sound.MidiTrack
 import com.worldwidewaves.shared.sound.SoundPlayer
+import com.worldwidewaves.shared.sound.ToneSpec
 import com.worldwidewaves.shared.sound.WaveformGenerator
+import com.worldwidewaves.shared.sound.midi.MidiNoteStream
 import com.worldwidewaves.shared.utils.Log
+import kotlinx.coroutines.CancellationException
 import org.koin.core.component.KoinComponent
 import org.koin.core.component.inject
 import kotlin.random.Random
@@ -48,8 +52,11 @@ import kotlin.time.Instant
  * • **MIDI files are cached globally** - once a MIDI file is loaded, it's reused
  *   across all events and manager instances for the entire application lifecycle.
  *   This ensures optimal performance and memory usage.
+ * • Once loaded, every note of the track is handed to [SoundPlayer.prepareTones] so the
+ *   hit-time tone is already synthesized.
  * • When a device gets "hit" by the wave the UI calls [playCurrentSoundTone]
- *   passing the *wave start* timestamp. The manager maps the current
+ *   passing the *wave start* timestamp (or, ahead of the hit, [scheduleSoundTone]
+ *   with the predicted hit time). The manager maps the current
  *   `clock.now() – waveStartTime` to a position inside the track (with optional
  *   looping) and fetches all notes whose `[start,end]` window contains that
  *   position.
@@ -61,7 +68,8 @@ import kotlin.time.Instant
  *   chosen [Waveform][SoundPlayer.Waveform] (default *sine*).
  *
  * Public knobs:
- * • [setWaveform] lets callers choose another synthesis waveform.
+ * • [setWaveform] lets callers choose another synthesis waveform (call [prepareTones]
+ *   again to pre-render the track with it).
  * • [setLooping] controls whether the track should wrap when reaching its end.
  * • [getTotalDuration] exposes the track length for progress UI.
  * • [release] frees audio resources when the enclosing screen is disposed.
@@ -75,6 +83,7 @@ class SoundChoreographyPlayer : KoinComponent {
     private var currentTrack: MidiTrack? = null
     private var looping: Boolean = true
     private var isInitialized: Boolean = false
+    private var noteCursor: MidiNoteStream.Cursor? = null
 
     // Selected instrument settings - SQUARE waveform has richer harmonics for better perceived loudness
     private var selectedWaveform = SoundPlayer.Waveform.SQUARE
@@ -111,6 +120,7 @@ class SoundChoreographyPlayer : KoinComponent {
             val success = currentTrack != null
             if (success) {
                 Log.d("SoundChoreographyManager", "Successfully preloaded MIDI file: $midiResourcePath")
+                prepareTones()
             } else {
                 Log.w("SoundChoreographyManager", "MIDI file returned null: $midiResourcePath")
             }
@@ -125,19 +135,72 @@ class SoundChoreographyPlayer : KoinComponent {
         currentTrack = track
     }
 
+    /**
+     * Let the sound player pre-render every tone of the current track with the selected
+     * waveform, so a wave hit only schedules ready PCM.
+     */
+    suspend fun prepareTones() {
+        val track = currentTrack ?: return
+        val tones = track.notes.mapTo(LinkedHashSet()) { toneFor(it) }
+        try {
+            soundPlayer.prepareTones(tones)
+        } catch (e: CancellationException) {
+            throw e
+        } catch (e: Exception) {
+            // Not fatal: tones are then synthesized on first play
+            Log.w("SoundChoreographyManager", "Failed to prepare ${tones.size} tones: ${e.message}")
+        }
+    }
+
     /**
      * Play a random tone from the notes that would be active at the current position
      * in the MIDI track based on elapsed time since the given start time.
      */
-    @Suppress("ReturnCount") // Early returns for guard clauses improve readability
     suspend fun playCurrentSoundTone(waveStartTime: Instant): Int? {
-        val track = currentTrack
-        if (track == null) {
-            return null
-        }
+        val selectedNote = selectNoteAt(waveStartTime, clock.now()) ?: return null
+
+        // Play the tone using the platform-specific implementation
+        val tone = toneFor(selectedNote)
+        soundPlayer.playTone(
+            frequency = tone.frequency,
+            amplitude = tone.amplitude,
+            duration = tone.duration,
+            waveform = tone.waveform,
+        )
+
+        return selectedNote.pitch
+    }
+
+    /**
+     * Queue the tone that will be active at [startTime] (e.g. the user's hit time) so it
+     * starts exactly then, timed by the platform audio clock.
+     *
+     * @return The scheduled MIDI pitch, or `null` if no note is active at [startTime]
+     */
+    suspend fun scheduleSoundTone(
+        waveStartTime: Instant,
+        startTime: Instant,
+    ): Int? {
+        val selectedNote = selectNoteAt(waveStartTime, startTime) ?: return null
+
+        // Delay is taken as late as possible: the player converts it to audio clock time on entry
+        soundPlayer.scheduleTone(
+            tone = toneFor(selectedNote),
+            startDelay = (startTime - clock.now()).coerceAtLeast(Duration.ZERO),
+        )
+
+        return selectedNote.pitch
+    }
+
+    /** A random note among those active at [time], or `null` (no track, no active note). */
+    private fun selectNoteAt(
+        waveStartTime: Instant,
+        time: Instant,
+    ): MidiNote? {
+        val track = currentTrack ?: return null
 
         // Calculate elapsed time since wave start
-        val elapsedTime = clock.now() - waveStartTime
+        val elapsedTime = time - waveStartTime
 
         // Calculate position in the track, with looping
         val trackPosition =
@@ -147,34 +210,26 @@ class SoundChoreographyPlayer : KoinComponent {
                 elapsedTime
             }
 
-        // Find all notes that are active at this position
-        val activeNotes = track.notes.filter { it.isActiveAt(trackPosition) }
-
-        if (activeNotes.isEmpty()) {
-            return null
-        }
+        // Find all notes that are active at this position (cursor follows playback through the stream)
+        val cursor =
+            noteCursor?.takeIf { it.stream === track.noteStream }
+                ?: track.noteStream.cursor().also { noteCursor = it }
+        val activeNotes = cursor.activeAt(trackPosition)
 
         // Select a random note from active notes
-        val selectedNote = activeNotes[Random.nextInt(activeNotes.size)]
-
-        // Convert MIDI pitch to frequency using shared utility
-        val frequency = WaveformGenerator.midiPitchToFrequency(selectedNote.pitch)
-
-        // Convert MIDI velocity to amplitude using shared utility - use full amplitude for maximum loudness
-        val amplitude = WaveformGenerator.midiVelocityToAmplitude(selectedNote.velocity)
+        return activeNotes.takeIf { it.isNotEmpty() }?.let { it[Random.nextInt(it.size)] }
+    }
 
-        // Play the tone using the platform-specific implementation
-        soundPlayer.playTone(
-            frequency = frequency,
-            amplitude = amplitude,
-            duration = selectedNote.duration.coerceAtMost(2.seconds),
+    private fun toneFor(note: MidiNote): ToneSpec =
+        ToneSpec(
+            // Convert MIDI pitch to frequency using shared utility
+            frequency = WaveformGenerator.midiPitchToFrequency(note.pitch),
+            // Convert MIDI velocity to amplitude using shared utility - use full amplitude for maximum loudness
+            amplitude = WaveformGenerator.midiVelocityToAmplitude(note.velocity),
+            duration = note.duration.coerceAtMost(2.seconds),
             waveform = selectedWaveform,
         )
 
-        val result = selectedNote.pitch
-        return result
-    }
-
     /**
      * Set the waveform type for synthesis
      */
@@ -200,5 +255,6 @@ class SoundChoreographyPlayer : KoinComponent {
     fun release() {
         soundPlayer.release()
         currentTrack = null
+        noteCursor = null
     }
 }
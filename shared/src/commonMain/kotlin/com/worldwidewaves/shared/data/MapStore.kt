@@ -21,9 +21,13 @@ package com.worldwidewaves.shared.data
  * limitations under the License.
  */
 
+import com.worldwidewaves.shared.events.WWWEvents
+import com.worldwidewaves.shared.events.io.WaveKeyframeStore
+import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
 import com.worldwidewaves.shared.utils.Log
 import kotlinx.coroutines.sync.Mutex
 import kotlinx.coroutines.sync.withLock
+import org.koin.mp.KoinPlatform
 
 // -------- platform shims (implemented per platform) ----------
 expect suspend fun platformCacheRoot(): String
@@ -32,6 +36,8 @@ expect suspend fun platformFileExists(path: String): Boolean
 
 expect suspend fun platformReadText(path: String): String
 
+expect suspend fun platformReadBytes(path: String): ByteArray
+
 expect suspend fun platformWriteText(
     path: String,
     content: String,
@@ -53,6 +59,7 @@ expect suspend fun platformFetchToFile(
 // -------------------------------------------------------------
 
 private val unavailable = mutableSetOf<String>()
+private val areaUnavailable = mutableSetOf<String>()
 private val lock = Mutex()
 
 object MapDownloadGate {
@@ -79,9 +86,54 @@ expect suspend fun platformTryCopyInitialTagToCache(
 /** Clear the “unavailable” session cache + in-memory geojson cache. */
 fun clearUnavailableGeoJsonCache(eventId: String) {
     unavailable.remove(eventId)
+    areaUnavailable.remove(eventId)
     platformInvalidateGeoJson(eventId)
 }
 
+/**
+ * Drops what was derived from the files of an uninstalled event, once the platform
+ * `clearEventCache` deleted them: the session area miss, the event's polygons in
+ * `AreaGeometryCache` (reloaded on next use, empty without a map) and its wave keyframe in [root].
+ */
+fun clearEventAreaCache(
+    eventId: String,
+    root: String,
+) {
+    areaUnavailable.remove(eventId)
+    runCatching {
+        val koin = KoinPlatform.getKoin()
+        val event = koin.get<WWWEvents>().getEventById(eventId)
+        // clearPolygonCacheForDownload is suspend (polygon mutex)
+        koin.get<CoroutineScopeProvider>().launchDefault {
+            event?.area?.clearPolygonCacheForDownload()
+            WaveKeyframeStore.invalidate(root, eventId)
+        }
+    }.onFailure { Log.w("MapStore", "clearEventAreaCache: Cannot clear area of $eventId: ${it.message}") }
+}
+
+/**
+ * Records a binary area a platform copied into [root] next to the GeoJSON/MBTiles (e.g. while an
+ * iOS ODR tag is mounted): stamps it for [getAreaFileAbsolutePath], which only looks in the visible
+ * bundle itself, lifts an earlier session miss and drops the wave keyframe of the previous area.
+ */
+internal suspend fun onAreaFileCached(
+    root: String,
+    eventId: String,
+) {
+    platformWriteText(metaPath(root, "$eventId.${MapFileExtension.AREA}"), platformAppVersionStamp())
+    areaUnavailable.remove(eventId)
+    WaveKeyframeStore.invalidate(root, eventId)
+}
+
+/** New GeoJSON for [eventId]: drops the geometry and the wave keyframe computed from the previous one. */
+private suspend fun invalidateEventGeometry(
+    root: String,
+    eventId: String,
+) {
+    platformInvalidateGeoJson(eventId)
+    WaveKeyframeStore.invalidate(root, eventId)
+}
+
 private fun metaPath(
     root: String,
     name: String,
@@ -117,6 +169,9 @@ enum class MapFileExtension(
 ) {
     GEOJSON("geojson"),
     MBTILES("mbtiles"),
+
+    /** Preprocessed binary event area, see `BinaryAreaFormat`. Optional in map modules. */
+    AREA("wwa"),
     ;
 
     override fun toString(): String = value
@@ -180,14 +235,14 @@ suspend fun getMapFileAbsolutePath(
                 // Cache exists with old version stamp - migrate to current version
                 Log.i("MapStore", "getMapFileAbsolutePath: Migrating cache from version $storedStamp to $stamp for $eventId.$extension")
                 platformWriteText(meta, stamp)
-                if (extension == MapFileExtension.GEOJSON) platformInvalidateGeoJson(eventId)
+                if (extension == MapFileExtension.GEOJSON) invalidateEventGeometry(root, eventId)
                 Log.i("MapStore", "getMapFileAbsolutePath: Cache migrated successfully -> $dataPath")
                 return dataPath
             } else if (!metaExists) {
                 // Data file exists but no metadata - create metadata
                 Log.i("MapStore", "getMapFileAbsolutePath: Creating missing metadata for existing cache $eventId.$extension")
                 platformWriteText(meta, stamp)
-                if (extension == MapFileExtension.GEOJSON) platformInvalidateGeoJson(eventId)
+                if (extension == MapFileExtension.GEOJSON) invalidateEventGeometry(root, eventId)
                 Log.i("MapStore", "getMapFileAbsolutePath: Metadata created -> $dataPath")
                 return dataPath
             }
@@ -199,7 +254,7 @@ suspend fun getMapFileAbsolutePath(
             Log.d("MapStore", "getMapFileAbsolutePath: Download not allowed, trying bundle/ODR copy for $eventId.$extension")
             if (platformTryCopyInitialTagToCache(eventId, extension.value, dataPath)) {
                 platformWriteText(meta, stamp)
-                if (extension == MapFileExtension.GEOJSON) platformInvalidateGeoJson(eventId)
+                if (extension == MapFileExtension.GEOJSON) invalidateEventGeometry(root, eventId)
                 Log.i("MapStore", "getMapFileAbsolutePath: Copied from bundle/ODR -> $dataPath")
                 return dataPath
             }
@@ -219,7 +274,7 @@ suspend fun getMapFileAbsolutePath(
             return null
         }
         platformWriteText(meta, stamp)
-        if (extension == MapFileExtension.GEOJSON) platformInvalidateGeoJson(eventId)
+        if (extension == MapFileExtension.GEOJSON) invalidateEventGeometry(root, eventId)
         Log.i("MapStore", "getMapFileAbsolutePath: Download SUCCESS -> $dataPath")
 
         return dataPath
@@ -229,3 +284,46 @@ expect suspend fun cacheStringToFile(
     fileName: String,
     content: String,
 ): String?
+
+/**
+ * Returns the absolute path to the cached binary area file of an event, or null if the
+ * event's map module does not ship one.
+ *
+ * Unlike [getMapFileAbsolutePath], this never downloads: the binary file is an optional
+ * companion of the GeoJSON (older map modules do not have it), so it is only copied from the
+ * installed bundle/split. A miss is remembered for the session and cleared with
+ * [clearUnavailableGeoJsonCache] once a map is downloaded. The copy is refreshed whenever the
+ * app version stamp changes, since the format is tied to the app version that reads it.
+ *
+ * @param eventId The unique identifier of the event
+ * @return Absolute path to the cached `.wwa` file, or null if unavailable
+ */
+suspend fun getAreaFileAbsolutePath(eventId: String): String? =
+    lock.withLock {
+        if (eventId in areaUnavailable) return null
+
+        val root = platformCacheRoot().also { platformEnsureDir(it) }
+        val fileName = "$eventId.${MapFileExtension.AREA}"
+        val dataPath = "$root/$fileName"
+        val meta = metaPath(root, fileName)
+        val stamp = platformAppVersionStamp()
+
+        val upToDate =
+            platformFileExists(dataPath) &&
+                platformFileExists(meta) &&
+                runCatching { platformReadText(meta) }.getOrNull() == stamp
+        if (upToDate) {
+            return dataPath
+        }
+
+        if (platformTryCopyInitialTagToCache(eventId, MapFileExtension.AREA.value, dataPath)) {
+            platformWriteText(meta, stamp)
+            WaveKeyframeStore.invalidate(root, eventId)
+            Log.i("MapStore", "getAreaFileAbsolutePath: Cached $fileName from bundle")
+            return dataPath
+        }
+
+        Log.d("MapStore", "getAreaFileAbsolutePath: No binary area for $eventId, GeoJSON will be parsed")
+        areaUnavailable += eventId
+        null
+    }
@@ -27,6 +27,7 @@ import com.worldwidewaves.shared.domain.observation.PositionObserver
 import com.worldwidewaves.shared.domain.progression.DefaultWaveProgressionTracker
 import com.worldwidewaves.shared.domain.progression.WaveProgressionTracker
 import com.worldwidewaves.shared.domain.scheduling.DefaultObservationScheduler
+import com.worldwidewaves.shared.domain.scheduling.ObservationEngine
 import com.worldwidewaves.shared.domain.scheduling.ObservationScheduler
 import com.worldwidewaves.shared.domain.state.DefaultEventStateHolder
 import com.worldwidewaves.shared.domain.state.EventStateHolder
@@ -42,6 +43,8 @@ import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
 import com.worldwidewaves.shared.events.utils.DefaultCoroutineScopeProvider
 import com.worldwidewaves.shared.events.utils.IClock
 import com.worldwidewaves.shared.events.utils.SystemClock
+import com.worldwidewaves.shared.map.MapPrefetcher
+import com.worldwidewaves.shared.map.NativeMapViewProvider
 import com.worldwidewaves.shared.position.PositionManager
 import com.worldwidewaves.shared.utils.CloseableCoroutineScope
 import org.koin.dsl.module
@@ -186,9 +189,29 @@ val helpersModule =
          * - Automatically stops observation after event ends
          * - Respects configured observation windows
          *
+         * All observation flows share the [ObservationEngine] timer, so every observed event
+         * is woken by the same loop (one wake-up per deadline).
+         *
          * @see ObservationScheduler for scheduling API
          */
-        single<ObservationScheduler> { DefaultObservationScheduler(get()) }
+        single<ObservationScheduler> { DefaultObservationScheduler(get(), ObservationEngine(get())) }
+
+        /**
+         * Provides [MapPrefetcher] for warming event maps ahead of the wave.
+         *
+         * **Scope**: Singleton - remembers which events were already prefetched
+         * **Thread-safety**: Yes - attempts are claimed under a mutex
+         * **Lifecycle**: Lives for entire app lifecycle
+         * **Dependencies**: ObservationScheduler, CoroutineScopeProvider, optional NativeMapViewProvider
+         *
+         * The native provider is resolved lazily: iOS registers it from Swift after Koin starts.
+         *
+         * @see MapPrefetcher for prefetch triggers
+         */
+        single {
+            val koin = getKoin()
+            MapPrefetcher(get(), get()) { koin.getOrNull<NativeMapViewProvider>() }
+        }
 
         /**
          * Provides [WWWShutdownHandler] as factory for cleanup operations.
@@ -23,8 +23,10 @@ package com.worldwidewaves.shared.domain.observation
 
 import com.worldwidewaves.shared.domain.progression.WaveProgressionTracker
 import com.worldwidewaves.shared.events.IWWWEvent
+import com.worldwidewaves.shared.events.utils.Area
 import com.worldwidewaves.shared.position.PositionManager
 import com.worldwidewaves.shared.utils.Log
+import kotlin.concurrent.Volatile
 import kotlin.coroutines.cancellation.CancellationException
 
 /**
@@ -45,7 +47,8 @@ import kotlin.coroutines.cancellation.CancellationException
  *
  * ## Performance Considerations
  * - Only performs area checks when polygon data is loaded
- * - Caches position data from PositionManager
+ * - Reuses the last result while the [PositionManager] position revision and the polygon
+ *   list are unchanged (insignificant GPS fixes and observation ticks cost no polygon test)
  * - Minimal CPU usage when user is not near event
  *
  * ## Thread Safety
@@ -55,12 +58,22 @@ import kotlin.coroutines.cancellation.CancellationException
  * This class follows iOS safety patterns:
  * - No KoinComponent dependency (dependencies injected)
  * - No coroutine launches in initialization
- * - Stateless operations (no mutable state)
+ * - Only mutable state is the last area result (a single immutable snapshot reference)
  */
 class EventPositionTracker(
     private val positionManager: PositionManager,
     private val waveProgressionTracker: WaveProgressionTracker,
 ) {
+    /** Area result for one event, position revision and polygon list. */
+    private class AreaCheck(
+        val eventId: String,
+        val revision: Long,
+        val polygons: Area,
+        val isInArea: Boolean,
+    )
+
+    @Volatile private var lastAreaCheck: AreaCheck? = null
+
     /**
      * Updates area detection state for the given event.
      *
@@ -74,6 +87,7 @@ class EventPositionTracker(
      * @return True if user is in event area, false otherwise (including errors)
      */
     suspend fun isUserInArea(event: IWWWEvent): Boolean {
+        val revision = positionManager.getPositionRevision()
         val userPosition = positionManager.getCurrentPosition() ?: return false
 
         return try {
@@ -81,8 +95,17 @@ class EventPositionTracker(
             val polygons = event.area.getPolygons()
 
             if (polygons.isNotEmpty()) {
+                // Position not significantly changed since the last check: same answer
+                lastAreaCheck?.let { check ->
+                    if (check.eventId == event.id && check.revision == revision && check.polygons === polygons) {
+                        return check.isInArea
+                    }
+                }
+
                 // Now call the actual area detection with pre-fetched polygons (performance optimization)
-                waveProgressionTracker.isUserInWaveArea(userPosition, event.area, polygons)
+                waveProgressionTracker.isUserInWaveArea(userPosition, event.area, polygons).also {
+                    lastAreaCheck = AreaCheck(event.id, revision, polygons, it)
+                }
             } else {
                 false
             }
@@ -24,8 +24,10 @@ package com.worldwidewaves.shared.domain.scheduling
  */
 
 import com.worldwidewaves.shared.events.IWWWEvent
+import com.worldwidewaves.shared.events.geometry.AreaGeometryCache
 import com.worldwidewaves.shared.events.utils.IClock
 import com.worldwidewaves.shared.utils.Log
+import kotlinx.coroutines.channels.ProducerScope
 import kotlinx.coroutines.channels.awaitClose
 import kotlinx.coroutines.flow.Flow
 import kotlinx.coroutines.flow.callbackFlow
@@ -56,9 +58,15 @@ import kotlin.time.Duration.Companion.seconds
  * - Infinite interval stops observation when event is no longer relevant
  * - Progressive interval reduction as event approaches
  * - Critical timing accuracy for sound synchronization
+ * - All observation flows share one [ObservationEngine]: one wake-up per deadline for every
+ *   observed event instead of one delay loop per event
+ * - Every computed interval is reported to the [AreaGeometryCache], which keeps the areas of
+ *   events observed again soon resident
  */
 class DefaultObservationScheduler(
     private val clock: IClock,
+    private val engine: ObservationEngine = ObservationEngine(clock),
+    private val geometryCache: AreaGeometryCache = AreaGeometryCache.shared,
 ) : ObservationScheduler {
     override suspend fun calculateObservationInterval(event: IWWWEvent): Duration {
         val now = clock.now()
@@ -89,29 +97,16 @@ class DefaultObservationScheduler(
 
     override fun createObservationFlow(event: IWWWEvent): Flow<Unit> =
         callbackFlow {
+            var registration: ObservationEngine.Registration? = null
             try {
                 if (shouldObserveContinuously(event)) {
                     Log.v("DefaultObservationScheduler", "Starting continuous observation for event ${event.id}")
 
-                    while (!event.isDone()) {
-                        // Emit observation trigger
-                        send(Unit)
-
-                        // Calculate next observation interval
-                        val observationDelay = calculateObservationInterval(event)
-
-                        if (!observationDelay.isFinite()) {
-                            Log.v("DefaultObservationScheduler", "Stopping observation flow due to infinite interval")
-                            break
-                        }
-
-                        // Wait for next observation
-                        clock.delay(observationDelay)
+                    // First observation right away, the following ones on the shared engine
+                    val firstInterval = observeOnce(event)
+                    if (firstInterval != null) {
+                        registration = engine.schedule(event.id, this, firstInterval) { observeOnce(event) }
                     }
-
-                    // Final emission when event is done
-                    Log.v("DefaultObservationScheduler", "Event ${event.id} done, final observation emission")
-                    send(Unit)
                 } else {
                     // For events not ready for continuous observation, emit once
                     send(Unit)
@@ -122,9 +117,36 @@ class DefaultObservationScheduler(
 
             awaitClose {
                 Log.v("DefaultObservationScheduler", "Closing observation flow for event ${event.id}")
+                registration?.cancel()
             }
         }
 
+    /**
+     * One observation tick: emits, then returns the next interval, or null once the event is
+     * done or no longer needs observing (after a final emission).
+     */
+    private suspend fun ProducerScope<Unit>.observeOnce(event: IWWWEvent): Duration? {
+        if (!event.isDone()) {
+            // Emit observation trigger (dropping the tick when the collector is still busy is fine)
+            trySend(Unit)
+
+            // Calculate next observation interval
+            val observationDelay = calculateObservationInterval(event)
+            if (observationDelay.isFinite()) {
+                geometryCache.noteNextObservation(event.id, observationDelay)
+                return observationDelay
+            }
+
+            Log.v("DefaultObservationScheduler", "Stopping observation flow due to infinite interval")
+        }
+
+        // Final emission when event is done
+        Log.v("DefaultObservationScheduler", "Event ${event.id} done, final observation emission")
+        trySend(Unit)
+        geometryCache.noteNextObservation(event.id, null)
+        return null
+    }
+
     override suspend fun getObservationSchedule(event: IWWWEvent): ObservationSchedule {
         val shouldObserve = shouldObserveContinuously(event)
         val interval = calculateObservationInterval(event)
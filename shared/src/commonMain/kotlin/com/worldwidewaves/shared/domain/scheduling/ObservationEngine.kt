@@ -0,0 +1,253 @@
+package com.worldwidewaves.shared.domain.scheduling
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.IClock
+import com.worldwidewaves.shared.utils.Log
+import kotlinx.atomicfu.locks.reentrantLock
+import kotlinx.atomicfu.locks.withLock
+import kotlinx.coroutines.CancellationException
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Job
+import kotlinx.coroutines.channels.Channel
+import kotlinx.coroutines.coroutineScope
+import kotlinx.coroutines.currentCoroutineContext
+import kotlinx.coroutines.isActive
+import kotlinx.coroutines.launch
+import kotlinx.coroutines.selects.select
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.ZERO
+import kotlin.time.Instant
+
+/**
+ * Single timer shared by every event observation.
+ *
+ * Instead of one delay loop per observed event, every registration holds its next deadline in
+ * a slot table keyed by wake-up instant, and one loop sleeps until the earliest slot. All
+ * registrations in that slot are evaluated in the same wake-up.
+ *
+ * ## Slot Alignment
+ * Deadlines are rounded up to the next multiple of the interval since the epoch, so events in
+ * the same interval tier (1h, 5min, 1s, 500ms, ...) land in the same slot and wake together.
+ * The first observation after registering may come earlier than a full interval, never later.
+ *
+ * ## Loop Ownership
+ * The loop runs in the scope of one of the registrations (the observation flow collecting it),
+ * so it follows the collectors' dispatcher and never outlives them. When that registration is
+ * cancelled the loop moves to another live registration; it stops when no registration is left.
+ *
+ * ## Thread Safety
+ * Slot table and loop ownership are guarded by a lock; observations run on the loop only.
+ */
+class ObservationEngine(
+    private val clock: IClock,
+) {
+    /**
+     * One scheduled observation. [observe] runs at each deadline and returns the next
+     * interval, or null to stop.
+     */
+    inner class Registration internal constructor(
+        val key: String,
+        internal val scope: CoroutineScope,
+        internal val observe: suspend () -> Duration?,
+    ) {
+        internal var deadline: Instant? = null
+        internal var cancelled = false
+
+        internal val isLive: Boolean get() = !cancelled && scope.isActive
+
+        fun cancel() = unregister(this)
+    }
+
+    private val lock = reentrantLock()
+    private val slots = mutableMapOf<Instant, MutableList<Registration>>()
+    private val wakeup = Channel<Unit>(Channel.CONFLATED)
+    private var loopJob: Job? = null
+    private var loopOwner: Registration? = null
+    private var sleepingUntil: Instant? = null
+
+    /**
+     * Schedules [observe] [interval] from now (slot-aligned) in [scope].
+     * The registration ends when [observe] returns null or [Registration.cancel] is called.
+     */
+    fun schedule(
+        key: String,
+        scope: CoroutineScope,
+        interval: Duration,
+        observe: suspend () -> Duration?,
+    ): Registration {
+        val registration = Registration(key, scope, observe)
+        val deadline = alignedDeadline(clock.now(), interval)
+        lock.withLock {
+            insert(registration, deadline)
+            if (loopJob == null) {
+                startLoop(registration)
+            } else if (sleepingUntil.let { it == null || deadline < it }) {
+                wakeup.trySend(Unit)
+            }
+        }
+        return registration
+    }
+
+    /** Number of live registrations (diagnostics and tests). */
+    fun registrationCount(): Int = lock.withLock { slots.values.sumOf { it.size } }
+
+    private fun unregister(registration: Registration) {
+        lock.withLock {
+            registration.cancelled = true
+            registration.deadline?.let { deadline ->
+                registration.deadline = null
+                slots[deadline]?.let { slot ->
+                    slot.remove(registration)
+                    if (slot.isEmpty()) slots.remove(deadline)
+                }
+            }
+            if (loopOwner === registration) {
+                loopJob?.cancel()
+                loopJob = null
+                loopOwner = null
+                handOverLoop()
+            }
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    /** Must be called with [lock] held. */
+    private fun insert(
+        registration: Registration,
+        deadline: Instant,
+    ) {
+        registration.deadline = deadline
+        slots.getOrPut(deadline) { mutableListOf() }.add(registration)
+    }
+
+    /** Must be called with [lock] held. */
+    private fun startLoop(owner: Registration) {
+        loopOwner = owner
+        loopJob = owner.scope.launch { runLoop() }
+    }
+
+    /** Restarts the loop in the scope of any live registration. Must be called with [lock] held. */
+    private fun handOverLoop() {
+        val next = slots.values.asSequence().flatten().firstOrNull { it.isLive } ?: return
+        Log.v(TAG, "Observation loop handed over to ${next.key}")
+        startLoop(next)
+    }
+
+    private suspend fun runLoop() {
+        val self = currentCoroutineContext()[Job]
+        var due: List<Registration> = emptyList()
+        var evaluated = 0
+        try {
+            while (true) {
+                val next =
+                    lock.withLock {
+                        if (loopJob !== self) return // Superseded by a handed-over loop
+                        val earliest = slots.keys.minOrNull()
+                        if (earliest == null) {
+                            loopJob = null
+                            loopOwner = null
+                        }
+                        sleepingUntil = earliest
+                        earliest
+                    } ?: return
+
+                val wait = next - clock.now()
+                if (wait > ZERO && sleep(wait)) continue // Woken early by an earlier registration
+
+                val now = clock.now()
+                due =
+                    lock.withLock {
+                        sleepingUntil = null
+                        slots.keys.filter { it <= now }.flatMap { deadline ->
+                            slots.remove(deadline).orEmpty().onEach { it.deadline = null }
+                        }
+                    }
+                evaluated = 0
+                for (registration in due) {
+                    evaluate(registration)
+                    evaluated++
+                }
+                due = emptyList()
+            }
+        } finally {
+            // Cancelled mid-batch (owner gone): put back what was not evaluated for the next owner
+            val remaining = due.drop(evaluated)
+            lock.withLock {
+                val now = clock.now()
+                remaining.filter { it.isLive }.forEach { insert(it, now) }
+                if (loopJob === self) {
+                    loopJob = null
+                    loopOwner = null
+                }
+                if (loopJob == null) handOverLoop()
+            }
+            if (remaining.isNotEmpty()) wakeup.trySend(Unit)
+        }
+    }
+
+    private suspend fun evaluate(registration: Registration) {
+        if (!registration.isLive) return
+        val interval =
+            try {
+                registration.observe()
+            } catch (e: CancellationException) {
+                throw e
+            } catch (e: Exception) {
+                Log.e(TAG, "Observation failed for ${registration.key}, dropping it", throwable = e)
+                null
+            }
+        if (interval == null || !interval.isFinite()) return
+
+        lock.withLock {
+            if (registration.isLive) insert(registration, alignedDeadline(clock.now(), interval))
+        }
+    }
+
+    /** Sleeps for [duration] on the clock; returns true when woken earlier by [wakeup]. */
+    private suspend fun sleep(duration: Duration): Boolean =
+        coroutineScope {
+            val timer = launch { clock.delay(duration) }
+            val woken =
+                select<Boolean> {
+                    timer.onJoin { false }
+                    wakeup.onReceive { true }
+                }
+            timer.cancel()
+            woken
+        }
+
+    companion object {
+        private const val TAG = "ObservationEngine"
+
+        /** Next multiple of [interval] since the epoch strictly after [now]. */
+        internal fun alignedDeadline(
+            now: Instant,
+            interval: Duration,
+        ): Instant {
+            val step = interval.inWholeMilliseconds.coerceAtLeast(1)
+            val nowMs = now.toEpochMilliseconds()
+            return Instant.fromEpochMilliseconds((nowMs.floorDiv(step) + 1) * step)
+        }
+    }
+}
@@ -70,6 +70,15 @@ data class WWWEvent(
 ) : IWWWEvent,
     DataValidator,
     KoinComponent {
+    companion object {
+        // Validation patterns, compiled once for the whole catalogue
+        private val ID_PATTERN = Regex("^[a-z_]+$")
+        private val DATE_PATTERN = Regex("\\d{4}-\\d{2}-\\d{2}")
+        private val HOUR_PATTERN = Regex("\\d{2}:\\d{2}")
+        private val INSTAGRAM_ACCOUNT_PATTERN = Regex("^[A-Za-z0-9_.]+$")
+        private val INSTAGRAM_HASHTAG_PATTERN = Regex("^#[A-Za-z0-9_]+$")
+    }
+
     @Serializable
     data class WWWWaveDefinition(
         val linear: WWWEventWaveLinear? = null,
@@ -287,7 +296,7 @@ data class WWWEvent(
                     id.isEmpty() ->
                         this.add("ID is empty")
 
-                    !id.matches(Regex("^[a-z_]+$")) ->
+                    !id.matches(ID_PATTERN) ->
                         this.add("ID must be lowercase with only simple letters or underscores")
 
                     type.isEmpty() ->
@@ -302,22 +311,22 @@ data class WWWEvent(
                     timeZone.isEmpty() ->
                         this.add("Time zone is empty")
 
-                    !date.matches(Regex("\\d{4}-\\d{2}-\\d{2}")) || runCatching { LocalDate.parse(date) }.isFailure ->
+                    !date.matches(DATE_PATTERN) || runCatching { LocalDate.parse(date) }.isFailure ->
                         this.add("Date format is invalid or date is not valid")
 
-                    !startHour.matches(Regex("\\d{2}:\\d{2}")) || runCatching { LocalTime.parse(startHour) }.isFailure ->
+                    !startHour.matches(HOUR_PATTERN) || runCatching { LocalTime.parse(startHour) }.isFailure ->
                         this.add("Start hour format is invalid or time is not valid")
 
                     instagramAccount.isEmpty() ->
                         this.add("Instagram account is empty")
 
-                    !instagramAccount.matches(Regex("^[A-Za-z0-9_.]+$")) ->
+                    !instagramAccount.matches(INSTAGRAM_ACCOUNT_PATTERN) ->
                         this.add("Instagram account is invalid")
 
                     instagramHashtag.isEmpty() ->
                         this.add("Instagram hashtag is empty")
 
-                    !instagramHashtag.matches(Regex("^#[A-Za-z0-9_]+$")) ->
+                    !instagramHashtag.matches(INSTAGRAM_HASHTAG_PATTERN) ->
                         this.add("Instagram hashtag is invalid")
 
                     runCatching { TimeZone.of(timeZone) }.isFailure ->
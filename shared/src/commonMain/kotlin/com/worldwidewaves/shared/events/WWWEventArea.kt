@@ -25,8 +25,11 @@ import com.worldwidewaves.shared.WWWGlobals
 import com.worldwidewaves.shared.data.MapFileExtension
 import com.worldwidewaves.shared.data.getMapFileAbsolutePath
 import com.worldwidewaves.shared.events.data.GeoJsonDataProvider
+import com.worldwidewaves.shared.events.geometry.AreaGeometryCache
+import com.worldwidewaves.shared.events.geometry.AreaSpatialIndex
 import com.worldwidewaves.shared.events.geometry.EventAreaGeometry
 import com.worldwidewaves.shared.events.geometry.EventAreaPositionTesting
+import com.worldwidewaves.shared.events.io.BinaryAreaFormat
 import com.worldwidewaves.shared.events.io.GeoJsonAreaParser
 import com.worldwidewaves.shared.events.utils.Area
 import com.worldwidewaves.shared.events.utils.BoundingBox
@@ -54,7 +57,8 @@ import kotlin.time.ExperimentalTime
  *
  * Loads polygons from the event-specific cached GeoJSON (or an optional `bbox`
  * string override), then:
- *  • Caches the parsed polygons, computed bounding-box and center position.
+ *  • Keeps the parsed polygons and their spatial index in the shared [AreaGeometryCache]
+ *    (memory-bounded, reloaded on demand), caches the bounding-box and center position.
  *  • Provides fast `isPositionWithin()` tests (bbox pre-check + polygon test).
  *  • Offers helpers such as `generateRandomPositionInArea()` for simulation.
  *  • Exposes lazy `bbox()` / `getCenter()` accessors used by map & wave logic.
@@ -138,7 +142,10 @@ data class WWWEventArea(
     private val geoJsonDataProvider: GeoJsonDataProvider by inject()
     private val coroutineScopeProvider: CoroutineScopeProvider by inject()
 
-    @Transient private var cachedAreaPolygons: Area? = null
+    // Polygons and spatial index live in the shared cache under this instance's key
+    @Transient private val geometryCache = AreaGeometryCache.shared
+
+    @Transient private val geometryKey = geometryCache.newKey()
 
     @Transient private val polygonsCacheMutex = Mutex()
 
@@ -149,6 +156,9 @@ data class WWWEventArea(
 
     @Transient private var cachedPositionWithinResult: Pair<Position, Boolean>? = null
 
+    // Spatial index of the last foreign polygon list tested (wave-split polygons), see spatialIndexFor
+    @Transient private var cachedSpatialIndex: Pair<Area, AreaSpatialIndex>? = null
+
     // Polygon loading state notification
     @Transient private val _polygonsLoaded = MutableStateFlow(false)
     val polygonsLoaded: StateFlow<Boolean> = _polygonsLoaded.asStateFlow()
@@ -177,7 +187,7 @@ data class WWWEventArea(
      * during normal app usage).
      */
     fun clearCache() {
-        // DO NOT clear cachedAreaPolygons - immutable event data
+        // DO NOT clear cached polygons - immutable event data
         // DO NOT clear _polygonsLoaded - accurate state indicator
 
         // Clear derived/transient data
@@ -203,11 +213,12 @@ data class WWWEventArea(
      */
     internal suspend fun clearPolygonCacheForDownload() {
         polygonsCacheMutex.withLock {
-            cachedAreaPolygons = null
+            geometryCache.remove(geometryKey)
             _polygonsLoaded.value = false
             cachedBoundingBox = null
             cachedCenter = null
             cachedPositionWithinResult = null
+            cachedSpatialIndex = null
 
             // Clear wave duration cache - it depends on bbox from polygons
             event?.wave?.clearDurationCache()
@@ -253,7 +264,8 @@ data class WWWEventArea(
      */
     suspend fun isPositionWithin(position: Position): Boolean {
         val boundingBox = bbox()
-        val polygons = getPolygons()
+        val geometry = loadedGeometry()
+        val polygons = geometry?.polygons ?: emptyList()
 
         // Defensive check: log once if polygons not loaded (expected for undownloaded maps)
         if (polygons.isEmpty()) {
@@ -272,6 +284,7 @@ data class WWWEventArea(
                 boundingBox,
                 polygons,
                 cachedPositionWithinResult,
+                geometry?.spatialIndex ?: spatialIndexFor(polygons),
             )
 
         // Update cache if changed
@@ -304,6 +317,7 @@ data class WWWEventArea(
                 boundingBox,
                 polygons,
                 cachedPositionWithinResult,
+                spatialIndexFor(polygons),
             )
 
         // Update cache if changed
@@ -314,6 +328,18 @@ data class WWWEventArea(
         return result
     }
 
+    /**
+     * Returns the spatial index for [polygons]: the cached one for the area's own polygons,
+     * otherwise the last one built, when the same list instance is passed again.
+     */
+    private fun spatialIndexFor(polygons: Area): AreaSpatialIndex {
+        geometryCache.get(geometryKey)?.let { if (it.polygons === polygons) return it.spatialIndex }
+        cachedSpatialIndex?.let { (source, index) ->
+            if (source === polygons) return index
+        }
+        return AreaSpatialIndex.fromArea(polygons).also { cachedSpatialIndex = polygons to it }
+    }
+
     // ---------------------------
 
     /**
@@ -344,7 +370,7 @@ data class WWWEventArea(
                 event,
                 bbox,
                 geoJsonDataProvider,
-                cachedAreaPolygons,
+                geometryCache.get(geometryKey)?.polygons,
             )
 
         // Only cache valid bboxes to prevent cache poisoning
@@ -385,9 +411,14 @@ data class WWWEventArea(
      * Retrieves the polygons representing the event area.
      * Delegates to [GeoJsonAreaParser] for polygon loading.
      */
-    suspend fun getPolygons(): Area {
+    suspend fun getPolygons(): Area = loadedGeometry()?.polygons ?: emptyList()
+
+    /**
+     * Cached polygons and spatial index, loaded (again, after an eviction) when missing.
+     */
+    private suspend fun loadedGeometry(): AreaGeometryCache.Entry? {
         // Fast path: if cache is already populated, return immediately
-        cachedAreaPolygons?.let {
+        geometryCache.get(geometryKey)?.let {
             return it
         }
 
@@ -401,7 +432,7 @@ data class WWWEventArea(
     /**
      * Loads polygons from GeoJSON and caches them with mutex protection
      */
-    private suspend fun loadAndCachePolygons(): Area {
+    private suspend fun loadAndCachePolygons(): AreaGeometryCache.Entry? {
         // Circuit breaker: Skip loading if we recently failed (prevents retry storms)
         if (shouldSkipLoadDueToRecentFailure(event.id)) {
             if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
@@ -410,12 +441,12 @@ data class WWWEventArea(
                     "loadAndCachePolygons: ${event.id} skipping load due to recent failure (circuit breaker active)",
                 )
             }
-            return emptyList()
+            return null
         }
 
-        polygonsCacheMutex.withLock {
+        return polygonsCacheMutex.withLock {
             // Double-check pattern: another coroutine might have populated the cache
-            cachedAreaPolygons?.let {
+            geometryCache.get(geometryKey)?.let {
                 return it
             }
 
@@ -425,16 +456,19 @@ data class WWWEventArea(
 
             try {
                 coroutineScopeProvider.withDefaultContext {
-                    GeoJsonAreaParser.loadPolygonsFromGeoJson(
-                        event,
-                        geoJsonDataProvider,
-                        bbox,
-                        tempPolygons,
-                    )
+                    // Preprocessed binary area first, GeoJSON for map modules that predate it
+                    if (!BinaryAreaFormat.loadPolygons(event.id, bbox, tempPolygons)) {
+                        GeoJsonAreaParser.loadPolygonsFromGeoJson(
+                            event,
+                            geoJsonDataProvider,
+                            bbox,
+                            tempPolygons,
+                        )
+                    }
                 }
                 // Only log on successful load or failure, not empty result
                 if (tempPolygons.isNotEmpty()) {
-                    Log.i("WWWEventArea", "loadAndCachePolygons: ${event.id} loaded ${tempPolygons.size} polygons from GeoJSON")
+                    Log.i("WWWEventArea", "loadAndCachePolygons: ${event.id} loaded ${tempPolygons.size} polygons")
                     // Clear circuit breaker on successful load
                     clearFailedLoadAttempt(event.id)
                 } else {
@@ -462,26 +496,25 @@ data class WWWEventArea(
 
             cachePolygonsIfLoaded(tempPolygons)
         }
-
-        return cachedAreaPolygons ?: emptyList()
     }
 
     /**
      * Caches polygons and notifies if polygons were successfully loaded
      */
-    private fun cachePolygonsIfLoaded(tempPolygons: MutableArea) {
+    private fun cachePolygonsIfLoaded(tempPolygons: MutableArea): AreaGeometryCache.Entry? {
         val hasPolygons = tempPolygons.isNotEmpty()
 
         if (hasPolygons) {
-            // Atomically assign the complete immutable list
-            cachedAreaPolygons = tempPolygons.toList()
+            // Publish the complete immutable list, indexed here so the first position check does not pay for it
+            val entry = geometryCache.put(geometryKey, event.id, tempPolygons.toList())
 
             // Clear position check cache since polygon data changed
             cachedPositionWithinResult = null
             cachedBoundingBox = null
 
-            // Notify that polygon data is now available
+            // Notify that polygon data is now available (stays true after an eviction, reloads are transparent)
             _polygonsLoaded.value = true
+            return entry
         } else {
             // DON'T cache empty list - allow retry when file becomes available
             // This prevents permanent rejection if file I/O races with first position check
@@ -489,6 +522,7 @@ data class WWWEventArea(
             if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
                 Log.i("WWWEventArea", "cachePolygonsIfLoaded: ${event.id} polygons not yet available, will retry on next call")
             }
+            return null
         }
     }
 
@@ -33,6 +33,8 @@ import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
 import com.worldwidewaves.shared.events.utils.IClock
 import com.worldwidewaves.shared.position.PositionManager
 import com.worldwidewaves.shared.utils.Log
+import com.worldwidewaves.shared.utils.RenderStage
+import com.worldwidewaves.shared.utils.RenderTrace
 import kotlinx.atomicfu.atomic
 import kotlinx.coroutines.Job
 import kotlinx.coroutines.cancelAndJoin
@@ -197,6 +199,12 @@ class WWWEventObserver(
         } catch (_: Exception) {
             null // Gracefully handle missing content provider (tests)
         }
+    private val mapPrefetcher: com.worldwidewaves.shared.map.MapPrefetcher? =
+        try {
+            get()
+        } catch (_: Exception) {
+            null // Gracefully handle missing prefetcher (tests)
+        }
 
     // -- Specialized Components (Facade Pattern) --
 
@@ -424,11 +432,12 @@ class WWWEventObserver(
     /**
      * Updates all state flows based on the current event state.
      * Delegates to WaveHitDetector for state calculation and EventProgressionState for updates.
+     * Traced as [RenderStage.OBSERVER_UPDATE], the first stage of the wave render chain.
      */
     private suspend fun updateStates(
         progression: Double,
         status: Status,
-    ) {
+    ): Unit = RenderTrace.trace(RenderStage.OBSERVER_UPDATE, event.id) {
         // User in area - ensure immediate detection alongside PositionObserver
         updateAreaDetection()
         val userIsInArea = progressionState.userIsInArea.value
@@ -469,6 +478,9 @@ class WWWEventObserver(
 
                 // Phase 4: Detect wave hit transition and trigger immediate notification
                 detectAndNotifyWaveHit(calculatedState)
+
+                // Warm the event map before the user reaches the wave screen
+                prefetchMapIfNeeded(userIsInArea)
             } else {
                 // Fall back to basic state updates for safety
                 progressionState.updateProgressionAndStatus(progression, status)
@@ -486,6 +498,21 @@ class WWWEventObserver(
         }
     }
 
+    /**
+     * Hands the tick to [com.worldwidewaves.shared.map.MapPrefetcher] for events the user is
+     * likely to open (inside the area, or favorite). No-op once the map was prefetched.
+     */
+    private suspend fun prefetchMapIfNeeded(userIsInArea: Boolean) {
+        val prefetcher = mapPrefetcher ?: return
+        try {
+            prefetcher.onObservation(event, isRelevant = userIsInArea || event.favorite)
+        } catch (e: kotlinx.coroutines.CancellationException) {
+            handleCancellationException(e)
+        } catch (e: Exception) {
+            Log.w("WWWEventObserver", "Map prefetch check failed for event ${event.id}: $e")
+        }
+    }
+
     /**
      * Gets the current EventState from the StateFlow values.
      * Delegates to WaveHitDetector for state creation.
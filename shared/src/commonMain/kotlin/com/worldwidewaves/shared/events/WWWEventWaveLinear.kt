@@ -23,8 +23,11 @@ package com.worldwidewaves.shared.events
 
 import com.worldwidewaves.shared.events.geometry.PolygonTransformations.SplitResult
 import com.worldwidewaves.shared.events.geometry.PolygonTransformations.splitByLongitude
+import com.worldwidewaves.shared.events.io.WaveKeyframeStore
 import com.worldwidewaves.shared.events.utils.Area
+import com.worldwidewaves.shared.events.utils.BoundingBox
 import com.worldwidewaves.shared.events.utils.ComposedLongitude
+import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
 import com.worldwidewaves.shared.events.utils.EarthAdaptedSpeedLongitude
 import com.worldwidewaves.shared.events.utils.GeoUtils.calculateDistance
 import com.worldwidewaves.shared.events.utils.MutableArea
@@ -32,6 +35,7 @@ import com.worldwidewaves.shared.events.utils.Position
 import kotlinx.serialization.Serializable
 import kotlinx.serialization.Transient
 import org.koin.core.component.KoinComponent
+import org.koin.core.component.inject
 import kotlin.math.abs
 import kotlin.time.Duration
 import kotlin.time.Duration.Companion.seconds
@@ -48,6 +52,8 @@ data class WWWEventWaveLinear(
     override val approxDuration: Int,
 ) : WWWEventWave(),
     KoinComponent {
+    private val coroutineScopeProvider: CoroutineScopeProvider by inject()
+
     @Transient private var cachedLongitude: EarthAdaptedSpeedLongitude? = null
 
     @Transient private var cachedWaveDuration: Duration? = null
@@ -56,6 +62,11 @@ data class WWWEventWaveLinear(
 
     @Transient private var cachedHitPosition: Position? = null
 
+    // Persisted wave front keyframes (see WaveKeyframeStore)
+    @Transient private var keyframeRestoreAttempted = false
+
+    @Transient private var lastKeyframeIndex = -1L
+
     @Transient private val epsilonLatPosition = 0.000009
 
     // Approximately 1 meter
@@ -76,6 +87,12 @@ data class WWWEventWaveLinear(
             return null
         }
 
+        // Reopened during the wave: first frame from the last session's split, before the area is even loaded
+        if (!keyframeRestoreAttempted) {
+            keyframeRestoreAttempted = true
+            restoreKeyframe(elapsedTime)?.let { return it }
+        }
+
         val composedLongitude = // Compose an earth-aware speed longitude with bands
             (cachedLongitude ?: EarthAdaptedSpeedLongitude(bbox(), speed, direction).also { cachedLongitude = it })
                 .withProgression(elapsedTime)
@@ -90,6 +107,7 @@ data class WWWEventWaveLinear(
 
         val hasPolygons = traversedPolygons.isNotEmpty() || remainingPolygons.isNotEmpty()
         return if (hasPolygons) {
+            persistKeyframe(elapsedTime, traversedPolygons, remainingPolygons)
             WavePolygons(
                 clock.now(),
                 traversedPolygons,
@@ -100,6 +118,41 @@ data class WWWEventWaveLinear(
         }
     }
 
+    /** Identifies the wave parameters a keyframe was computed for; the area itself is tracked by MapStore. */
+    private fun keyframeKey(): String = "linear;$speed;$direction;${event.area.bbox.orEmpty()}"
+
+    private suspend fun restoreKeyframe(elapsedTime: Duration): WavePolygons? {
+        val keyframe = WaveKeyframeStore.load(event.id, keyframeKey()) ?: return null
+        val lag = elapsedTime - keyframe.elapsed
+        if (lag < Duration.ZERO || lag > WaveKeyframeStore.MAX_RESTORE_LAG) return null
+
+        lastKeyframeIndex = keyframe.elapsed.keyframeIndex()
+        return WavePolygons(
+            event.getWaveStartDateTime() + keyframe.elapsed,
+            keyframe.traversedPolygons,
+            keyframe.remainingPolygons,
+        )
+    }
+
+    /** Writes the split in the background, at most once per [WaveKeyframeStore.KEYFRAME_INTERVAL]. */
+    private fun persistKeyframe(
+        elapsedTime: Duration,
+        traversed: Area,
+        remaining: Area,
+    ) {
+        val index = elapsedTime.keyframeIndex()
+        if (index == lastKeyframeIndex) return
+        lastKeyframeIndex = index
+
+        val eventId = event.id
+        val key = keyframeKey()
+        coroutineScopeProvider.launchIO {
+            WaveKeyframeStore.save(eventId, key, WaveKeyframeStore.Keyframe(elapsedTime, traversed, remaining))
+        }
+    }
+
+    private fun Duration.keyframeIndex(): Long = inWholeMilliseconds / WaveKeyframeStore.KEYFRAME_INTERVAL.inWholeMilliseconds
+
     /**
      * Splits the area polygons along a composed longitude and categorizes them based on wave direction.
      *
@@ -182,15 +235,8 @@ data class WWWEventWaveLinear(
         val waveStartTime = event.getWaveStartDateTime()
         val bbox = bbox()
 
-        // Calculate the distance from the wave starting position to the user position
-        val distanceToUser =
-            when (direction) {
-                Direction.EAST -> calculateDistance(bbox.minLongitude, userPosition.lng, userPosition.lat)
-                Direction.WEST -> calculateDistance(bbox.maxLongitude, userPosition.lng, userPosition.lat)
-            }
-
         // Calculate the time it will take for the wave to reach the user from its START position
-        val timeToReachUserInSeconds = distanceToUser / speed
+        val timeToReachUserInSeconds = arrivalOffsetSeconds(bbox, userPosition.lat, userPosition.lng)
 
         // Calculate the exact hit time by adding the time to reach to the wave START time
         val hitDateTime = waveStartTime + timeToReachUserInSeconds.seconds
@@ -202,6 +248,23 @@ data class WWWEventWaveLinear(
         return hitDateTime
     }
 
+    /**
+     * Seconds from wave start until the front reaches ([lat], [lng]): distance from the
+     * starting edge of [bbox] along the parallel, divided by the wave speed.
+     */
+    private fun arrivalOffsetSeconds(
+        bbox: BoundingBox,
+        lat: Double,
+        lng: Double,
+    ): Double {
+        val distance =
+            when (direction) {
+                Direction.EAST -> calculateDistance(bbox.minLongitude, lng, lat)
+                Direction.WEST -> calculateDistance(bbox.maxLongitude, lng, lat)
+            }
+        return distance / speed
+    }
+
     /**
      * Returns cached hit datetime if the user hasn't moved significantly
      */
@@ -79,6 +79,16 @@ class WWWEventWaveWarming(
         return note
     }
 
+    /**
+     * Queue the choreography tone for [hitTime] so it starts exactly at the user's hit,
+     * and return the MIDI pitch (or `null` if no note is active then).
+     */
+    suspend fun scheduleSoundChoreographyTone(hitTime: Instant): Int? {
+        val note = soundChoreographyPlayer.scheduleSoundTone(event.getStartDateTime(), hitTime)
+        notifyDebug(note)
+        return note
+    }
+
     /**
      * Try to inform the optional debug overlay that a note has been played.
      *
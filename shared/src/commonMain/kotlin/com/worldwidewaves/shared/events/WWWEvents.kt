@@ -23,12 +23,17 @@ package com.worldwidewaves.shared.events
 
 import com.worldwidewaves.shared.data.InitFavoriteEvent
 import com.worldwidewaves.shared.domain.usecases.SyncNotificationsOnAppLaunch
+import com.worldwidewaves.shared.events.config.EventsConfigurationDiff
 import com.worldwidewaves.shared.events.config.EventsConfigurationProvider
 import com.worldwidewaves.shared.events.decoding.EventsDecoder
 import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
 import com.worldwidewaves.shared.utils.Log
 import com.worldwidewaves.shared.utils.PerformanceTracer
+import kotlinx.coroutines.CancellationException
 import kotlinx.coroutines.Job
+import kotlinx.coroutines.async
+import kotlinx.coroutines.awaitAll
+import kotlinx.coroutines.coroutineScope
 import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.flow.asStateFlow
@@ -54,6 +59,8 @@ import kotlin.time.ExperimentalTime
  * • Provide simple callback registration helpers so view-models / screens know
  *   when the catalogue is ready or if loading failed
  * • Cache the load job behind a mutex to guarantee a single concurrent fetch
+ * • Validate events in parallel, and apply configuration updates per event
+ *   ([reloadEvents]) instead of rebuilding the whole catalogue
  *
  * All UI view-models (e.g. `EventsViewModel`) and Compose screens observe the
  * StateFlow exposed by this service to drive their lists or selectors.
@@ -61,6 +68,9 @@ import kotlin.time.ExperimentalTime
 class WWWEvents : KoinComponent {
     companion object {
         private const val JSON_PREVIEW_LENGTH = 200
+
+        // Events validated per coroutine: validation is cheap, one coroutine per event is not worth it
+        private const val VALIDATION_CHUNK_SIZE = 16
     }
 
     private val loadingMutex = Mutex()
@@ -76,6 +86,7 @@ class WWWEvents : KoinComponent {
     private var currentLoadJob: Job? = null
     private var eventsLoaded: Boolean = false
     private var loadingError: Exception? = null
+    private var loadedConfiguration: String? = null // Configuration of the published list, see reloadEvents
     private val validationErrors = mutableListOf<Pair<IWWWEvent, List<String>>>()
 
     private val pendingLoadedCallbacks = mutableListOf<() -> Unit>()
@@ -140,42 +151,7 @@ class WWWEvents : KoinComponent {
                 Log.i("WWWEvents.loadEventsJob", "Successfully decoded ${events.size} events")
                 trace.putMetric("events_decoded", events.size.toLong())
                 Log.i("WWWEvents.loadEventsJob", "Running validation on decoded events...")
-
-                // Restore proper validation but with error handling
-                val validatedEvents =
-                    try {
-                        confValidationErrors(events)
-                    } catch (e: Exception) {
-                        Log.e("WWWEvents.loadEventsJob", "Error during validation: ${e.message}")
-                        // Fall back to no validation if validation itself crashes
-                        events.associateWith { null }
-                    }
-
-                validatedEvents
-                    .filterValues { it?.isNotEmpty() == true } // Log validation errors
-                    .forEach { (event, errors) ->
-                        // errors is guaranteed non-null and non-empty by filterValues above
-                        val errorList = errors ?: return@forEach
-                        Log.e("WWWEvents.loadEventsJob", "Validation Errors for Event ID: ${event.id}")
-                        errorList.forEach { errorMessage ->
-                            Log.e("WWWEvents.loadEventsJob", errorMessage)
-                        }
-                        validationErrors.add(event to errorList)
-                    }
-
-                // Filter out invalid events and initialize favorites
-                val validEvents =
-                    validatedEvents
-                        .filterValues { it.isNullOrEmpty() }
-                        .keys
-                        .onEach {
-                            try {
-                                initFavoriteEvent.call(it)
-                                Log.d("WWWEvents.loadEventsJob", "Initialized favorite for event: ${it.id}")
-                            } catch (e: Exception) {
-                                Log.e("WWWEvents.loadEventsJob", "Error initializing favorite for event ${it.id}: ${e.message}")
-                            }
-                        }.toList()
+                val validEvents = validateAndInitialize(events)
 
                 Log.i("WWWEvents.loadEventsJob", "After validation: ${validEvents.size} valid events out of ${events.size} total")
                 trace.putMetric("events_valid", validEvents.size.toLong())
@@ -186,6 +162,7 @@ class WWWEvents : KoinComponent {
                 // Update the _eventsFlow directly (StateFlow is thread-safe)
                 try {
                     _eventsFlow.value = validEvents
+                    loadedConfiguration = eventsJsonString
                     Log.i("WWWEvents.loadEventsJob", "Successfully updated events flow")
                 } catch (e: Exception) {
                     Log.e("WWWEvents.loadEventsJob", "Error updating events flow: ${e.message}")
@@ -220,10 +197,135 @@ class WWWEvents : KoinComponent {
             }
         }
 
+    /**
+     * Validates [events] in parallel chunks on the Default dispatcher, keeps the valid ones and
+     * restores their favorite flag (one store read per event, also in parallel).
+     * Events with validation errors are logged and recorded in [getValidationErrors].
+     */
+    private suspend fun validateAndInitialize(events: List<IWWWEvent>): List<IWWWEvent> {
+        // Restore proper validation but with error handling
+        val validatedEvents =
+            try {
+                if (events.size <= VALIDATION_CHUNK_SIZE) {
+                    confValidationErrors(events)
+                } else {
+                    coroutineScopeProvider.withDefaultContext {
+                        events
+                            .chunked(VALIDATION_CHUNK_SIZE)
+                            .map { chunk -> async { confValidationErrors(chunk) } }
+                            .awaitAll()
+                            .fold(LinkedHashMap<IWWWEvent, List<String>?>()) { all, chunk -> all.apply { putAll(chunk) } }
+                    }
+                }
+            } catch (e: CancellationException) {
+                throw e
+            } catch (e: Exception) {
+                Log.e("WWWEvents.loadEventsJob", "Error during validation: ${e.message}")
+                // Fall back to no validation if validation itself crashes
+                events.associateWith { null }
+            }
+
+        validatedEvents
+            .filterValues { it?.isNotEmpty() == true } // Log validation errors
+            .forEach { (event, errors) ->
+                // errors is guaranteed non-null and non-empty by filterValues above
+                val errorList = errors ?: return@forEach
+                Log.e("WWWEvents.loadEventsJob", "Validation Errors for Event ID: ${event.id}")
+                errorList.forEach { errorMessage ->
+                    Log.e("WWWEvents.loadEventsJob", errorMessage)
+                }
+                validationErrors.removeAll { it.first.id == event.id } // Replaced on reload
+                validationErrors.add(event to errorList)
+            }
+
+        // Filter out invalid events and initialize favorites
+        val validEvents = validatedEvents.filterValues { it.isNullOrEmpty() }.keys.toList()
+        coroutineScope {
+            validEvents
+                .map { event ->
+                    async {
+                        try {
+                            initFavoriteEvent.call(event)
+                            Log.d("WWWEvents.loadEventsJob", "Initialized favorite for event: ${event.id}")
+                        } catch (e: CancellationException) {
+                            throw e
+                        } catch (e: Exception) {
+                            Log.e("WWWEvents.loadEventsJob", "Error initializing favorite for event ${event.id}: ${e.message}")
+                        }
+                    }
+                }.awaitAll()
+        }
+        return validEvents
+    }
+
     fun confValidationErrors(events: List<IWWWEvent>) = events.associateWith(IWWWEvent::validationErrors)
 
     // ---------------------------
 
+    /**
+     * Re-reads the events configuration after it changed (e.g. an updated configuration
+     * file) and applies it incrementally: only new or modified events are decoded and
+     * validated, unchanged events keep their instance, removed ones leave the list.
+     *
+     * Observers of replaced and removed events are stopped.
+     *
+     * No-op until the first [loadEvents] completed, or when the configuration is unchanged.
+     * Not called by the app yet: the configuration is a bundled resource, it has no runtime
+     * change source to trigger a reload.
+     */
+    fun reloadEvents(): Job =
+        coroutineScopeProvider.launchIO {
+            currentLoadJob?.join()
+            loadingMutex.withLock {
+                try {
+                    applyConfigurationUpdate()
+                } catch (e: CancellationException) {
+                    throw e
+                } catch (e: Exception) {
+                    // Keep the current catalogue, a broken update must not empty the list
+                    Log.e("WWWEvents.reloadEvents", "Error applying events configuration update: ${e.message}", e)
+                }
+            }
+        }
+
+    private suspend fun applyConfigurationUpdate() {
+        val previousConfiguration = loadedConfiguration ?: return
+        val eventsJsonString = eventsConfigurationProvider.geoEventsConfiguration()
+        if (eventsJsonString == previousConfiguration) {
+            Log.d("WWWEvents.reloadEvents", "Events configuration unchanged")
+            return
+        }
+
+        val diff = EventsConfigurationDiff.between(previousConfiguration, eventsJsonString)
+        // Errors of modified or removed events are stale, the changed ones are validated again
+        validationErrors.removeAll { (event, _) -> !diff.isUnchanged(event.id) }
+        val updatedEvents =
+            if (diff.changed.isEmpty()) {
+                emptyList()
+            } else {
+                validateAndInitialize(eventsDecoder.decodeFromJson(diff.changedConfiguration()))
+            }.associateBy { it.id }
+        val currentEvents = list().associateBy { it.id }
+
+        val events = diff.ids.mapNotNull { id -> updatedEvents[id] ?: currentEvents[id]?.takeIf { diff.isUnchanged(id) } }
+        _eventsFlow.value = events
+        // Replaced and removed instances leave the list: their observers must not keep running
+        currentEvents.values.filter { event -> events.none { it === event } }.forEach { event ->
+            try {
+                event.observer.stopObservation()
+            } catch (e: Exception) {
+                Log.e("WWWEvents.reloadEvents", "Error stopping observer for ${event.id}: $e", e)
+            }
+        }
+        loadedConfiguration = eventsJsonString
+        Log.i(
+            "WWWEvents.reloadEvents",
+            "Applied events configuration update: ${diff.changed.size} events decoded, ${events.size} events listed",
+        )
+    }
+
+    // ---------------------------
+
     fun flow(): StateFlow<List<IWWWEvent>> = eventsFlow
 
     fun list(): List<IWWWEvent> = eventsFlow.value
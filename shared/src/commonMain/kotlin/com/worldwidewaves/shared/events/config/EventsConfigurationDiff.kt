@@ -0,0 +1,78 @@
+package com.worldwidewaves.shared.events.config
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonArray
+import kotlinx.serialization.json.JsonElement
+import kotlinx.serialization.json.JsonObject
+import kotlinx.serialization.json.JsonPrimitive
+import kotlinx.serialization.json.contentOrNull
+import kotlinx.serialization.json.jsonArray
+
+/**
+ * Per-event difference between two events configurations (JSON arrays of events).
+ *
+ * Events are matched by `id` and compared as JSON trees, so an update only decodes and
+ * validates the events whose definition changed; the others keep their loaded instance
+ * (observer, cached area, favorite flag).
+ *
+ * @property ids Event ids of the current configuration, in configuration order
+ * @property changed Current definitions of the new or modified events (and of entries without an id)
+ */
+internal class EventsConfigurationDiff private constructor(
+    val ids: List<String>,
+    val changed: List<JsonElement>,
+    private val unchangedIds: Set<String>,
+) {
+    companion object {
+        /** @throws IllegalArgumentException if either configuration is not a JSON array */
+        fun between(
+            previous: String,
+            current: String,
+        ): EventsConfigurationDiff {
+            val previousById = Json.parseToJsonElement(previous).jsonArray.associateBy(::idOf)
+            val currentElements = Json.parseToJsonElement(current).jsonArray
+
+            val ids = mutableListOf<String>()
+            val changed = mutableListOf<JsonElement>()
+            val unchanged = mutableSetOf<String>()
+            currentElements.forEach { element ->
+                val id = idOf(element)
+                if (id != null) ids += id
+                if (id != null && previousById[id] == element) unchanged += id else changed += element
+            }
+            return EventsConfigurationDiff(ids, changed, unchanged)
+        }
+
+        private fun idOf(element: JsonElement): String? {
+            val id = (element as? JsonObject)?.get("id") as? JsonPrimitive
+            return id?.contentOrNull
+        }
+    }
+
+    /** Changed definitions as a configuration string, for the events decoder. */
+    fun changedConfiguration(): String = JsonArray(changed).toString()
+
+    fun isUnchanged(id: String): Boolean = id in unchangedIds
+}
@@ -0,0 +1,230 @@
+package com.worldwidewaves.shared.events.geometry
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Area
+import com.worldwidewaves.shared.utils.Log
+import kotlinx.atomicfu.atomic
+import kotlinx.atomicfu.locks.reentrantLock
+import kotlinx.atomicfu.locks.withLock
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.minutes
+
+/**
+ * Process-wide, memory-bounded cache of loaded event areas and their [AreaSpatialIndex].
+ *
+ * A country or megacity multipolygon weighs tens of MB once parsed and indexed, and every
+ * event area used to keep its own copy for the whole process. Areas now live here under one
+ * byte budget and [WWWEventArea][com.worldwidewaves.shared.events.WWWEventArea] reloads an
+ * evicted area from its preprocessed file on next use.
+ *
+ * ## Eviction
+ * Least recently used first, except for *resident* areas: events whose next scheduled
+ * observation (reported by the observation scheduler through [noteNextObservation]) is within
+ * [RESIDENT_WINDOW]. Those are about to start or running, and reloading them mid-wave would
+ * stall position checks. They are only evicted when the budget cannot be met otherwise, the
+ * one observed furthest in the future first. The entry being inserted is never evicted, so an
+ * area larger than the whole budget still loads.
+ *
+ * ## Memory pressure
+ * [trim] is called from the platform memory warnings (iOS `didReceiveMemoryWarning`, Android
+ * `onTrimMemory`) and never drops resident areas.
+ *
+ * Sizes are estimated from vertex counts (see [VERTEX_BYTES]); the budget bounds the order
+ * of magnitude, not an exact heap figure.
+ *
+ * Thread-safe.
+ */
+class AreaGeometryCache(
+    val budgetBytes: Long = DEFAULT_BUDGET_BYTES,
+) {
+    companion object {
+        private const val TAG = "WWW.Geometry.Cache"
+
+        const val DEFAULT_BUDGET_BYTES = 48L * 1024 * 1024
+
+        /** Areas of events observed again within this delay are kept resident. */
+        val RESIDENT_WINDOW: Duration = 10.minutes
+
+        /**
+         * Estimated bytes per vertex: the [Position][com.worldwidewaves.shared.events.utils.Position]
+         * node and its `positionsIndex` entry (~96) plus the packed coordinates and edge strips of
+         * the spatial index (~24).
+         */
+        internal const val VERTEX_BYTES = 120L
+
+        /** Estimated fixed cost of one polygon (object, bbox, index map and packed ring headers). */
+        internal const val POLYGON_BYTES = 256L
+
+        private const val BYTES_PER_MB = 1024.0 * 1024.0
+
+        /** Cache shared by every event area of the process. */
+        val shared: AreaGeometryCache by lazy { AreaGeometryCache() }
+
+        fun estimateBytes(polygons: Area): Long = polygons.sumOf { POLYGON_BYTES + it.size * VERTEX_BYTES }
+    }
+
+    /** A loaded area and what is derived from it. Immutable, may be used after eviction. */
+    class Entry internal constructor(
+        val eventId: String,
+        val polygons: Area,
+        val spatialIndex: AreaSpatialIndex,
+        val bytes: Long,
+    )
+
+    enum class TrimLevel {
+        /** Down to half the budget (app in background, device getting low). */
+        MODERATE,
+
+        /** Every non-resident area (memory warning, process about to be killed). */
+        CRITICAL,
+    }
+
+    private val lock = reentrantLock()
+
+    // Iteration order is access order: least recently used first (get re-inserts)
+    private val entries = LinkedHashMap<Long, Entry>()
+    private val nextObservationDelays = mutableMapOf<String, Duration>()
+    private var totalBytes = 0L
+    private val keys = atomic(0L)
+
+    /** A fresh key; each event area instance owns one, so a reloaded event list never sees stale polygons. */
+    fun newKey(): Long = keys.incrementAndGet()
+
+    /** The entry cached under [key], marked as most recently used. */
+    fun get(key: Long): Entry? =
+        lock.withLock {
+            entries.remove(key)?.also { entries[key] = it }
+        }
+
+    /**
+     * Caches [polygons] under [key] with their spatial index (built outside the lock), then
+     * evicts down to the budget.
+     */
+    fun put(
+        key: Long,
+        eventId: String,
+        polygons: Area,
+    ): Entry {
+        val entry = Entry(eventId, polygons, AreaSpatialIndex.fromArea(polygons), estimateBytes(polygons))
+        val evicted =
+            lock.withLock {
+                entries.remove(key)?.let { totalBytes -= it.bytes }
+                entries[key] = entry
+                totalBytes += entry.bytes
+                evictLocked(budgetBytes, keep = key, evictResident = true)
+            }
+        logEvicted(evicted, "budget")
+        return entry
+    }
+
+    fun remove(key: Long) {
+        lock.withLock {
+            entries.remove(key)?.let { totalBytes -= it.bytes }
+        }
+    }
+
+    /**
+     * Records when [eventId] is observed next; null once its observation stopped.
+     * Hints are kept per event id, so they apply to every area instance of the event.
+     */
+    fun noteNextObservation(
+        eventId: String,
+        delay: Duration?,
+    ) {
+        lock.withLock {
+            if (delay == null) nextObservationDelays.remove(eventId) else nextObservationDelays[eventId] = delay
+        }
+    }
+
+    /** Releases memory on platform pressure; returns the number of areas evicted. */
+    fun trim(level: TrimLevel): Int {
+        val target =
+            when (level) {
+                TrimLevel.MODERATE -> budgetBytes / 2
+                TrimLevel.CRITICAL -> 0L
+            }
+        val evicted = lock.withLock { evictLocked(target, keep = null, evictResident = false) }
+        logEvicted(evicted, "trim ${level.name}")
+        return evicted.size
+    }
+
+    fun sizeBytes(): Long = lock.withLock { totalBytes }
+
+    fun size(): Int = lock.withLock { entries.size }
+
+    internal fun clear() {
+        lock.withLock {
+            entries.clear()
+            nextObservationDelays.clear()
+            totalBytes = 0L
+        }
+    }
+
+    // ---------------------------
+
+    private fun evictLocked(
+        targetBytes: Long,
+        keep: Long?,
+        evictResident: Boolean,
+    ): List<Entry> {
+        if (totalBytes <= targetBytes) return emptyList()
+
+        val (resident, others) = entries.entries.filter { it.key != keep }.partition { isResidentLocked(it.value.eventId) }
+        val order =
+            others.map { it.key } +
+                if (evictResident) {
+                    resident.sortedByDescending { nextObservationDelays[it.value.eventId] }.map { it.key }
+                } else {
+                    emptyList()
+                }
+
+        val evicted = mutableListOf<Entry>()
+        for (key in order) {
+            if (totalBytes <= targetBytes) break
+            entries.remove(key)?.let {
+                totalBytes -= it.bytes
+                evicted += it
+            }
+        }
+        return evicted
+    }
+
+    private fun isResidentLocked(eventId: String): Boolean = nextObservationDelays[eventId]?.let { it <= RESIDENT_WINDOW } == true
+
+    private fun logEvicted(
+        evicted: List<Entry>,
+        reason: String,
+    ) {
+        if (evicted.isEmpty()) return
+        val freed = evicted.sumOf { it.bytes } / BYTES_PER_MB
+        val cached = sizeBytes() / BYTES_PER_MB
+        Log.i(
+            TAG,
+            "Evicted ${evicted.size} areas (${evicted.joinToString { it.eventId }}) on $reason: " +
+                "freed ${freed.format1()} MB, ${cached.format1()} MB cached",
+        )
+    }
+
+    private fun Double.format1(): String = (kotlin.math.round(this * 10) / 10).toString()
+}
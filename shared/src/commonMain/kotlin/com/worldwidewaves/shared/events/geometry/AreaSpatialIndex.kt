@@ -0,0 +1,243 @@
+package com.worldwidewaves.shared.events.geometry
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Area
+import com.worldwidewaves.shared.events.utils.PackedPolygon
+import com.worldwidewaves.shared.events.utils.Position
+import com.worldwidewaves.shared.events.utils.packed
+import kotlin.math.abs
+import kotlin.math.max
+import kotlin.math.min
+import kotlin.math.sqrt
+
+/**
+ * Two-level spatial index over an event area, for position-within tests.
+ *
+ * 1. **Area grid**: uniform grid over the area bbox; each cell lists the rings whose bbox
+ *    overlaps it. A query only looks at the rings of one cell.
+ * 2. **Edge strips** (per ring): the ring's latitude range is cut into horizontal strips; each
+ *    strip lists the edges whose latitude span overlaps it. The ray-casting ray is horizontal,
+ *    so the edges of the tap's strip are exactly the edges that can cross it and the result is
+ *    the same as a full [PackedPolygon.containsPosition] scan.
+ *
+ * Buckets are stored in CSR form (one offsets `IntArray`, one items `IntArray`) so the index is
+ * a handful of flat arrays, built once per loaded area.
+ *
+ * **Time Complexity**:
+ * - Build: O(n) for n edges (plus the strips each edge spans)
+ * - Query: O(rings per cell × edges per strip), typically tens of edges
+ *
+ * Immutable after construction, safe to share between threads.
+ *
+ * @see PolygonOperations.isPointInPackedPolygons for the unindexed equivalent
+ */
+class AreaSpatialIndex private constructor(
+    val polygons: List<PackedPolygon>,
+    private val ringIndices: List<RingIndex?>,
+    private val minLat: Double,
+    private val minLng: Double,
+    private val maxLat: Double,
+    private val maxLng: Double,
+    private val gridSize: Int,
+    private val cellOffsets: IntArray,
+    private val cellRings: IntArray,
+) {
+    companion object {
+        /** Rings below this vertex count are scanned directly. */
+        private const val MIN_INDEXED_VERTICES = 64
+        private const val EDGES_PER_STRIP = 8
+        private const val MAX_STRIPS = 4096
+        private const val MAX_GRID_SIZE = 32
+        private const val VERTEX_EPSILON = 1e-12
+
+        fun fromArea(area: Area): AreaSpatialIndex = build(area.packed())
+
+        fun build(polygons: List<PackedPolygon>): AreaSpatialIndex {
+            val rings = polygons.filter { it.size >= 3 }
+            val ringIndices = rings.map { if (it.size >= MIN_INDEXED_VERTICES) RingIndex.build(it) else null }
+            if (rings.isEmpty()) {
+                return AreaSpatialIndex(rings, ringIndices, 0.0, 0.0, 0.0, 0.0, 1, IntArray(2), IntArray(0))
+            }
+
+            val minLat = rings.minOf { it.minLat }
+            val minLng = rings.minOf { it.minLng }
+            val maxLat = rings.maxOf { it.maxLat }
+            val maxLng = rings.maxOf { it.maxLng }
+            val gridSize = sqrt(rings.size.toDouble()).toInt().coerceIn(1, MAX_GRID_SIZE)
+
+            val buckets =
+                CsrBuilder(gridSize * gridSize).apply {
+                    rings.forEachIndexed { ringIndex, ring ->
+                        val row0 = cellOf(ring.minLat, minLat, maxLat, gridSize)
+                        val row1 = cellOf(ring.maxLat, minLat, maxLat, gridSize)
+                        val col0 = cellOf(ring.minLng, minLng, maxLng, gridSize)
+                        val col1 = cellOf(ring.maxLng, minLng, maxLng, gridSize)
+                        for (row in row0..row1) {
+                            for (col in col0..col1) add(row * gridSize + col, ringIndex)
+                        }
+                    }
+                }
+
+            return AreaSpatialIndex(
+                rings,
+                ringIndices,
+                minLat,
+                minLng,
+                maxLat,
+                maxLng,
+                gridSize,
+                buckets.offsets(),
+                buckets.items(),
+            )
+        }
+
+        private fun cellOf(
+            value: Double,
+            min: Double,
+            max: Double,
+            count: Int,
+        ): Int {
+            val span = max - min
+            if (span <= 0.0) return 0
+            return ((value - min) / span * count).toInt().coerceIn(0, count - 1)
+        }
+    }
+
+    /** Total vertex count of the indexed rings. */
+    val vertexCount: Int get() = polygons.sumOf { it.size }
+
+    fun containsPosition(position: Position): Boolean = containsPosition(position.lat, position.lng)
+
+    /** Same result as `isPointInPackedPolygons(position, polygons)`. */
+    fun containsPosition(
+        lat: Double,
+        lng: Double,
+    ): Boolean {
+        if (polygons.isEmpty() || lat < minLat || lat > maxLat || lng < minLng || lng > maxLng) return false
+
+        val cell = cellOf(lat, minLat, maxLat, gridSize) * gridSize + cellOf(lng, minLng, maxLng, gridSize)
+        for (k in cellOffsets[cell] until cellOffsets[cell + 1]) {
+            val ringIndex = cellRings[k]
+            val ring = polygons[ringIndex]
+            if (!ring.bboxContains(lat, lng)) continue
+            val inside = ringIndices[ringIndex]?.contains(ring, lat, lng) ?: ring.containsPosition(lat, lng)
+            if (inside) return true
+        }
+        return false
+    }
+
+    // ------------------------------------------------------------------------
+
+    /**
+     * Horizontal edge strips of one ring. Edge `i` goes from vertex `i` to vertex `i + 1`
+     * (wrapping to 0).
+     */
+    private class RingIndex(
+        private val minLat: Double,
+        private val maxLat: Double,
+        private val stripCount: Int,
+        private val stripOffsets: IntArray,
+        private val stripEdges: IntArray,
+    ) {
+        companion object {
+            fun build(ring: PackedPolygon): RingIndex {
+                val n = ring.size
+                val stripCount = max(1, min(MAX_STRIPS, n / EDGES_PER_STRIP))
+                val buckets = CsrBuilder(stripCount)
+                for (i in 0 until n) {
+                    val j = if (i + 1 == n) 0 else i + 1
+                    // Pad by the vertex epsilon so near-vertex taps see the vertex in their strip
+                    val low = min(ring.lat(i), ring.lat(j)) - VERTEX_EPSILON
+                    val high = max(ring.lat(i), ring.lat(j)) + VERTEX_EPSILON
+                    val s0 = cellOf(low, ring.minLat, ring.maxLat, stripCount)
+                    val s1 = cellOf(high, ring.minLat, ring.maxLat, stripCount)
+                    for (s in s0..s1) buckets.add(s, i)
+                }
+                return RingIndex(ring.minLat, ring.maxLat, stripCount, buckets.offsets(), buckets.items())
+            }
+        }
+
+        /** Ray-casting over the tap's strip; same semantics as [PackedPolygon.containsPosition]. */
+        fun contains(
+            ring: PackedPolygon,
+            lat: Double,
+            lng: Double,
+        ): Boolean {
+            val n = ring.size
+            val strip = cellOf(lat, minLat, maxLat, stripCount)
+            var inside = false
+            for (k in stripOffsets[strip] until stripOffsets[strip + 1]) {
+                val i = stripEdges[k]
+                val j = if (i + 1 == n) 0 else i + 1
+                val xi = ring.lng(i)
+                val yi = ring.lat(i)
+                if (abs(xi - lng) < VERTEX_EPSILON && abs(yi - lat) < VERTEX_EPSILON) return true
+
+                val yj = ring.lat(j)
+                if ((yi > lat) != (yj > lat)) {
+                    val xj = ring.lng(j)
+                    if (lng < (xj - xi) * (lat - yi) / (yj - yi) + xi) inside = !inside
+                }
+            }
+            return inside
+        }
+    }
+
+    /** Two-pass CSR bucket builder: collects (bucket, item) pairs, then lays them out flat. */
+    private class CsrBuilder(
+        private val bucketCount: Int,
+    ) {
+        private var buckets = IntArray(16)
+        private var values = IntArray(16)
+        private var count = 0
+
+        fun add(
+            bucket: Int,
+            value: Int,
+        ) {
+            if (count == buckets.size) {
+                buckets = buckets.copyOf(count * 2)
+                values = values.copyOf(count * 2)
+            }
+            buckets[count] = bucket
+            values[count] = value
+            count++
+        }
+
+        private val offsets: IntArray by lazy {
+            val result = IntArray(bucketCount + 1)
+            for (k in 0 until count) result[buckets[k] + 1]++
+            for (b in 0 until bucketCount) result[b + 1] += result[b]
+            result
+        }
+
+        fun offsets(): IntArray = offsets
+
+        fun items(): IntArray {
+            val cursor = offsets.copyOf(bucketCount)
+            val result = IntArray(count)
+            for (k in 0 until count) result[cursor[buckets[k]]++] = values[k]
+            return result
+        }
+    }
+}
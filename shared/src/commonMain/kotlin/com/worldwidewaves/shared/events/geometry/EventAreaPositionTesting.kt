@@ -51,6 +51,9 @@ object EventAreaPositionTesting {
      * If it's not within the bounding box, returns false immediately.
      * If it is within the bounding box, it then checks if the position is within
      * the polygons using the ray-casting algorithm.
+     *
+     * When [spatialIndex] (built over the same rings as [polygons]) is given, the polygon test
+     * only looks at the rings and edges near the position.
      */
     @Suppress("ReturnCount") // Early returns for guard clauses improve readability
     suspend fun isPositionWithin(
@@ -58,6 +61,7 @@ object EventAreaPositionTesting {
         bbox: BoundingBox,
         polygons: Area,
         cachedPositionWithinResult: Pair<Position, Boolean>?,
+        spatialIndex: AreaSpatialIndex? = null,
     ): Pair<Boolean, Pair<Position, Boolean>?> {
         // Check if the cached result is within the epsilon
         val cachedResult = getCachedPositionResultIfValid(position, cachedPositionWithinResult)
@@ -81,7 +85,12 @@ object EventAreaPositionTesting {
             return Pair(false, null)
         }
 
-        val result = isPointInPolygons(position, polygons)
+        val result =
+            if (spatialIndex != null) {
+                spatialIndex.containsPosition(position)
+            } else {
+                isPointInPolygons(position, polygons)
+            }
 
         // Return result with new cached value
         return Pair(result, Pair(position, result))
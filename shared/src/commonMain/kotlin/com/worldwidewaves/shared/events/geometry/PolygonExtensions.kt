@@ -72,3 +72,23 @@ import com.worldwidewaves.shared.events.utils.Position
  */
 val List<Position>.toPolygon: Polygon
     get() = Polygon().apply { this@toPolygon.forEach { add(it) } }
+
+/**
+ * 64-bit FNV-1a fingerprint of the polygon's vertex coordinates, in order.
+ *
+ * Two polygons with the same vertices produce the same value, whatever their identity or
+ * position ids. Used to detect unchanged rings between wave frames without keeping copies.
+ *
+ * **Time Complexity**: O(n), no allocation
+ */
+fun Polygon.contentFingerprint(): Long {
+    var hash = FNV_OFFSET_BASIS xor size.toLong()
+    forEach { position ->
+        hash = (hash xor position.lat.toRawBits()) * FNV_PRIME
+        hash = (hash xor position.lng.toRawBits()) * FNV_PRIME
+    }
+    return hash
+}
+
+private const val FNV_OFFSET_BASIS = -0x340d631b7bdddcdbL
+private const val FNV_PRIME = 0x100000001b3L
@@ -23,6 +23,7 @@ package com.worldwidewaves.shared.events.geometry
 
 import com.worldwidewaves.shared.events.utils.Area
 import com.worldwidewaves.shared.events.utils.BoundingBox
+import com.worldwidewaves.shared.events.utils.PackedPolygon
 import com.worldwidewaves.shared.events.utils.Polygon
 import com.worldwidewaves.shared.events.utils.Position
 import kotlin.math.max
@@ -346,6 +347,23 @@ object PolygonOperations {
         return false
     }
 
+    /**
+     * [isPointInPolygons] over packed rings (see [PackedPolygon]).
+     *
+     * Same result as the [Area] variant; each ring is rejected on its cached bounding box
+     * before the ray-casting loop runs over its coordinate arrays.
+     *
+     * **Time Complexity**: O(k) bbox checks + O(n) for rings whose bbox contains the point
+     *
+     * @param tap The position to test
+     * @param polygons Packed rings of the area
+     * @return true if the point is inside any ring
+     */
+    fun isPointInPackedPolygons(
+        tap: Position,
+        polygons: List<PackedPolygon>,
+    ): Boolean = polygons.any { it.containsPosition(tap.lat, tap.lng) }
+
     /**
      * Clears the spatial index cache to free memory.
      * Should be called periodically or when polygon data changes.
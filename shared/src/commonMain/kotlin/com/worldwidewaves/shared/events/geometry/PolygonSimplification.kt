@@ -0,0 +1,240 @@
+package com.worldwidewaves.shared.events.geometry
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.PI
+import kotlin.math.cos
+import kotlin.math.pow
+
+/**
+ * Polygon Simplification Module
+ *
+ * Render-only vertex decimation for event areas and wave fragments:
+ * - Douglas-Peucker simplification of closed rings
+ * - Zoom → tolerance conversion matching MapLibre's 512px tiles
+ *
+ * Event areas come from OSM boundaries with a vertex every few meters, and
+ * [PolygonTransformations.completeLongitudePoints] adds more along the cut.
+ * At city-overview zooms most of them fall inside one pixel.
+ *
+ * **Not for geometry**: simplified polygons carry no cut metadata and must
+ * never be fed back into containment tests or splitting.
+ *
+ * Key algorithms:
+ * - Douglas-Peucker: O(n log n) average, O(n²) worst case, iterative (no recursion)
+ *
+ * @see PolygonTransformations for splitting and clipping
+ */
+object PolygonSimplification {
+    private const val MIN_RING_VERTICES = 3
+    private const val TILE_SIZE_PX = 512.0
+    private const val MIN_LATITUDE_COSINE = 0.01
+
+    /**
+     * Longitude degrees covered by one screen pixel at [zoom] (Web Mercator, 512px tiles).
+     *
+     * Mercator keeps longitude-per-pixel constant across latitudes, so this is a uniform
+     * tolerance once latitudes are scaled as done in [simplify].
+     */
+    fun degreesPerPixel(zoom: Double): Double = 360.0 / (TILE_SIZE_PX * 2.0.pow(zoom))
+
+    /**
+     * Douglas-Peucker simplification of a (closed or open) ring.
+     *
+     * Distances are measured in longitude degrees with latitudes scaled by `1 / cos(lat)` at
+     * the ring's center, i.e. in local screen space. The ring is split at vertex 0 and the vertex
+     * farthest from it, and both chains are simplified independently. The result always keeps at
+     * least [MIN_RING_VERTICES] distinct vertices and the closure of the input.
+     *
+     * @param polygon Ring to simplify (not modified)
+     * @param tolerance Maximum deviation in longitude degrees (see [degreesPerPixel])
+     * @return A new polygon of the same type, or [polygon] itself when nothing can be removed
+     */
+    fun simplify(
+        polygon: Polygon,
+        tolerance: Double,
+    ): Polygon {
+        if (tolerance <= 0.0 || polygon.size <= MIN_RING_VERTICES + 1) return polygon
+
+        val closed = polygon.size > 1 && polygon.first() == polygon.last()
+        val count = if (closed) polygon.size - 1 else polygon.size
+        if (count <= MIN_RING_VERTICES) return polygon
+
+        val bbox = polygon.bbox()
+        val centerLat = (bbox.sw.lat + bbox.ne.lat) / 2.0
+        val latScale = 1.0 / cos(centerLat * PI / 180.0).coerceAtLeast(MIN_LATITUDE_COSINE)
+
+        val xs = DoubleArray(count)
+        val ys = DoubleArray(count)
+        var i = 0
+        for (position in polygon) {
+            if (i == count) break
+            xs[i] = position.lng
+            ys[i] = position.lat * latScale
+            i++
+        }
+
+        val keep = BooleanArray(count)
+        val far = farthestFrom(0, xs, ys)
+        keep[0] = true
+        keep[far] = true
+
+        val tolerance2 = tolerance * tolerance
+        markChain(xs, ys, keep, 0, far, tolerance2)
+        markChain(xs, ys, keep, far, count, tolerance2)
+        ensureMinimumVertices(xs, ys, keep, far)
+
+        val kept = keep.count { it }
+        if (kept == count) return polygon
+
+        val result = polygon.createNew()
+        var first: Position? = null
+        polygon.forEachIndexed { index, position ->
+            if (index < count && keep[index]) {
+                val added = result.add(Position(position.lat, position.lng))
+                if (first == null) first = added
+            }
+        }
+        if (closed) first?.let { result.add(Position(it.lat, it.lng)) }
+        return result
+    }
+
+    /**
+     * Simplifies every polygon of an area with the same tolerance.
+     */
+    fun simplify(
+        polygons: List<Polygon>,
+        tolerance: Double,
+    ): List<Polygon> = polygons.map { simplify(it, tolerance) }
+
+    // --------------------------------------------------------------------
+
+    /**
+     * Iterative Douglas-Peucker over vertices `start..end` (end may equal `n`, meaning vertex 0).
+     */
+    private fun markChain(
+        xs: DoubleArray,
+        ys: DoubleArray,
+        keep: BooleanArray,
+        start: Int,
+        end: Int,
+        tolerance2: Double,
+    ) {
+        val n = xs.size
+        val stack = ArrayDeque<Int>()
+        stack.addLast(start)
+        stack.addLast(end)
+
+        while (stack.isNotEmpty()) {
+            val last = stack.removeLast()
+            val first = stack.removeLast()
+            if (last - first < 2) continue
+
+            val a = first % n
+            val b = last % n
+            var maxDistance = -1.0
+            var maxIndex = -1
+            for (index in first + 1 until last) {
+                val distance = segmentDistance2(xs[index], ys[index], xs[a], ys[a], xs[b], ys[b])
+                if (distance > maxDistance) {
+                    maxDistance = distance
+                    maxIndex = index
+                }
+            }
+
+            if (maxDistance > tolerance2) {
+                keep[maxIndex] = true
+                stack.addLast(first)
+                stack.addLast(maxIndex)
+                stack.addLast(maxIndex)
+                stack.addLast(last)
+            }
+        }
+    }
+
+    /** A ring needs a third vertex off the 0–far axis to keep any area. */
+    private fun ensureMinimumVertices(
+        xs: DoubleArray,
+        ys: DoubleArray,
+        keep: BooleanArray,
+        far: Int,
+    ) {
+        if (keep.count { it } >= MIN_RING_VERTICES) return
+
+        var maxDistance = -1.0
+        var maxIndex = -1
+        for (index in xs.indices) {
+            if (keep[index]) continue
+            val distance = segmentDistance2(xs[index], ys[index], xs[0], ys[0], xs[far], ys[far])
+            if (distance > maxDistance) {
+                maxDistance = distance
+                maxIndex = index
+            }
+        }
+        if (maxIndex >= 0) keep[maxIndex] = true
+    }
+
+    private fun farthestFrom(
+        origin: Int,
+        xs: DoubleArray,
+        ys: DoubleArray,
+    ): Int {
+        var maxDistance = -1.0
+        var maxIndex = origin
+        for (index in xs.indices) {
+            val dx = xs[index] - xs[origin]
+            val dy = ys[index] - ys[origin]
+            val distance = dx * dx + dy * dy
+            if (distance > maxDistance) {
+                maxDistance = distance
+                maxIndex = index
+            }
+        }
+        return maxIndex
+    }
+
+    /** Squared distance from point P to segment AB. */
+    private fun segmentDistance2(
+        px: Double,
+        py: Double,
+        ax: Double,
+        ay: Double,
+        bx: Double,
+        by: Double,
+    ): Double {
+        val dx = bx - ax
+        val dy = by - ay
+        val length2 = dx * dx + dy * dy
+        if (length2 == 0.0) {
+            val ex = px - ax
+            val ey = py - ay
+            return ex * ex + ey * ey
+        }
+
+        val t = (((px - ax) * dx + (py - ay) * dy) / length2).coerceIn(0.0, 1.0)
+        val ex = px - (ax + t * dx)
+        val ey = py - (ay + t * dy)
+        return ex * ex + ey * ey
+    }
+}
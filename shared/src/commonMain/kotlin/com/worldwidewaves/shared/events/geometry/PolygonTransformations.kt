@@ -25,6 +25,7 @@ import com.worldwidewaves.shared.events.geometry.PolygonOperations.containsPosit
 import com.worldwidewaves.shared.events.utils.Area
 import com.worldwidewaves.shared.events.utils.BoundingBox
 import com.worldwidewaves.shared.events.utils.ComposedLongitude
+import com.worldwidewaves.shared.events.utils.PackedPolygon
 import com.worldwidewaves.shared.events.utils.Polygon
 import com.worldwidewaves.shared.events.utils.Position
 import com.worldwidewaves.shared.events.utils.Segment
@@ -238,6 +239,17 @@ object PolygonTransformations {
         workingPolygon: Polygon,
         cutLng: Double,
     ): SplitResult {
+        // Plain rings (no cut metadata to carry over) are clipped on flat coordinate arrays
+        if (workingPolygon.isCutEmpty()) {
+            val packed = PackedPolygon.fromPolygon(workingPolygon)
+            val left = packed.clipToHalfPlane(cutLng, keepLeft = true, epsilon = FLOATING_POINT_EPSILON)
+            val right = packed.clipToHalfPlane(cutLng, keepLeft = false, epsilon = FLOATING_POINT_EPSILON)
+            return SplitResult(
+                if (left.isEmpty()) emptyList() else listOf(left.toPolygon()),
+                if (right.isEmpty()) emptyList() else listOf(right.toPolygon()),
+            )
+        }
+
         val leftPts = clipToHalfPlane(workingPolygon.toList(), cutLng, keepLeft = true)
         val rightPts = clipToHalfPlane(workingPolygon.toList(), cutLng, keepLeft = false)
 
@@ -0,0 +1,235 @@
+package com.worldwidewaves.shared.events.io
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.data.getAreaFileAbsolutePath
+import com.worldwidewaves.shared.data.platformReadBytes
+import com.worldwidewaves.shared.events.utils.MutableArea
+import com.worldwidewaves.shared.events.utils.Position
+import com.worldwidewaves.shared.utils.Log
+import kotlin.math.roundToInt
+
+/**
+ * Preprocessed binary event area (`<eventId>.wwa`), produced by `scripts/maps/geojson-to-area.js`.
+ *
+ * Replaces GeoJSON text parsing on cold event open: the file is a flat little-endian layout that
+ * decodes with a single pass and no intermediate JSON tree.
+ *
+ * ## Layout (all fields little-endian Int32)
+ * ```
+ * 0   magic "WWWA"            4 bytes
+ * 4   version                 (= VERSION)
+ * 8   scale                   coordinate units per degree (1e7 ≈ 1cm)
+ * 12  ringCount
+ * 16  vertexCount
+ * 20  area bbox               minLat, minLng, maxLat, maxLng (quantized)
+ * 36  ring offsets            ringCount + 1 vertex indices
+ * ..  ring bboxes             ringCount × (minLat, minLng, maxLat, maxLng)
+ * ..  coordinates             vertexCount × (lat, lng)
+ * ```
+ * Rings are every ring of every Polygon/MultiPolygon in GeoJSON order, as written in the source
+ * file; the device applies the same bbox override clamping and ring validation as
+ * [GeoJsonAreaParser], so both sources produce the same area (to the quantization step).
+ *
+ * Sections are 4-byte aligned, so the file can be memory-mapped and read in place on platforms
+ * that support it. Bboxes are stored so tooling can inspect a file without decoding rings.
+ */
+object BinaryAreaFormat {
+    private const val TAG = "BinaryAreaFormat"
+    private const val MAGIC = 0x41575757 // "WWWA" read as little-endian Int32
+    const val VERSION = 1
+    const val DEFAULT_SCALE = 10_000_000
+    private const val HEADER_INTS = 9
+    private const val BBOX_INTS = 4
+
+    /** Decoded file: quantized rings, see [ringPositions]. */
+    class Rings internal constructor(
+        val scale: Int,
+        val ringOffsets: IntArray,
+        val coordinates: IntArray,
+    ) {
+        val ringCount: Int get() = ringOffsets.size - 1
+        val vertexCount: Int get() = coordinates.size / 2
+
+        fun ringPositions(ring: Int): List<Position> {
+            val start = ringOffsets[ring]
+            val end = ringOffsets[ring + 1]
+            val unit = 1.0 / scale
+            return List(end - start) { k ->
+                val v = (start + k) * 2
+                Position(coordinates[v] * unit, coordinates[v + 1] * unit)
+            }
+        }
+    }
+
+    /**
+     * Loads the event's binary area into [polygons], if the map module ships one.
+     *
+     * @return true if the binary file was found and decoded (even if it held no valid ring),
+     *         false if the caller should fall back to GeoJSON
+     */
+    suspend fun loadPolygons(
+        eventId: String,
+        bboxOverride: String?,
+        polygons: MutableArea,
+    ): Boolean {
+        val rings =
+            try {
+                val path = getAreaFileAbsolutePath(eventId) ?: return false
+                decode(platformReadBytes(path))
+            } catch (e: kotlinx.coroutines.CancellationException) {
+                throw e
+            } catch (e: IllegalArgumentException) {
+                Log.w(TAG, "Invalid binary area for $eventId: ${e.message}")
+                null
+            } catch (e: Exception) {
+                // The binary file is optional: any I/O problem falls back to GeoJSON
+                Log.w(TAG, "Cannot read binary area for $eventId: ${e.message}")
+                null
+            } ?: return false
+
+        val bbox = GeoJsonAreaParser.parseBboxString(bboxOverride)
+        for (ring in 0 until rings.ringCount) {
+            var positions = rings.ringPositions(ring)
+            if (bbox != null) {
+                positions =
+                    positions.map {
+                        Position(it.lat.coerceIn(bbox.sw.lat, bbox.ne.lat), it.lng.coerceIn(bbox.sw.lng, bbox.ne.lng))
+                    }
+            }
+            GeoJsonAreaParser.addRingPolygon(eventId, positions, polygons)
+        }
+        Log.i(TAG, "loadPolygons: $eventId decoded ${rings.ringCount} rings / ${rings.vertexCount} vertices")
+        return true
+    }
+
+    /**
+     * Decodes a `.wwa` file.
+     *
+     * @return The rings, or null for an empty input
+     * @throws IllegalArgumentException if the file is truncated, has a wrong magic or an unknown version
+     */
+    fun decode(bytes: ByteArray): Rings? {
+        if (bytes.isEmpty()) return null
+        require(bytes.size >= HEADER_INTS * 4) { "truncated header (${bytes.size} bytes)" }
+        require(bytes.int(0) == MAGIC) { "bad magic" }
+        val version = bytes.int(1)
+        require(version == VERSION) { "unsupported version $version" }
+
+        val scale = bytes.int(2)
+        val ringCount = bytes.int(3)
+        val vertexCount = bytes.int(4)
+        require(scale > 0 && ringCount >= 0 && vertexCount >= 0) { "invalid header" }
+
+        val offsetsStart = HEADER_INTS
+        val coordinatesStart = offsetsStart + (ringCount + 1) + ringCount * BBOX_INTS
+        val expectedInts = coordinatesStart.toLong() + vertexCount.toLong() * 2
+        require(bytes.size.toLong() == expectedInts * 4) { "size ${bytes.size} does not match header ($expectedInts ints)" }
+
+        val ringOffsets = IntArray(ringCount + 1) { bytes.int(offsetsStart + it) }
+        require(ringOffsets.first() == 0 && ringOffsets.last() == vertexCount) { "ring offsets do not cover vertices" }
+        for (i in 0 until ringCount) require(ringOffsets[i] <= ringOffsets[i + 1]) { "ring offsets not sorted" }
+
+        val coordinates = IntArray(vertexCount * 2) { bytes.int(coordinatesStart + it) }
+        return Rings(scale, ringOffsets, coordinates)
+    }
+
+    /**
+     * Encodes rings (each a list of positions, as in the source GeoJSON) to the `.wwa` layout.
+     * Mirrors `scripts/maps/geojson-to-area.js`; used by tests and tooling.
+     */
+    fun encode(
+        rings: List<List<Position>>,
+        scale: Int = DEFAULT_SCALE,
+    ): ByteArray {
+        val vertexCount = rings.sumOf { it.size }
+        val ringCount = rings.size
+        val ints = IntArray(HEADER_INTS + (ringCount + 1) + ringCount * BBOX_INTS + vertexCount * 2)
+
+        fun q(value: Double) = (value * scale).roundToInt()
+
+        ints[0] = MAGIC
+        ints[1] = VERSION
+        ints[2] = scale
+        ints[3] = ringCount
+        ints[4] = vertexCount
+
+        val areaBbox = intArrayOf(Int.MAX_VALUE, Int.MAX_VALUE, Int.MIN_VALUE, Int.MIN_VALUE)
+        var offsetIndex = HEADER_INTS
+        var bboxIndex = HEADER_INTS + ringCount + 1
+        var coordinateIndex = bboxIndex + ringCount * BBOX_INTS
+        var vertex = 0
+        ints[offsetIndex++] = 0
+        for (ring in rings) {
+            val ringBbox = intArrayOf(Int.MAX_VALUE, Int.MAX_VALUE, Int.MIN_VALUE, Int.MIN_VALUE)
+            for (position in ring) {
+                val lat = q(position.lat)
+                val lng = q(position.lng)
+                ints[coordinateIndex++] = lat
+                ints[coordinateIndex++] = lng
+                ringBbox.include(lat, lng)
+            }
+            vertex += ring.size
+            ints[offsetIndex++] = vertex
+            if (ring.isNotEmpty()) {
+                ringBbox.copyInto(ints, bboxIndex)
+                areaBbox.include(ringBbox[0], ringBbox[1])
+                areaBbox.include(ringBbox[2], ringBbox[3])
+            }
+            bboxIndex += BBOX_INTS
+        }
+        if (vertexCount > 0) areaBbox.copyInto(ints, 5)
+
+        return ByteArray(ints.size * 4).also { bytes -> ints.forEachIndexed { i, value -> bytes.putInt(i, value) } }
+    }
+
+    // ------------------------------------------------------------------------
+
+    private fun IntArray.include(
+        lat: Int,
+        lng: Int,
+    ) {
+        if (lat < this[0]) this[0] = lat
+        if (lng < this[1]) this[1] = lng
+        if (lat > this[2]) this[2] = lat
+        if (lng > this[3]) this[3] = lng
+    }
+
+    private fun ByteArray.int(index: Int): Int {
+        val o = index * 4
+        return (this[o].toInt() and 0xFF) or
+            ((this[o + 1].toInt() and 0xFF) shl 8) or
+            ((this[o + 2].toInt() and 0xFF) shl 16) or
+            ((this[o + 3].toInt() and 0xFF) shl 24)
+    }
+
+    private fun ByteArray.putInt(
+        index: Int,
+        value: Int,
+    ) {
+        val o = index * 4
+        this[o] = value.toByte()
+        this[o + 1] = (value shr 8).toByte()
+        this[o + 2] = (value shr 16).toByte()
+        this[o + 3] = (value shr 24).toByte()
+    }
+}
@@ -275,39 +275,7 @@ object GeoJsonAreaParser {
     ) {
         try {
             val ringArray = validateRingArray(ring) ?: return
-            val positions = extractPositionsFromRing(ringArray, bboxOverride)
-
-            val hasPositions = positions.isNotEmpty()
-            if (!hasPositions) {
-                return
-            }
-
-            // Deduplicate positions after clamping to prevent degenerate polygons
-            // When bbox clamping is extensive, many coordinates may collapse to same values
-            val uniquePositions = positions.distinct()
-
-            // Check if we have enough unique positions to form a valid polygon (minimum 3)
-            if (uniquePositions.size < 3) {
-                Log.v(
-                    "GeoJsonAreaParser",
-                    "Rejecting polygon for event $eventId: only ${uniquePositions.size} unique " +
-                        "position(s) after clamping (${positions.size} original, minimum 3 required)",
-                )
-                return
-            }
-
-            val polygon = createPolygonFromPositions(uniquePositions) ?: return
-
-            val isValidPolygon = polygon.size >= 3
-            if (isValidPolygon) {
-                polygons.add(polygon)
-            } else {
-                Log.v(
-                    "GeoJsonAreaParser",
-                    "Rejecting polygon for event $eventId: polygon has ${polygon.size} points " +
-                        "after construction (minimum 3 required)",
-                )
-            }
+            addRingPolygon(eventId, extractPositionsFromRing(ringArray, bboxOverride), polygons)
         } catch (e: NumberFormatException) {
             Log.v("GeoJsonAreaParser", "Invalid numeric data in ring processing: ${e.message}")
             // Ring processing errors are handled gracefully
@@ -320,6 +288,50 @@ object GeoJsonAreaParser {
         }
     }
 
+    /**
+     * Turns one ring of (already bbox-constrained) positions into an area polygon and adds it to
+     * [polygons]: duplicates are removed and rings with fewer than 3 unique positions rejected.
+     *
+     * Shared with `BinaryAreaFormat` so both sources yield the same polygons.
+     */
+    internal fun addRingPolygon(
+        eventId: String,
+        positions: List<Position>,
+        polygons: MutableArea,
+    ) {
+        val hasPositions = positions.isNotEmpty()
+        if (!hasPositions) {
+            return
+        }
+
+        // Deduplicate positions after clamping to prevent degenerate polygons
+        // When bbox clamping is extensive, many coordinates may collapse to same values
+        val uniquePositions = positions.distinct()
+
+        // Check if we have enough unique positions to form a valid polygon (minimum 3)
+        if (uniquePositions.size < 3) {
+            Log.v(
+                "GeoJsonAreaParser",
+                "Rejecting polygon for event $eventId: only ${uniquePositions.size} unique " +
+                    "position(s) after clamping (${positions.size} original, minimum 3 required)",
+            )
+            return
+        }
+
+        val polygon = createPolygonFromPositions(uniquePositions) ?: return
+
+        val isValidPolygon = polygon.size >= 3
+        if (isValidPolygon) {
+            polygons.add(polygon)
+        } else {
+            Log.v(
+                "GeoJsonAreaParser",
+                "Rejecting polygon for event $eventId: polygon has ${polygon.size} points " +
+                    "after construction (minimum 3 required)",
+            )
+        }
+    }
+
     /**
      * Validates that the ring is a non-empty JsonArray
      */
@@ -426,7 +438,7 @@ object GeoJsonAreaParser {
     /**
      * Parses a bbox string in the format "minLng, minLat, maxLng, maxLat"
      */
-    private fun parseBboxString(bbox: String?): BoundingBox? {
+    internal fun parseBboxString(bbox: String?): BoundingBox? {
         bbox?.let {
             try {
                 // Parse the string "minLng, minLat, maxLng, maxLat"
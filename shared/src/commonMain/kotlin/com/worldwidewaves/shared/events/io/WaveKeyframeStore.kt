@@ -0,0 +1,240 @@
+package com.worldwidewaves.shared.events.io
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.data.platformAppVersionStamp
+import com.worldwidewaves.shared.data.platformCacheRoot
+import com.worldwidewaves.shared.data.platformDeleteFile
+import com.worldwidewaves.shared.data.platformEnsureDir
+import com.worldwidewaves.shared.data.platformFileExists
+import com.worldwidewaves.shared.data.platformReadText
+import com.worldwidewaves.shared.data.platformWriteText
+import com.worldwidewaves.shared.events.utils.Area
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import com.worldwidewaves.shared.utils.Log
+import kotlin.math.roundToLong
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.minutes
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Persistent wave front keyframe of an event (`<eventId>.wwk` in the map cache directory).
+ *
+ * For a given area, speed and direction the split of the area by the wave front only depends on
+ * the elapsed wave time, so a split computed in a previous session is still valid after a restart.
+ * The wave writes its latest split here every [KEYFRAME_INTERVAL]; when the event screen is
+ * reopened during a live wave, the first frame is served from the file instead of loading the
+ * area and splitting it on the critical path. The next frame is computed as usual.
+ *
+ * ## Validity
+ * A keyframe is only restored when it was written by the same app version
+ * ([platformAppVersionStamp]) for the same wave parameters (the `waveKey` of the caller).
+ * `MapStore` deletes the file whenever it caches a new GeoJSON or binary area of the event.
+ *
+ * ## Layout (UTF-8 text, one record per line)
+ * ```
+ * WWWK <version>
+ * <app version stamp>
+ * <wave key>
+ * <elapsed milliseconds>
+ * T <lat>,<lng>,<lat>,<lng>,...   traversed polygon, coordinates quantized to 1e-7 degree
+ * R <lat>,<lng>,...               remaining polygon
+ * END <polygon count>
+ * ```
+ * The `END` line detects a truncated write (Android does not write atomically).
+ */
+object WaveKeyframeStore {
+    private const val TAG = "WaveKeyframeStore"
+    private const val MAGIC = "WWWK"
+    const val VERSION = 1
+    const val FILE_EXTENSION = "wwk"
+    private const val SCALE = 10_000_000.0
+    private const val HEADER_LINES = 4
+    private const val TRAVERSED = "T"
+    private const val REMAINING = "R"
+    private const val END = "END"
+
+    /** Keyframes are written at most once per interval of wave progression. */
+    val KEYFRAME_INTERVAL: Duration = 10.seconds
+
+    /** An older keyframe is not restored: the front would visibly jump back on the next frame. */
+    val MAX_RESTORE_LAG: Duration = 1.minutes
+
+    /** Bounds the file size; larger splits (country events) are not persisted. */
+    const val MAX_VERTICES = 200_000
+
+    /** Wave split at [elapsed] time since the wave start. */
+    class Keyframe(
+        val elapsed: Duration,
+        val traversedPolygons: Area,
+        val remainingPolygons: Area,
+    ) {
+        val vertexCount: Int get() = traversedPolygons.sumOf { it.size } + remainingPolygons.sumOf { it.size }
+    }
+
+    fun path(
+        root: String,
+        eventId: String,
+    ): String = "$root/$eventId.$FILE_EXTENSION"
+
+    /**
+     * Reads the keyframe of [eventId] written for [waveKey].
+     *
+     * @return The keyframe, or null if there is none, it is outdated or the file cannot be read
+     */
+    suspend fun load(
+        eventId: String,
+        waveKey: String,
+    ): Keyframe? =
+        try {
+            val path = path(platformCacheRoot(), eventId)
+            if (!platformFileExists(path)) {
+                null
+            } else {
+                decode(platformReadText(path), platformAppVersionStamp(), waveKey)
+            }
+        } catch (e: kotlinx.coroutines.CancellationException) {
+            throw e
+        } catch (e: IllegalArgumentException) {
+            Log.w(TAG, "Invalid wave keyframe for $eventId: ${e.message}")
+            null
+        } catch (e: Exception) {
+            // The keyframe is only a shortcut: any I/O problem falls back to computing the split
+            Log.w(TAG, "Cannot read wave keyframe for $eventId: ${e.message}")
+            null
+        }
+
+    /** Replaces the keyframe of [eventId]; failures are logged and ignored. */
+    suspend fun save(
+        eventId: String,
+        waveKey: String,
+        keyframe: Keyframe,
+    ) {
+        if (keyframe.vertexCount > MAX_VERTICES) return
+        try {
+            val root = platformCacheRoot().also { platformEnsureDir(it) }
+            platformWriteText(path(root, eventId), encode(platformAppVersionStamp(), waveKey, keyframe))
+            Log.v(TAG, "Saved wave keyframe for $eventId at ${keyframe.elapsed}")
+        } catch (e: kotlinx.coroutines.CancellationException) {
+            throw e
+        } catch (e: Exception) {
+            Log.w(TAG, "Cannot write wave keyframe for $eventId: ${e.message}")
+        }
+    }
+
+    /** Deletes the keyframe of [eventId], written against an area that is being replaced. */
+    suspend fun invalidate(
+        root: String,
+        eventId: String,
+    ) {
+        val path = path(root, eventId)
+        if (platformFileExists(path)) {
+            platformDeleteFile(path)
+            Log.d(TAG, "Invalidated wave keyframe for $eventId")
+        }
+    }
+
+    // ------------------------------------------------------------------------
+
+    fun encode(
+        stamp: String,
+        waveKey: String,
+        keyframe: Keyframe,
+    ): String =
+        buildString {
+            append(MAGIC).append(' ').append(VERSION).append('\n')
+            append(stamp.singleLine()).append('\n')
+            append(waveKey.singleLine()).append('\n')
+            append(keyframe.elapsed.inWholeMilliseconds).append('\n')
+            val traversed = keyframe.traversedPolygons.filter { it.isNotEmpty() }
+            val remaining = keyframe.remainingPolygons.filter { it.isNotEmpty() }
+            traversed.forEach { appendPolygon(TRAVERSED, it) }
+            remaining.forEach { appendPolygon(REMAINING, it) }
+            append(END).append(' ').append(traversed.size + remaining.size).append('\n')
+        }
+
+    /**
+     * Decodes a keyframe file.
+     *
+     * @return The keyframe, or null for an empty input or one written by another app version or for other wave parameters
+     * @throws IllegalArgumentException if the file is truncated, malformed or has an unknown version
+     */
+    fun decode(
+        text: String,
+        stamp: String,
+        waveKey: String,
+    ): Keyframe? {
+        if (text.isEmpty()) return null
+        val lines = text.lines().let { if (it.last().isEmpty()) it.dropLast(1) else it }
+        require(lines.size > HEADER_LINES) { "truncated header (${lines.size} lines)" }
+        val (magic, version) = lines[0].split(' ').let { it.first() to it.getOrNull(1) }
+        require(magic == MAGIC) { "bad magic" }
+        require(version == VERSION.toString()) { "unsupported version $version" }
+        if (lines[1] != stamp.singleLine() || lines[2] != waveKey.singleLine()) return null
+
+        val elapsedMillis = requireNotNull(lines[3].toLongOrNull()) { "bad elapsed time" }
+        val traversed = mutableListOf<Polygon>()
+        val remaining = mutableListOf<Polygon>()
+        val end = lines.last().split(' ')
+        require(end.size == 2 && end[0] == END) { "truncated keyframe" }
+        for (i in HEADER_LINES until lines.size - 1) {
+            val line = lines[i]
+            when (line.substringBefore(' ')) {
+                TRAVERSED -> traversed += parsePolygon(line)
+                REMAINING -> remaining += parsePolygon(line)
+                else -> throw IllegalArgumentException("unexpected record at line ${i + 1}")
+            }
+        }
+        require(end[1].toIntOrNull() == traversed.size + remaining.size) { "truncated keyframe" }
+        return Keyframe(elapsedMillis.milliseconds, traversed, remaining)
+    }
+
+    private fun StringBuilder.appendPolygon(
+        kind: String,
+        polygon: Polygon,
+    ) {
+        append(kind).append(' ')
+        var first = true
+        for (position in polygon) {
+            if (!first) append(',')
+            append((position.lat * SCALE).roundToLong()).append(',').append((position.lng * SCALE).roundToLong())
+            first = false
+        }
+        append('\n')
+    }
+
+    private fun parsePolygon(line: String): Polygon {
+        val values = line.substringAfter(' ').split(',')
+        require(values.size % 2 == 0) { "odd coordinate count" }
+        val positions =
+            List(values.size / 2) { k ->
+                val lat = requireNotNull(values[k * 2].toLongOrNull()) { "bad coordinate" }
+                val lng = requireNotNull(values[k * 2 + 1].toLongOrNull()) { "bad coordinate" }
+                Position(lat / SCALE, lng / SCALE)
+            }
+        return Polygon.fromPositions(positions)
+    }
+
+    private fun String.singleLine(): String = replace('\n', ' ').replace('\r', ' ')
+}
@@ -0,0 +1,226 @@
+package com.worldwidewaves.shared.events.utils
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.GeoUtils.EPSILON
+import kotlin.math.abs
+
+/**
+ * Immutable, flat (struct-of-arrays) polygon ring: one `DoubleArray` of latitudes, one of longitudes.
+ *
+ * [Polygon] is a linked list of [Position] objects with an id index and cut metadata, which the
+ * splitting code needs. Read-heavy paths (containment tests on every location update, clipping
+ * of plain area rings on every wave tick) only need the coordinates; walking them from two
+ * contiguous arrays avoids a node hop and an object header per vertex.
+ *
+ * The ring is stored open: a closing vertex equal to the first one is dropped on packing and
+ * added back by [toPolygon]. Bounding box and signed area are computed once at construction.
+ *
+ * Cut metadata ([CutPosition]) is not kept: convert back with [toPolygon] only for rings that
+ * had none, or use the result for read-only purposes.
+ */
+class PackedPolygon private constructor(
+    private val lats: DoubleArray,
+    private val lngs: DoubleArray,
+) {
+    companion object {
+        private const val VERTEX_EPSILON = 1e-12
+        private const val MIN_RING_VERTICES = 3
+
+        val EMPTY = PackedPolygon(DoubleArray(0), DoubleArray(0))
+
+        fun fromPolygon(polygon: Polygon): PackedPolygon {
+            val closed = polygon.size > 1 && polygon.first() == polygon.last()
+            val count = if (closed) polygon.size - 1 else polygon.size
+            val lats = DoubleArray(count)
+            val lngs = DoubleArray(count)
+            var i = 0
+            for (position in polygon) {
+                if (i == count) break
+                lats[i] = position.lat
+                lngs[i] = position.lng
+                i++
+            }
+            return PackedPolygon(lats, lngs)
+        }
+
+        /** Wraps the arrays without copying; callers must not modify them afterwards. */
+        fun fromArrays(
+            lats: DoubleArray,
+            lngs: DoubleArray,
+        ): PackedPolygon {
+            require(lats.size == lngs.size) { "PackedPolygon: ${lats.size} latitudes for ${lngs.size} longitudes" }
+            return PackedPolygon(lats, lngs)
+        }
+    }
+
+    val size: Int get() = lats.size
+
+    fun isEmpty(): Boolean = lats.isEmpty()
+
+    fun lat(index: Int): Double = lats[index]
+
+    fun lng(index: Int): Double = lngs[index]
+
+    val minLat: Double
+    val minLng: Double
+    val maxLat: Double
+    val maxLng: Double
+
+    /** Shoelace area in square degrees; positive for counter-clockwise rings. */
+    val signedArea: Double
+
+    init {
+        var minLa = Double.POSITIVE_INFINITY
+        var minLn = Double.POSITIVE_INFINITY
+        var maxLa = Double.NEGATIVE_INFINITY
+        var maxLn = Double.NEGATIVE_INFINITY
+        var twiceArea = 0.0
+        val n = lats.size
+        for (i in 0 until n) {
+            val lat = lats[i]
+            val lng = lngs[i]
+            if (lat < minLa) minLa = lat
+            if (lat > maxLa) maxLa = lat
+            if (lng < minLn) minLn = lng
+            if (lng > maxLn) maxLn = lng
+            val j = if (i + 1 == n) 0 else i + 1
+            twiceArea += lng * lats[j] - lngs[j] * lat
+        }
+        minLat = minLa
+        minLng = minLn
+        maxLat = maxLa
+        maxLng = maxLn
+        signedArea = twiceArea / 2.0
+    }
+
+    val area: Double get() = abs(signedArea)
+
+    /** Same orientation convention as [Polygon.isClockwise] (degenerate rings count as clockwise). */
+    val isClockwise: Boolean get() = size < MIN_RING_VERTICES || signedArea < 0
+
+    fun bbox(): BoundingBox {
+        require(!isEmpty()) { "PackedPolygon bbox: cannot compute bounding box of an empty polygon" }
+        return BoundingBox(minLat, minLng, maxLat, maxLng)
+    }
+
+    fun bboxContains(
+        lat: Double,
+        lng: Double,
+    ): Boolean = lat >= minLat && lat <= maxLat && lng >= minLng && lng <= maxLng
+
+    /**
+     * Ray-casting containment test, same semantics as `PolygonOperations.containsPosition`
+     * (a point on a vertex is inside), with a bounding box rejection first.
+     */
+    @Suppress("ReturnCount") // Early returns for guard clauses improve readability
+    fun containsPosition(
+        lat: Double,
+        lng: Double,
+    ): Boolean {
+        if (size < MIN_RING_VERTICES || !bboxContains(lat, lng)) return false
+
+        var inside = false
+        var j = size - 1
+        for (i in 0 until size) {
+            val xi = lngs[i]
+            val yi = lats[i]
+            if (abs(xi - lng) < VERTEX_EPSILON && abs(yi - lat) < VERTEX_EPSILON) return true
+
+            val yj = lats[j]
+            if ((yi > lat) != (yj > lat)) {
+                val xj = lngs[j]
+                if (lng < (xj - xi) * (lat - yi) / (yj - yi) + xi) inside = !inside
+            }
+            j = i
+        }
+        return inside
+    }
+
+    fun containsPosition(position: Position): Boolean = containsPosition(position.lat, position.lng)
+
+    /**
+     * Sutherland-Hodgman clip against the vertical line `lng = cutLng`, on the arrays.
+     * Same output as `PolygonTransformations.clipToHalfPlane` (vertices within [epsilon] of the
+     * line are kept on both sides).
+     *
+     * @return The clipped ring (open), or [EMPTY] when fewer than 3 vertices remain
+     */
+    fun clipToHalfPlane(
+        cutLng: Double,
+        keepLeft: Boolean,
+        epsilon: Double = VERTEX_EPSILON,
+    ): PackedPolygon {
+        if (size < MIN_RING_VERTICES) return EMPTY
+        if (keepLeft && maxLng <= cutLng + epsilon) return this
+        if (!keepLeft && minLng >= cutLng - epsilon) return this
+
+        // Each edge emits at most two vertices
+        val outLats = DoubleArray(size * 2)
+        val outLngs = DoubleArray(size * 2)
+        var count = 0
+
+        fun isInside(lng: Double) = if (keepLeft) lng <= cutLng + epsilon else lng >= cutLng - epsilon
+
+        fun addIntersection(
+            prev: Int,
+            curr: Int,
+        ) {
+            val lngDiff = lngs[curr] - lngs[prev]
+            if (abs(lngDiff) < EPSILON) return
+            val t = (cutLng - lngs[prev]) / lngDiff
+            if (t < 0 || t > 1) return
+            outLats[count] = lats[prev] + t * (lats[curr] - lats[prev])
+            outLngs[count] = cutLng
+            count++
+        }
+
+        var prev = size - 1
+        var prevInside = isInside(lngs[prev])
+        for (curr in 0 until size) {
+            val currInside = isInside(lngs[curr])
+            if (prevInside != currInside) addIntersection(prev, curr)
+            if (currInside) {
+                outLats[count] = lats[curr]
+                outLngs[count] = lngs[curr]
+                count++
+            }
+            prev = curr
+            prevInside = currInside
+        }
+
+        return if (count < MIN_RING_VERTICES) EMPTY else PackedPolygon(outLats.copyOf(count), outLngs.copyOf(count))
+    }
+
+    /** Rebuilds a linked [Polygon] (closed unless [close] is false). */
+    fun toPolygon(close: Boolean = true): Polygon {
+        val polygon = Polygon()
+        for (i in 0 until size) polygon.add(Position(lats[i], lngs[i]))
+        if (close && size > 0) polygon.add(Position(lats[0], lngs[0]))
+        return polygon
+    }
+
+    override fun toString(): String = "PackedPolygon(size=$size, bbox=[$minLat, $minLng, $maxLat, $maxLng])"
+}
+
+/** Packs every ring of an area, see [PackedPolygon.fromPolygon]. */
+fun Area.packed(): List<PackedPolygon> = map(PackedPolygon::fromPolygon)
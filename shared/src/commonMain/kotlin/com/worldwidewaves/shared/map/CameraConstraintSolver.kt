@@ -0,0 +1,205 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.BoundingBox
+import com.worldwidewaves.shared.events.utils.Position
+import kotlinx.atomicfu.locks.reentrantLock
+import kotlinx.atomicfu.locks.withLock
+import kotlin.math.PI
+import kotlin.math.ln
+import kotlin.math.log2
+import kotlin.math.min
+import kotlin.math.tan
+
+/**
+ * Camera constraints of an event map for one viewport: the range the camera center may move in
+ * and the minimum zoom that keeps pixels outside the event area off screen.
+ *
+ * @property minZoom NaN when the viewport is not laid out yet (the platform keeps its current min zoom)
+ */
+data class CameraConstraints(
+    val constraintBounds: BoundingBox,
+    val minZoom: Double,
+)
+
+/**
+ * Memoized solver of [CameraConstraints], shared by [MapBoundsEnforcer] and the platform adapters.
+ *
+ * Results are keyed by (event bounds, viewport size, padding, mode), so rotation back and forth,
+ * repeated camera-idle passes and the first camera setup reuse one computation instead of each
+ * layer redoing it (and iOS asking the map view back for the value it was just given).
+ *
+ * ## Min zoom
+ * Web Mercator fit with 512pt tiles, the same result as MapLibre `getCameraForLatLngBounds`:
+ * - BOUNDS mode: the whole event area fits the viewport
+ * - WINDOW mode: the event dimension constraining the viewport aspect fills it, so the viewport
+ *   never extends past the event area
+ *
+ * Thread-safe.
+ */
+class CameraConstraintSolver {
+    companion object {
+        /** Solver used by the map screens. */
+        val shared: CameraConstraintSolver by lazy { CameraConstraintSolver() }
+
+        private const val MAX_ENTRIES = 16
+        private const val TILE_SIZE = 512.0
+        private const val DEGREES_PER_TURN = 360.0
+
+        /** Padding is clamped to 49% of the event span so a small valid center region always remains. */
+        private const val MAX_PADDING_RATIO = 0.49
+
+        /** Event bounds shrunk by [padding] on each side: the valid range of the camera center. */
+        fun paddedBounds(
+            eventBounds: BoundingBox,
+            padding: MapBoundsEnforcer.VisibleRegionPadding,
+        ): BoundingBox {
+            val latPadding = min(padding.latPadding, eventBounds.height * MAX_PADDING_RATIO)
+            val lngPadding = min(padding.lngPadding, eventBounds.width * MAX_PADDING_RATIO)
+            return BoundingBox.fromCorners(
+                Position(eventBounds.sw.lat + latPadding, eventBounds.sw.lng + lngPadding),
+                Position(eventBounds.ne.lat - latPadding, eventBounds.ne.lng - lngPadding),
+            )
+        }
+
+        /** Lowest zoom at which [eventBounds] may be shown in a [width] x [height] viewport, NaN if not computable. */
+        fun computeMinZoom(
+            eventBounds: BoundingBox,
+            width: Double,
+            height: Double,
+            isWindowMode: Boolean,
+        ): Double {
+            val eventWidth = eventBounds.width
+            val eventHeight = eventBounds.height
+            @Suppress("ComplexCondition") // Any degenerate dimension makes the fit meaningless
+            if (width <= 0 || height <= 0 || eventWidth <= 0 || eventHeight <= 0) return Double.NaN
+
+            if (!isWindowMode) return fitZoom(eventBounds, width, height)
+
+            // WINDOW mode: fit the part of the event matching the viewport aspect
+            val screenAspect = width / height
+            val constrainingBounds =
+                if (eventWidth / eventHeight > screenAspect) {
+                    // Event wider than screen → constrained by HEIGHT
+                    val constrainedWidth = eventHeight * screenAspect
+                    val centerLng = (eventBounds.sw.lng + eventBounds.ne.lng) / 2.0
+                    BoundingBox.fromCorners(
+                        Position(eventBounds.sw.lat, centerLng - constrainedWidth / 2),
+                        Position(eventBounds.ne.lat, centerLng + constrainedWidth / 2),
+                    )
+                } else {
+                    // Event taller than screen → constrained by WIDTH
+                    val constrainedHeight = eventWidth / screenAspect
+                    val centerLat = (eventBounds.sw.lat + eventBounds.ne.lat) / 2.0
+                    BoundingBox.fromCorners(
+                        Position(centerLat - constrainedHeight / 2, eventBounds.sw.lng),
+                        Position(centerLat + constrainedHeight / 2, eventBounds.ne.lng),
+                    )
+                }
+            return fitZoom(constrainingBounds, width, height)
+        }
+
+        private fun fitZoom(
+            bounds: BoundingBox,
+            width: Double,
+            height: Double,
+        ): Double {
+            val ySpan = mercatorY(bounds.ne.lat) - mercatorY(bounds.sw.lat)
+            val zoomForWidth = log2(width * DEGREES_PER_TURN / (bounds.width * TILE_SIZE))
+            val zoomForHeight = log2(height * 2 * PI / (ySpan * TILE_SIZE))
+            return min(zoomForWidth, zoomForHeight)
+        }
+
+        private fun mercatorY(latitude: Double): Double = ln(tan(PI / 4 + latitude * PI / DEGREES_PER_TURN))
+    }
+
+    private data class ZoomKey(
+        val eventBounds: BoundingBox,
+        val width: Double,
+        val height: Double,
+        val isWindowMode: Boolean,
+    )
+
+    private data class Key(
+        val zoomKey: ZoomKey,
+        val latPadding: Double,
+        val lngPadding: Double,
+    )
+
+    private val lock = reentrantLock()
+    private val minZooms = LinkedHashMap<ZoomKey, Double>()
+    private val constraints = LinkedHashMap<Key, CameraConstraints>()
+
+    /** Constraints of [eventBounds] in a [width] x [height] viewport, center range shrunk by [padding]. */
+    fun solve(
+        eventBounds: BoundingBox,
+        width: Double,
+        height: Double,
+        padding: MapBoundsEnforcer.VisibleRegionPadding,
+        isWindowMode: Boolean,
+    ): CameraConstraints {
+        val zoomKey = ZoomKey(eventBounds, width, height, isWindowMode)
+        val key = Key(zoomKey, padding.latPadding, padding.lngPadding)
+        lock.withLock { constraints.touch(key) }?.let { return it }
+
+        val solved = CameraConstraints(paddedBounds(eventBounds, padding), minZoom(zoomKey))
+        lock.withLock { constraints.putBounded(key, solved) }
+        return solved
+    }
+
+    /** Min zoom only (constraint bounds already known), shares the memo of [solve]. */
+    fun minZoom(
+        eventBounds: BoundingBox,
+        width: Double,
+        height: Double,
+        isWindowMode: Boolean,
+    ): Double = minZoom(ZoomKey(eventBounds, width, height, isWindowMode))
+
+    private fun minZoom(key: ZoomKey): Double {
+        lock.withLock { minZooms.touch(key) }?.let { return it }
+
+        val zoom = computeMinZoom(key.eventBounds, key.width, key.height, key.isWindowMode)
+        // Not laid out yet: do not remember, the real size comes with the next layout pass
+        if (!zoom.isNaN()) lock.withLock { minZooms.putBounded(key, zoom) }
+        return zoom
+    }
+
+    internal fun size(): Int = lock.withLock { constraints.size }
+
+    internal fun clear() =
+        lock.withLock {
+            minZooms.clear()
+            constraints.clear()
+        }
+
+    /** Get and mark most recently used. */
+    private fun <K, V : Any> LinkedHashMap<K, V>.touch(key: K): V? = remove(key)?.also { put(key, it) }
+
+    private fun <K, V> LinkedHashMap<K, V>.putBounded(
+        key: K,
+        value: V,
+    ) {
+        put(key, value)
+        if (size > MAX_ENTRIES) remove(keys.first())
+    }
+}
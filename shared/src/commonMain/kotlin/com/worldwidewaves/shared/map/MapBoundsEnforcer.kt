@@ -40,24 +40,19 @@ import kotlin.math.min
  *
  * Min Zoom Calculation:
  * The minimum zoom level prevents users from zooming out beyond the event area.
- * Platform-specific implementations:
+ * Constraint bounds and min zoom are solved together by [CameraConstraintSolver] (memoized per
+ * event bounds, viewport size and padding), the adapter applies both in one call.
  *
- * Android: Uses MapLibre's getCameraForLatLngBounds() for constraint-based calculation
- * - Automatically calculates zoom to fit bounds within viewport
+ * Android: Uses MapLibre's getCameraForLatLngBounds() (same fit as the solver)
+ * iOS: Sends the solved min zoom to Swift with the constraint bounds (no calculation in Swift)
  *
- * iOS: Manual calculation using Web Mercator projection (512px tiles)
- * - WINDOW mode: zoomForHeight = log2((screenHeight * 360) / (boundsHeight * 512))
- *                zoomForWidth  = log2((screenWidth * 360 * cos(lat)) / (boundsWidth * 512))
- *                Uses constraining dimension (min of both)
- * - BOUNDS mode: Uses MapLibre's cameraThatFitsCoordinateBounds() for entire event visibility
- *
- * See: iosApp/worldwidewaves/MapLibre/MapLibreViewWrapper.swift lines 516-560 for iOS formula
  * See: docs/ios/ios-map-implementation-status.md for platform comparison
  *
  * @param mapBounds The event area bounding box to constrain the map to
  * @param mapLibreAdapter Platform-specific map adapter
  * @param isWindowMode True for WINDOW mode (full map with gestures), false for BOUNDS mode (event detail, no gestures)
  * @param isSuppressed Lambda that returns true when constraint enforcement should be suppressed (during animations)
+ * @param constraintSolver Memoized constraint solver, shared by all map screens by default
  */
 class MapBoundsEnforcer(
     private val mapBounds: BoundingBox,
@@ -69,7 +64,12 @@ class MapBoundsEnforcer(
      * already running to avoid fighting with it.
      */
     private val isSuppressed: () -> Boolean = { false },
+    private val constraintSolver: CameraConstraintSolver = CameraConstraintSolver.shared,
 ) {
+    private companion object {
+        const val ZOOM_TOLERANCE = 0.001
+    }
+
     data class VisibleRegionPadding(
         var latPadding: Double = 0.0,
         var lngPadding: Double = 0.0,
@@ -79,6 +79,9 @@ class MapBoundsEnforcer(
     private var constraintBounds: BoundingBox? = null
     private var constraintsApplied = false
     private var lastAppliedBounds: BoundingBox? = null // Track last applied bounds to prevent redundant updates
+    private var lastAppliedMinZoom = Double.NaN
+    private var lastViewportWidth = 0.0 // Viewport size of the last solve, a change means rotation or resize
+    private var lastViewportHeight = 0.0
     private var skipNextRecalculation = false // Skip one recalculation after programmatic zoom
     private var forceNextRecalculation = false // Force constraint update on next camera idle
 
@@ -86,7 +89,7 @@ class MapBoundsEnforcer(
         visibleRegionPadding = padding
     }
 
-    fun calculateConstraintBounds(): BoundingBox = calculatePaddedBounds(visibleRegionPadding)
+    fun calculateConstraintBounds(): BoundingBox = CameraConstraintSolver.paddedBounds(mapBounds, visibleRegionPadding)
 
     /**
      * Forces the next camera idle event to recalculate constraints, bypassing skip logic.
@@ -143,10 +146,16 @@ class MapBoundsEnforcer(
                     return@addOnCameraIdleListener
                 }
 
-                // Normal flow: Check padding change
+                // Normal flow: Check viewport size and padding change
                 val newPadding = calculateVisibleRegionPadding()
 
-                if (
+                if (hasViewportSizeChanged()) {
+                    Log.d("MapBoundsEnforcer", "Camera idle: Viewport resized, updating constraints")
+                    setVisibleRegionPadding(
+                        VisibleRegionPadding(newPadding.latPadding, newPadding.lngPadding),
+                    )
+                    applyConstraintsWithPadding()
+                } else if (
                     hasSignificantPaddingChange(
                         VisibleRegionPadding(newPadding.latPadding, newPadding.lngPadding),
                     )
@@ -169,9 +178,14 @@ class MapBoundsEnforcer(
      */
     private fun applyConstraintsWithPadding() {
         try {
-            // Compute padded bounds and store them
-            val paddedBounds = calculateConstraintBounds()
+            // Solve padded bounds and min zoom together (memoized) and store them
+            val width = mapLibreAdapter.getWidth()
+            val height = mapLibreAdapter.getHeight()
+            val constraints = constraintSolver.solve(mapBounds, width, height, visibleRegionPadding, isWindowMode)
+            val paddedBounds = constraints.constraintBounds
             constraintBounds = paddedBounds
+            lastViewportWidth = width
+            lastViewportHeight = height
 
             Log.d(
                 "MapBoundsEnforcer",
@@ -191,7 +205,11 @@ class MapBoundsEnforcer(
             }
 
             // Prevent infinite loop: skip if bounds haven't changed significantly (iOS triggers camera idle on every setBounds)
-            if (lastAppliedBounds != null && boundsAreSimilar(lastAppliedBounds!!, paddedBounds)) {
+            // A new min zoom (viewport resized) is always applied
+            if (lastAppliedBounds != null &&
+                boundsAreSimilar(lastAppliedBounds!!, paddedBounds) &&
+                sameZoom(lastAppliedMinZoom, constraints.minZoom)
+            ) {
                 Log.d("MapBoundsEnforcer", "applyConstraintsWithPadding: Skipping - bounds similar to last applied")
                 return
             }
@@ -200,29 +218,36 @@ class MapBoundsEnforcer(
             // NOTE: setBoundsForCameraTarget() now sets min zoom IMMEDIATELY (preventive enforcement)
             // Pass isWindowMode to apply safety margin only for full map screen (not event details)
             // CRITICAL: Pass ORIGINAL event bounds for min zoom calculation (not shrunk paddedBounds)
+            // The adapter reads the min zoom of these bounds from the same solver (memo hit)
             mapLibreAdapter.setBoundsForCameraTarget(
                 constraintBounds = paddedBounds,
                 applyZoomSafetyMargin = isWindowMode,
                 originalEventBounds = mapBounds, // CRITICAL: Original event bounds for min zoom
             )
 
-            // Get the calculated min zoom for logging (already set by adapter)
-            val minZoom = mapLibreAdapter.getMinZoomLevel()
-
             Log.i(
                 "MapBoundsEnforcer",
-                "Applied constraints: minZoom=$minZoom, " +
+                "Applied constraints: minZoom=${constraints.minZoom}, " +
                     "bounds=SW(${paddedBounds.sw.lat},${paddedBounds.sw.lng}) " +
                     "NE(${paddedBounds.ne.lat},${paddedBounds.ne.lng})",
             )
 
             // Track the bounds we just applied
             lastAppliedBounds = paddedBounds
+            lastAppliedMinZoom = constraints.minZoom
         } catch (e: Exception) {
             Log.e("WWW.Map.BoundsEnforcer", "Error applying constraints", e)
         }
     }
 
+    private fun hasViewportSizeChanged(): Boolean =
+        lastViewportWidth != mapLibreAdapter.getWidth() || lastViewportHeight != mapLibreAdapter.getHeight()
+
+    private fun sameZoom(
+        zoom1: Double,
+        zoom2: Double,
+    ): Boolean = (zoom1.isNaN() && zoom2.isNaN()) || abs(zoom1 - zoom2) < ZOOM_TOLERANCE
+
     /**
      * Check if two bounding boxes are similar enough to be considered the same (within 0.1% tolerance).
      * This prevents infinite loops caused by floating-point precision issues and iOS camera idle callbacks.
@@ -444,36 +469,6 @@ class MapBoundsEnforcer(
         return VisibleRegionPadding(viewportHalfHeight, viewportHalfWidth)
     }
 
-    private fun calculatePaddedBounds(padding: VisibleRegionPadding): BoundingBox {
-        // VIEWPORT EDGE CLAMPING: Shrink constraint bounds by viewport size
-        // This ensures camera center cannot move where viewport edges would exceed event bounds
-        // padding = viewportSize / 2, so we add/subtract it from event bounds to get valid camera center range
-
-        // Prevent bounds inversion when viewport > event (e.g., zoomed out on full map)
-        // If padding >= eventSize/2, the result would have SW > NE, which causes invalid bounds
-        // Clamp padding to 49% of event size to guarantee valid bounds with small center region
-        val eventLatSpan = mapBounds.northeast.latitude - mapBounds.southwest.latitude
-        val eventLngSpan = mapBounds.northeast.longitude - mapBounds.southwest.longitude
-
-        // Use 49% (not 50%) to ensure a small valid region remains even when heavily zoomed out
-        val maxLatPadding = eventLatSpan * 0.49
-        val maxLngPadding = eventLngSpan * 0.49
-
-        val effectiveLatPadding = min(padding.latPadding, maxLatPadding)
-        val effectiveLngPadding = min(padding.lngPadding, maxLngPadding)
-
-        return BoundingBox.fromCorners(
-            Position(
-                mapBounds.southwest.latitude + effectiveLatPadding, // SW moves inward
-                mapBounds.southwest.longitude + effectiveLngPadding, // SW moves inward
-            ),
-            Position(
-                mapBounds.northeast.latitude - effectiveLatPadding, // NE moves inward
-                mapBounds.northeast.longitude - effectiveLngPadding, // NE moves inward
-            ),
-        )
-    }
-
     fun isValidBounds(
         bounds: BoundingBox,
         currentPosition: Position?,
@@ -0,0 +1,131 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.domain.scheduling.ObservationPhase
+import com.worldwidewaves.shared.domain.scheduling.ObservationScheduler
+import com.worldwidewaves.shared.events.IWWWEvent
+import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
+import com.worldwidewaves.shared.utils.Log
+import kotlinx.atomicfu.atomic
+import kotlinx.atomicfu.update
+import kotlinx.coroutines.sync.Mutex
+import kotlinx.coroutines.sync.withLock
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
+import kotlin.time.TimeSource
+
+/**
+ * Prepares an event's map before the user opens it, driven by the observation phase.
+ *
+ * Once an event the user cares about (favorite, or user inside the area) enters
+ * [ObservationPhase.NEAR] (~5 minutes before start), the prefetch:
+ * 1. Resolves the style URI: mbtiles/GeoJSON from cache or the already visible ODR tag,
+ *    sprite/glyph cache, style JSON generation (memoised by [com.worldwidewaves.shared.events.WWWEventMap])
+ * 2. Asks the native map provider, if it supports it, to warm its renderer for the event bbox
+ *    over the zoom range the camera constraints will allow
+ *
+ * Nothing is downloaded: map files are only resolved when already available, as with the
+ * download gate closed. Each event is prefetched at most once per process; a failed attempt
+ * (map not available yet) is retried after [RETRY_DELAY].
+ */
+class MapPrefetcher(
+    private val observationScheduler: ObservationScheduler,
+    private val coroutineScopeProvider: CoroutineScopeProvider,
+    private val nativeMapViewProvider: () -> NativeMapViewProvider? = { null },
+) {
+    companion object {
+        private const val TAG = "MapPrefetcher"
+
+        /** Minimum time between two attempts for an event whose map was not available. */
+        val RETRY_DELAY: Duration = 60.seconds
+
+        private val PREFETCH_PHASES = setOf(ObservationPhase.NEAR, ObservationPhase.ACTIVE, ObservationPhase.CRITICAL)
+
+        /** True when [phase] is close enough to the wave to warm the map. */
+        fun isPrefetchPhase(phase: ObservationPhase): Boolean = phase in PREFETCH_PHASES
+    }
+
+    private val mutex = Mutex()
+
+    // Read lock-free on every tick; written once per event
+    private val prefetched = atomic(emptySet<String>())
+    private val lastAttempts = mutableMapOf<String, TimeSource.Monotonic.ValueTimeMark>()
+
+    /**
+     * Called on each observation tick. Cheap once the event is prefetched (one set lookup).
+     *
+     * @param isRelevant Whether the user is likely to open this event's map (favorite, in area)
+     */
+    suspend fun onObservation(
+        event: IWWWEvent,
+        isRelevant: Boolean,
+    ) {
+        if (!isRelevant || event.id in prefetched.value) return
+        if (!isPrefetchPhase(observationScheduler.getObservationSchedule(event).phase)) return
+        if (!claim(event.id)) return
+
+        coroutineScopeProvider.launchIO {
+            val success =
+                try {
+                    prefetch(event)
+                } catch (e: kotlinx.coroutines.CancellationException) {
+                    throw e
+                } catch (e: Exception) {
+                    Log.w(TAG, "Prefetch failed for event ${event.id}: ${e.message}")
+                    false
+                }
+            if (success) prefetched.update { it + event.id }
+        }
+    }
+
+    /** Claims an attempt for [eventId]; false if one is done, running, or was tried recently. */
+    internal suspend fun claim(eventId: String): Boolean =
+        mutex.withLock {
+            if (eventId in prefetched.value) return@withLock false
+            val last = lastAttempts[eventId]
+            if (last != null && last.elapsedNow() < RETRY_DELAY) return@withLock false
+            lastAttempts[eventId] = TimeSource.Monotonic.markNow()
+            true
+        }
+
+    private suspend fun prefetch(event: IWWWEvent): Boolean {
+        val styleUri = event.map.getStyleUri()
+        if (styleUri == null) {
+            Log.d(TAG, "Map not available yet for event ${event.id}, will retry")
+            return false
+        }
+
+        val bbox = event.area.bbox()
+        nativeMapViewProvider()?.prefetchMap(
+            eventId = event.id,
+            styleURL = styleUri,
+            swLat = bbox.sw.lat,
+            swLng = bbox.sw.lng,
+            neLat = bbox.ne.lat,
+            neLng = bbox.ne.lng,
+            maxZoom = event.map.maxZoom,
+        )
+        Log.i(TAG, "Map prefetched for event ${event.id}")
+        return true
+    }
+}
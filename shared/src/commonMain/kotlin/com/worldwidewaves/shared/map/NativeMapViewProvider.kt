@@ -38,4 +38,23 @@ interface NativeMapViewProvider {
      * @return The map wrapper (MapLibreViewWrapper on iOS) or null
      */
     fun getMapWrapper(eventId: String): Any? = null
+
+    /**
+     * Warms the native renderer for an event map ahead of its first display (see [MapPrefetcher]):
+     * tiles over the event bbox for the zoom levels the camera constraints allow, plus sprites
+     * and glyphs. Fire-and-forget, callable from any thread. Default: no-op.
+     *
+     * @param eventId The event ID
+     * @param styleURL Resolved style file (as returned by `WWWEventMap.getStyleUri()`)
+     * @param maxZoom Event max zoom; min zoom is derived natively from the bbox fit
+     */
+    fun prefetchMap(
+        eventId: String,
+        styleURL: String,
+        swLat: Double,
+        swLng: Double,
+        neLat: Double,
+        neLng: Double,
+        maxZoom: Double,
+    ) {}
 }
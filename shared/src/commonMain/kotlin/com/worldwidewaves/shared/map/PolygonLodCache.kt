@@ -0,0 +1,105 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.geometry.PolygonSimplification
+import com.worldwidewaves.shared.events.geometry.contentFingerprint
+import com.worldwidewaves.shared.events.utils.Polygon
+
+/**
+ * Level-of-detail cache for rendered wave polygons, one instance per map.
+ *
+ * Polygons are simplified for a fixed set of zoom bands ([ZoomBand]); the band is chosen from
+ * the current camera zoom. Simplified rings are memoised per band by content fingerprint, so
+ * rings that did not change since the last frame (everything behind the wave front, or the full
+ * area once the wave is done) are simplified once, not every tick.
+ *
+ * The memo of each band only keeps the rings of the last frame rendered at that band, which
+ * bounds memory to roughly one simplified frame per band.
+ *
+ * Not thread-safe: use from the thread that renders the map.
+ */
+class PolygonLodCache {
+    /**
+     * Zoom bands with their simplification tolerance in pixels.
+     * Tolerance is evaluated at the band's upper zoom, so a band never looks coarser than
+     * [tolerancePx] anywhere inside it.
+     */
+    enum class ZoomBand(
+        val maxZoom: Double,
+        val tolerancePx: Double,
+    ) {
+        COUNTRY(maxZoom = 8.0, tolerancePx = 1.0),
+        REGION(maxZoom = 11.0, tolerancePx = 1.0),
+        CITY(maxZoom = 14.0, tolerancePx = 0.75),
+        STREET(maxZoom = Double.POSITIVE_INFINITY, tolerancePx = 0.0),
+        ;
+
+        /** Tolerance in longitude degrees (0 = full resolution). */
+        val toleranceDegrees: Double =
+            if (tolerancePx <= 0.0) 0.0 else tolerancePx * PolygonSimplification.degreesPerPixel(maxZoom)
+
+        companion object {
+            /** Band for [zoom]; unknown zoom renders at full resolution. */
+            fun forZoom(zoom: Double?): ZoomBand = if (zoom == null) STREET else entries.first { zoom < it.maxZoom }
+        }
+    }
+
+    private val memo = mutableMapOf<ZoomBand, Map<Long, Polygon>>()
+
+    /** Band used by the last [polygonsForZoom] call. */
+    var lastBand: ZoomBand? = null
+        private set
+
+    /**
+     * Returns [polygons] decimated for [zoom]. Full-resolution band returns the input list.
+     */
+    fun polygonsForZoom(
+        polygons: List<Polygon>,
+        zoom: Double?,
+    ): List<Polygon> {
+        val band = ZoomBand.forZoom(zoom)
+        lastBand = band
+        if (band.toleranceDegrees == 0.0) return polygons
+
+        val previous = memo[band].orEmpty()
+        val next = HashMap<Long, Polygon>(polygons.size * 2)
+        val result =
+            polygons.map { polygon ->
+                val key = polygon.contentFingerprint()
+                val simplified =
+                    next[key] ?: previous[key] ?: PolygonSimplification.simplify(polygon, band.toleranceDegrees)
+                next[key] = simplified
+                simplified
+            }
+        memo[band] = next
+        return result
+    }
+
+    /** True when [zoom] falls in a different band than the last rendered frame. */
+    fun bandChanged(zoom: Double?): Boolean = lastBand != null && ZoomBand.forZoom(zoom) != lastBand
+
+    fun clear() {
+        memo.clear()
+        lastBand = null
+    }
+}
@@ -0,0 +1,135 @@
+package com.worldwidewaves.shared.position
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.GeoUtils.EARTH_RADIUS
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.PI
+import kotlin.math.cos
+import kotlin.math.sqrt
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
+import kotlin.time.Instant
+
+/**
+ * Smooths GPS fixes and tells which ones are a significant move.
+ *
+ * A stationary user waiting for the wave gets a stream of fixes jittering within the GPS
+ * accuracy radius. Each of them would otherwise re-run area detection and hit-time computation
+ * for every observed event. This filter is a scalar Kalman filter on a constant-position model:
+ * - the estimate variance grows by [processNoise] per second (user walking speed),
+ * - each fix corrects it with a measurement variance of accuracy² ([defaultAccuracyMeters]
+ *   when the platform gives no accuracy).
+ *
+ * A filtered fix is significant when it is farther from the last significant one than the
+ * current uncertainty (clamped to [minSignificantMeters]..[maxSignificantMeters]). The first
+ * fix, a jump beyond [resetDistanceMeters] and a fix after [resetAfter] without any reset the
+ * filter to the raw fix, which is always significant.
+ *
+ * Not thread-safe: called from [PositionManager.updatePosition] only.
+ */
+class PositionFilter(
+    private val defaultAccuracyMeters: Double = 15.0,
+    private val processNoise: Double = 3.0, // m²/s
+    private val minSignificantMeters: Double = 5.0,
+    private val maxSignificantMeters: Double = 25.0,
+    private val resetDistanceMeters: Double = 100.0,
+    private val resetAfter: Duration = 60.seconds,
+) {
+    /** Filtered fix; [significant] is false when downstream results for the last one still hold. */
+    data class Fix(
+        val position: Position,
+        val significant: Boolean,
+    )
+
+    private var estimate: Position? = null
+    private var variance = 0.0 // m²
+    private var lastFixTime: Instant? = null
+    private var lastSignificant: Position? = null
+
+    fun filter(
+        raw: Position,
+        time: Instant,
+        accuracyMeters: Double? = null,
+    ): Fix {
+        val measurementVariance = (accuracyMeters?.takeIf { it > 0.0 } ?: defaultAccuracyMeters).let { it * it }
+        val current = estimate
+        val previousTime = lastFixTime
+        lastFixTime = time
+
+        // Negated comparison: NaN coordinates reset too
+        if (current == null || previousTime == null || time - previousTime > resetAfter ||
+            !(distanceMeters(current, raw) <= resetDistanceMeters)
+        ) {
+            return reset(raw, measurementVariance)
+        }
+
+        // Predict: uncertainty grows with elapsed time, then correct with the fix
+        val elapsedSeconds = (time - previousTime).inWholeMilliseconds.coerceAtLeast(0) / MILLIS_PER_SECOND
+        val predicted = variance + processNoise * elapsedSeconds
+        val gain = predicted / (predicted + measurementVariance)
+        val filtered =
+            Position(
+                lat = current.lat + gain * (raw.lat - current.lat),
+                lng = current.lng + gain * (raw.lng - current.lng),
+            )
+        variance = (1.0 - gain) * predicted
+        estimate = filtered
+
+        val threshold = sqrt(variance).coerceIn(minSignificantMeters, maxSignificantMeters)
+        val significant = lastSignificant?.let { distanceMeters(it, filtered) > threshold } ?: true
+        if (significant) lastSignificant = filtered
+        return Fix(filtered, significant)
+    }
+
+    /** Forgets the estimate; the next fix is taken as is. */
+    fun reset() {
+        estimate = null
+        lastFixTime = null
+        lastSignificant = null
+        variance = 0.0
+    }
+
+    private fun reset(
+        raw: Position,
+        measurementVariance: Double,
+    ): Fix {
+        estimate = raw
+        variance = measurementVariance
+        lastSignificant = raw
+        return Fix(raw, significant = true)
+    }
+
+    private companion object {
+        const val MILLIS_PER_SECOND = 1000.0
+
+        /** Equirectangular distance: accurate to well under a meter at these ranges. */
+        fun distanceMeters(
+            a: Position,
+            b: Position,
+        ): Double {
+            val dLat = (b.lat - a.lat) * PI / 180.0
+            val dLng = (b.lng - a.lng) * PI / 180.0 * cos((a.lat + b.lat) / 2.0 * PI / 180.0)
+            return EARTH_RADIUS * sqrt(dLat * dLat + dLng * dLng)
+        }
+    }
+}
@@ -32,6 +32,7 @@ import kotlinx.coroutines.delay
 import kotlinx.coroutines.flow.MutableStateFlow
 import kotlinx.coroutines.flow.StateFlow
 import kotlinx.coroutines.flow.asStateFlow
+import kotlin.concurrent.Volatile
 import kotlin.math.abs
 import kotlin.time.Duration
 import kotlin.time.Duration.Companion.milliseconds
@@ -47,6 +48,8 @@ import kotlin.time.Instant
  * - Source priority and conflict resolution
  * - Debouncing to prevent excessive updates
  * - Position deduplication using epsilon comparison
+ * - GPS smoothing with significant-change gating ([PositionFilter])
+ * - Position revision for consumers caching position-derived results
  * - Thread-safe reactive position updates
  */
 @OptIn(ExperimentalTime::class)
@@ -55,6 +58,7 @@ class PositionManager(
     private val debounceDelay: Duration = 100.milliseconds,
     private val positionEpsilon: Double = 0.0001, // ~10 meters
     clock: IClock? = null, // Injectable for testing, simulation-aware
+    private val gpsFilter: PositionFilter = PositionFilter(),
 ) {
     private val clock: IClock = clock ?: SystemClock()
 
@@ -89,6 +93,8 @@ class PositionManager(
     private var debounceJob: Job? = null
     private var pendingUpdate: PositionState? = null
 
+    @Volatile private var revision = 0L
+
     // GPS position storage - always keeps latest GPS position regardless of simulation priority
     private var lastGPSPosition: Position? = null
     private var pendingGPSPosition: Position? = null
@@ -103,6 +109,7 @@ class PositionManager(
      *
      * @param source The source of the position update
      * @param newPosition The new position (null to clear)
+     * @param accuracyMeters Horizontal accuracy of a GPS fix, when the platform provides it
      *
      * Note: For production with log sampling (to avoid overwhelming logs), consider using:
      * ```kotlin
@@ -114,6 +121,7 @@ class PositionManager(
     fun updatePosition(
         source: PositionSource,
         newPosition: Position?,
+        accuracyMeters: Double? = null,
     ) {
         if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
             Log.v(TAG, "[DEBUG] Position update from $source: $newPosition")
@@ -132,10 +140,28 @@ class PositionManager(
             }
         }
 
-        val newState = PositionState(newPosition, if (newPosition == null) null else source)
+        val currentState = _currentState.value
+
+        // Smooth GPS fixes; jitter within the accuracy radius is not published (raw fix kept above)
+        val publishedPosition =
+            if (source == PositionSource.GPS && newPosition != null) {
+                val fix = gpsFilter.filter(newPosition, clock.now(), accuracyMeters)
+                val publishedSource = (pendingUpdate ?: currentState).source
+                if (!fix.significant && publishedSource == PositionSource.GPS) {
+                    if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
+                        Log.v(TAG, "[DEBUG] Skipped insignificant GPS fix: $newPosition")
+                    }
+                    return
+                }
+                fix.position
+            } else {
+                if (source == PositionSource.GPS) gpsFilter.reset()
+                newPosition
+            }
+
+        val newState = PositionState(publishedPosition, if (publishedPosition == null) null else source)
 
         // Check if this update should be applied based on source priority
-        val currentState = _currentState.value
         if (!shouldAcceptUpdate(currentState, newState)) {
             if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
                 Log.v(TAG, "[DEBUG] Rejected position update from $source (lower priority than ${currentState.source})")
@@ -144,7 +170,7 @@ class PositionManager(
         }
 
         // Check for position deduplication
-        if (isPositionDuplicate(currentState.position, newPosition)) {
+        if (isPositionDuplicate(currentState.position, publishedPosition)) {
             if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
                 Log.v(TAG, "[DEBUG] Skipped duplicate position update")
             }
@@ -153,6 +179,7 @@ class PositionManager(
 
         // Store pending update and start/restart debounce
         pendingUpdate = newState
+        revision++
         if (WWWGlobals.LogConfig.ENABLE_POSITION_TRACKING_LOGGING) {
             Log.v(TAG, "[DEBUG] Stored pending update: $newState, debounceDelay=$debounceDelay")
         }
@@ -181,6 +208,13 @@ class PositionManager(
      */
     fun getCurrentPosition(): Position? = pendingUpdate?.position ?: _position.value
 
+    /**
+     * Revision of [getCurrentPosition]: changes whenever the current position changes (GPS
+     * jitter below the significance threshold does not). Results computed from the position,
+     * such as area detection, stay valid while the revision is the same.
+     */
+    fun getPositionRevision(): Long = revision
+
     /**
      * Gets the GPS position specifically, ignoring simulation priority.
      * This always returns the latest GPS position received, even when simulation is active.
@@ -263,6 +297,8 @@ class PositionManager(
         pendingGPSPosition = null
         lastGPSPosition = null
         lastGPSUpdateTime = null
+        gpsFilter.reset()
+        revision++
         _currentState.value = PositionState(null, null)
         _position.value = null
         Log.v("PositionManager", "Cleared all position data")
@@ -323,6 +359,8 @@ class PositionManager(
         pendingUpdate = null
         pendingGPSPosition = null
         lastGPSUpdateTime = null
+        gpsFilter.reset()
+        revision++ // getCurrentPosition() no longer returns the dropped pending update
         Log.v("PositionManager", "Cleaned up resources")
     }
 }
@@ -22,8 +22,10 @@ package com.worldwidewaves.shared.sound
  */
 
 import com.worldwidewaves.shared.generated.resources.Res
+import com.worldwidewaves.shared.sound.midi.BinaryNoteFormat
 import com.worldwidewaves.shared.sound.midi.MidiEventProcessor
 import com.worldwidewaves.shared.sound.midi.MidiHeaderValidator
+import com.worldwidewaves.shared.sound.midi.MidiNoteStream
 import com.worldwidewaves.shared.sound.midi.MidiTimeConverter
 import com.worldwidewaves.shared.sound.midi.MidiTrackParser
 import com.worldwidewaves.shared.utils.ByteArrayReader
@@ -70,12 +72,16 @@ data class MidiTrack(
     val notes: List<MidiNote>,
     val totalDuration: Duration,
     val tempo: Int = 120, // BPM
-)
+) {
+    /** Time-sorted, indexed view of [notes] for active-note lookups, built on first use. */
+    val noteStream: MidiNoteStream by lazy { MidiNoteStream(notes) }
+}
 
 // ----------------------------------------------------------------------------
 
 /**
- * Handles parsing of Standard MIDI File (SMF) format with global caching
+ * Handles parsing of Standard MIDI File (SMF) format with global caching.
+ * A precompiled `.wwn` note stream next to the `.mid` resource is preferred when present.
  */
 object MidiParser {
     // Logging tag
@@ -105,7 +111,7 @@ object MidiParser {
         // Load and parse MIDI file if not cached
         Log.d(TAG, "Loading MIDI file (not cached): $midiResourcePath")
         val track =
-            try {
+            loadPrecompiled(midiResourcePath) ?: try {
                 val midiBytes = MidiResources.readMidiFile(midiResourcePath)
                 val parsedTrack = parseMidiBytes(midiBytes)
                 Log.i(TAG, "Successfully parsed and cached MIDI file: $midiResourcePath")
@@ -133,6 +139,30 @@ object MidiParser {
         return track
     }
 
+    /**
+     * Load the precompiled note stream shipped next to the MIDI file, if any (see [BinaryNoteFormat]).
+     * Any problem falls back to parsing the MIDI file.
+     */
+    private suspend fun loadPrecompiled(midiResourcePath: String): MidiTrack? {
+        val path = BinaryNoteFormat.precompiledPath(midiResourcePath)
+        return try {
+            BinaryNoteFormat.decode(MidiResources.readMidiFile(path))?.also {
+                Log.i(TAG, "Loaded precompiled note stream: $path (${it.notes.size} notes)")
+            }
+        } catch (e: org.jetbrains.compose.resources.MissingResourceException) {
+            Log.d(TAG, "No precompiled note stream for $midiResourcePath")
+            null
+        } catch (e: IllegalArgumentException) {
+            Log.w(TAG, "Invalid precompiled note stream $path: ${e.message}")
+            null
+        } catch (e: kotlinx.coroutines.CancellationException) {
+            throw e
+        } catch (e: Exception) {
+            Log.w(TAG, "Cannot read precompiled note stream $path: ${e.message}")
+            null
+        }
+    }
+
     /**
      * Clear the MIDI cache (useful for testing or memory management)
      */
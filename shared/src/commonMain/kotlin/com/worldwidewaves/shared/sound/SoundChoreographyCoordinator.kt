@@ -27,11 +27,15 @@ import com.worldwidewaves.shared.events.utils.CoroutineScopeProvider
 import com.worldwidewaves.shared.events.utils.DefaultCoroutineScopeProvider
 import com.worldwidewaves.shared.events.utils.IClock
 import com.worldwidewaves.shared.utils.Log
+import kotlinx.atomicfu.atomic
+import kotlinx.coroutines.CancellationException
 import kotlinx.coroutines.Job
 import kotlinx.coroutines.flow.combine
 import kotlinx.coroutines.launch
 import org.koin.core.component.KoinComponent
 import org.koin.core.component.inject
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
 import kotlin.time.ExperimentalTime
 
 /**
@@ -43,6 +47,8 @@ import kotlin.time.ExperimentalTime
  * - Observes user's area status globally for all loaded events
  * - Automatically detects which event the user is currently in
  * - Starts sound choreography when user enters area and event is active
+ * - Queues the hit tone on the audio clock just before the predicted hit, falling back
+ *   to playing it on hit detection
  * - Stops sound choreography when user leaves area or app goes to background
  * - Manages background audio permissions and lifecycle
  */
@@ -52,6 +58,12 @@ class SoundChoreographyCoordinator(
 ) : KoinComponent {
     companion object {
         private const val TAG = "WWW.Sound.Choir"
+
+        /**
+         * How long before the predicted hit the tone is queued. Within this window the observer
+         * ticks every 50ms, and position changes no longer move the hit time noticeably.
+         */
+        val SCHEDULE_LEAD = 1.seconds
     }
 
     @Suppress("UnusedPrivateProperty", "UnusedPrivateMember") // Injected for future clock-based features
@@ -189,9 +201,32 @@ class SoundChoreographyCoordinator(
 
         isActive = true
 
-        // Start observing wave hits and play sound only on transition (false -> true)
+        // Exactly one tone per hit: either queued ahead on the audio clock, or played on detection
+        val toneStarted = atomic(false)
+
         soundPlaybackJob =
             coroutineScopeProvider.scopeDefault().launch {
+                // Queue the tone at the predicted hit time once it is close enough to be stable,
+                // so all devices hit at the same instant start together (no detection jitter)
+                launch {
+                    event.observer.timeBeforeHit.collect { timeBeforeHit ->
+                        val isHitImminent = timeBeforeHit > Duration.ZERO && timeBeforeHit <= SCHEDULE_LEAD
+                        if (!isHitImminent || !isActive || event.observer.userHasBeenHit.value) return@collect
+                        val hitTime = event.wave.userHitDateTime() ?: return@collect
+                        if (!event.isRunning() || !toneStarted.compareAndSet(false, true)) return@collect
+
+                        try {
+                            Log.i(TAG, "User hit expected for event ${event.id} in $timeBeforeHit - scheduling sound")
+                            event.warming.scheduleSoundChoreographyTone(hitTime)
+                        } catch (e: CancellationException) {
+                            throw e
+                        } catch (e: Exception) {
+                            Log.e(TAG, "Error scheduling sound choreography tone", e)
+                        }
+                    }
+                }
+
+                // Fallback when no prediction came in time: play sound on transition (false -> true)
                 // Initialize previousHitState based on current state to prevent playing
                 // sound for already-hit events when entering the activity
                 var previousHitState = event.observer.userHasBeenHit.value
@@ -203,7 +238,7 @@ class SoundChoreographyCoordinator(
 
                     // Only play sound on transition from false to true (actual hit moment)
                     // AND only when the event is currently running (not done)
-                    if (isTransitionToHit && isEventActive) {
+                    if (isTransitionToHit && isEventActive && toneStarted.compareAndSet(false, true)) {
                         try {
                             Log.i(TAG, "User hit detected for event ${event.id} - playing sound")
                             event.warming.playCurrentSoundChoreographyTone()
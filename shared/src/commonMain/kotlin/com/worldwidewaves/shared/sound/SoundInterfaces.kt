@@ -21,6 +21,7 @@ package com.worldwidewaves.shared.sound
  * limitations under the License.
  */
 
+import kotlinx.coroutines.delay
 import kotlin.time.Duration
 
 /**
@@ -41,6 +42,27 @@ interface SoundPlayer {
         waveform: Waveform = Waveform.SINE,
     )
 
+    /**
+     * Play [tone] starting [startDelay] from now and return once it has been played.
+     *
+     * Platforms override this to queue the tone on the audio clock (sample-accurate start),
+     * so devices hit at the same instant sound together regardless of coroutine wakeup jitter.
+     * The default waits with a coroutine timer.
+     */
+    suspend fun scheduleTone(
+        tone: ToneSpec,
+        startDelay: Duration,
+    ) {
+        delay(startDelay)
+        playTone(tone.frequency, tone.amplitude, tone.duration, tone.waveform)
+    }
+
+    /**
+     * Pre-render tones that are about to be played, so [playTone] does no synthesis for them.
+     * Optional: players without a tone cache ignore it.
+     */
+    suspend fun prepareTones(tones: Collection<ToneSpec>) {}
+
     fun release()
 
     /**
@@ -0,0 +1,146 @@
+package com.worldwidewaves.shared.sound
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.milliseconds
+
+/**
+ * A tone as requested from [SoundPlayer.playTone], used to pre-render tones ahead of playback.
+ */
+data class ToneSpec(
+    val frequency: Double,
+    val amplitude: Double,
+    val duration: Duration,
+    val waveform: SoundPlayer.Waveform,
+)
+
+/**
+ * Ready-to-play mono Float PCM for synthesized tones, so playback does no synthesis.
+ *
+ * Tones are keyed by (frequency, amplitude, waveform, duration bucket). Durations are rounded
+ * up to [DURATION_BUCKET]: MIDI-derived note lengths collapse onto few entries and a note is
+ * at most one bucket longer than requested.
+ *
+ * Memory is bounded by [maxCachedSamples]; on-demand renders evict the least recently used
+ * tones, [prepare] stops once the budget is reached.
+ *
+ * Not thread-safe: callers serialize access (e.g. under their playback mutex), except [render].
+ */
+class ToneCache(
+    val sampleRate: Int,
+    private val maxCachedSamples: Int = DEFAULT_MAX_CACHED_SAMPLES,
+) {
+    companion object {
+        val DURATION_BUCKET = 10.milliseconds
+
+        /** ~16 MB of Float PCM, about 90 s of tones at 44.1 kHz. */
+        const val DEFAULT_MAX_CACHED_SAMPLES = 4_000_000
+
+        fun keyOf(tone: ToneSpec): Key {
+            val bucketNanos = DURATION_BUCKET.inWholeNanoseconds
+            val buckets = (tone.duration.inWholeNanoseconds + bucketNanos - 1) / bucketNanos
+            return Key(tone.frequency, tone.amplitude, tone.waveform, buckets.toInt())
+        }
+    }
+
+    data class Key(
+        val frequency: Double,
+        val amplitude: Double,
+        val waveform: SoundPlayer.Waveform,
+        val durationBuckets: Int,
+    ) {
+        val duration: Duration get() = DURATION_BUCKET * durationBuckets
+    }
+
+    // Insertion order doubles as recency order: hits are moved to the end
+    private val entries = LinkedHashMap<Key, FloatArray>()
+    private var cachedSamples = 0
+
+    val size: Int get() = entries.size
+
+    /** PCM for [tone], rendered and cached on first use. */
+    fun get(tone: ToneSpec): FloatArray {
+        val key = keyOf(tone)
+        entries.remove(key)?.let { samples ->
+            entries[key] = samples
+            return samples
+        }
+
+        val samples = render(key)
+        while (entries.isNotEmpty() && cachedSamples + samples.size > maxCachedSamples) {
+            val eldest = entries.keys.first()
+            cachedSamples -= entries.remove(eldest)?.size ?: 0
+        }
+        entries[key] = samples
+        cachedSamples += samples.size
+        return samples
+    }
+
+    /**
+     * Renders [tones] that are not cached yet, within the memory budget.
+     * @return Number of tones rendered
+     */
+    fun prepare(tones: Collection<ToneSpec>): Int {
+        var rendered = 0
+        for (key in missingKeys(tones)) {
+            if (!put(key, render(key))) break
+            rendered++
+        }
+        return rendered
+    }
+
+    /** Keys of [tones] not cached yet, to [render] outside the caller's serialization and [put] back. */
+    fun missingKeys(tones: Collection<ToneSpec>): List<Key> = tones.map(::keyOf).distinct().filter { it !in entries }
+
+    /**
+     * Caches [samples] rendered for [key] by [render], unless cached meanwhile.
+     * @return false if the memory budget is full (the tone is not cached)
+     */
+    fun put(
+        key: Key,
+        samples: FloatArray,
+    ): Boolean {
+        if (key in entries) return true
+        if (cachedSamples + samples.size > maxCachedSamples) return false
+        entries[key] = samples
+        cachedSamples += samples.size
+        return true
+    }
+
+    fun contains(tone: ToneSpec): Boolean = keyOf(tone) in entries
+
+    fun clear() {
+        entries.clear()
+        cachedSamples = 0
+    }
+
+    /** Synthesizes the PCM of [key]. Reads no cache state, so it needs no serialization. */
+    fun render(key: Key): FloatArray =
+        WaveformGenerator.generateFloatWaveform(
+            sampleRate = sampleRate,
+            frequency = key.frequency,
+            amplitude = key.amplitude,
+            duration = key.duration,
+            waveform = key.waveform,
+        )
+}
@@ -23,10 +23,22 @@ package com.worldwidewaves.shared.sound
 
 import com.worldwidewaves.shared.WWWGlobals
 import kotlin.math.PI
+import kotlin.math.floor
 import kotlin.math.pow
 import kotlin.math.sin
 import kotlin.time.Duration
 
+/**
+ * Platform SINE kernel: fills [output] with `sin(2π·(phase + i·phaseIncrement)) · amplitude`.
+ * Phases are in cycles. Vectorized with Accelerate on iOS, wavetable on Android.
+ */
+internal expect fun fillSine(
+    output: FloatArray,
+    phase: Double,
+    phaseIncrement: Double,
+    amplitude: Float,
+)
+
 /**
  * Shared waveform generation algorithms for all platforms
  */
@@ -54,11 +66,7 @@ object WaveformGenerator {
         require(duration >= Duration.ZERO) { "Duration must be non-negative, got: $duration" }
 
         // Calculate number of samples
-        val numSamples =
-            (
-                sampleRate * duration.inWholeSeconds +
-                    (sampleRate * (duration.inWholeNanoseconds % 1_000_000_000) / 1_000_000_000.0)
-            ).toInt()
+        val numSamples = sampleCount(sampleRate, duration)
 
         // Handle edge case of zero duration
         if (numSamples <= 0) {
@@ -114,6 +122,173 @@ object WaveformGenerator {
         return samples
     }
 
+    /**
+     * Generate Float PCM for the specified waveform, ready to hand to the audio API.
+     *
+     * Phase-accumulator synthesis: SINE goes through the platform kernel ([fillSine]: vDSP/vForce
+     * on iOS, wavetable elsewhere); SQUARE and SAWTOOTH are band-limited with PolyBLEP so high
+     * notes do not alias; TRIANGLE (harmonics falling as 1/n²) is generated directly.
+     * Same sample count, phase origin and envelope as [generateWaveform].
+     */
+    fun generateFloatWaveform(
+        sampleRate: Int,
+        frequency: Double,
+        amplitude: Double,
+        duration: Duration,
+        waveform: SoundPlayer.Waveform,
+    ): FloatArray {
+        require(sampleRate > 0) { "Sample rate must be positive, got: $sampleRate" }
+        require(frequency > 0.0 && frequency.isFinite()) { "Frequency must be positive and finite, got: $frequency" }
+        require(amplitude >= 0.0 && amplitude <= 1.0 && amplitude.isFinite()) { "Amplitude must be between 0.0 and 1.0, got: $amplitude" }
+        require(duration >= Duration.ZERO) { "Duration must be non-negative, got: $duration" }
+
+        val numSamples = sampleCount(sampleRate, duration)
+        if (numSamples <= 0) {
+            return floatArrayOf()
+        }
+
+        val samples = FloatArray(numSamples)
+        // Cycles per sample; aliased above the sample rate like the sampled signal would be
+        val phaseIncrement = (frequency / sampleRate).let { it - floor(it) }
+        val gain = amplitude.toFloat()
+
+        when (waveform) {
+            SoundPlayer.Waveform.SINE -> fillSine(samples, 0.0, phaseIncrement, gain)
+            SoundPlayer.Waveform.SQUARE -> {
+                var phase = 0.0
+                for (i in 0 until numSamples) {
+                    val naive = if (phase < 0.5) 1.0 else -1.0
+                    val shifted = if (phase < 0.5) phase + 0.5 else phase - 0.5
+                    samples[i] = ((naive + polyBlep(phase, phaseIncrement) - polyBlep(shifted, phaseIncrement)) * gain).toFloat()
+                    phase += phaseIncrement
+                    if (phase >= 1.0) phase -= 1.0
+                }
+            }
+            SoundPlayer.Waveform.TRIANGLE -> {
+                var phase = 0.0
+                for (i in 0 until numSamples) {
+                    val value =
+                        when {
+                            phase < 0.25 -> 4.0 * phase
+                            phase < 0.75 -> 2.0 - 4.0 * phase
+                            else -> 4.0 * phase - 4.0
+                        }
+                    samples[i] = (value * gain).toFloat()
+                    phase += phaseIncrement
+                    if (phase >= 1.0) phase -= 1.0
+                }
+            }
+            SoundPlayer.Waveform.SAWTOOTH -> {
+                var phase = 0.0
+                for (i in 0 until numSamples) {
+                    samples[i] = ((2.0 * phase - 1.0 - polyBlep(phase, phaseIncrement)) * gain).toFloat()
+                    phase += phaseIncrement
+                    if (phase >= 1.0) phase -= 1.0
+                }
+            }
+        }
+
+        applyEnvelope(samples, sampleRate)
+        return samples
+    }
+
+    /**
+     * Mix simultaneous voices into one Float PCM buffer as long as the longest voice.
+     * Each voice is scaled by 1/voice count, so the mix never clips.
+     */
+    fun mixVoices(
+        sampleRate: Int,
+        voices: Collection<ToneSpec>,
+    ): FloatArray {
+        if (voices.isEmpty()) return floatArrayOf()
+
+        val rendered = voices.map { generateFloatWaveform(sampleRate, it.frequency, it.amplitude, it.duration, it.waveform) }
+        val mix = FloatArray(rendered.maxOf { it.size })
+        val gain = 1.0f / voices.size
+        for (voice in rendered) {
+            for (i in voice.indices) {
+                mix[i] += voice[i] * gain
+            }
+        }
+        return mix
+    }
+
+    /**
+     * Wavetable SINE kernel with linear interpolation (max error ~1e-6 of full scale).
+     * @param phase Start phase, in cycles
+     * @param phaseIncrement Phase advance per sample, in cycles
+     */
+    internal fun fillSineWavetable(
+        output: FloatArray,
+        phase: Double,
+        phaseIncrement: Double,
+        amplitude: Float,
+    ) {
+        val table = sineTable
+        var position = (phase - floor(phase)) * SINE_TABLE_SIZE
+        val step = phaseIncrement * SINE_TABLE_SIZE
+        for (i in output.indices) {
+            val index = position.toInt()
+            val fraction = (position - index).toFloat()
+            val a = table[index]
+            output[i] = (a + (table[index + 1] - a) * fraction) * amplitude
+            position += step
+            while (position >= SINE_TABLE_SIZE) position -= SINE_TABLE_SIZE
+        }
+    }
+
+    private const val SINE_TABLE_SIZE = 2048
+
+    // One cycle plus a guard point so interpolation never wraps
+    private val sineTable: FloatArray by lazy {
+        FloatArray(SINE_TABLE_SIZE + 1) { sin(2.0 * PI * it / SINE_TABLE_SIZE).toFloat() }
+    }
+
+    /** PolyBLEP residual smoothing the step at phase 0 (phases in cycles). */
+    private fun polyBlep(
+        phase: Double,
+        phaseIncrement: Double,
+    ): Double =
+        when {
+            phase < phaseIncrement -> {
+                val t = phase / phaseIncrement
+                2.0 * t - t * t - 1.0
+            }
+            phase > 1.0 - phaseIncrement -> {
+                val t = (phase - 1.0) / phaseIncrement
+                t * t + 2.0 * t + 1.0
+            }
+            else -> 0.0
+        }
+
+    private fun sampleCount(
+        sampleRate: Int,
+        duration: Duration,
+    ): Int =
+        (
+            sampleRate * duration.inWholeSeconds +
+                (sampleRate * (duration.inWholeNanoseconds % 1_000_000_000) / 1_000_000_000.0)
+        ).toInt()
+
+    private fun applyEnvelope(
+        samples: FloatArray,
+        sampleRate: Int,
+    ) {
+        val attackSamples = (sampleRate * ENVELOPE_TIME).toInt()
+        val releaseSamples = (sampleRate * ENVELOPE_TIME).toInt()
+
+        for (i in 0 until attackSamples.coerceAtMost(samples.size)) {
+            samples[i] *= i.toFloat() / attackSamples
+        }
+
+        val releaseStart = (samples.size - releaseSamples).coerceAtLeast(0)
+        for (i in releaseStart until samples.size) {
+            samples[i] *= (samples.size - i).toFloat() / releaseSamples
+        }
+    }
+
+    private const val ENVELOPE_TIME = 0.01 // 10ms attack and release
+
     /**
      * Apply a simple attack/release envelope to avoid clicks
      */
@@ -0,0 +1,150 @@
+package com.worldwidewaves.shared.sound.midi
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.sound.MidiNote
+import com.worldwidewaves.shared.sound.MidiTrack
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.microseconds
+
+/**
+ * Precompiled choreography track (`<name>.wwn` next to `<name>.mid`), produced by
+ * `scripts/sound/midi-to-notes.js`.
+ *
+ * Replaces Standard MIDI File parsing (track chunks, running status, tempo map) on cold start:
+ * notes are already in real time and sorted by start, so decoding is one pass and the
+ * [MidiNoteStream] index is rebuilt in linear time without sorting.
+ *
+ * ## Layout (all fields little-endian Int32)
+ * ```
+ * 0   magic "WWWN"            4 bytes
+ * 4   version                 (= VERSION)
+ * 8   noteCount
+ * 12  totalDuration           microseconds
+ * 16  tempo                   BPM (last tempo of the source file)
+ * 20  notes                   noteCount × (start µs, duration µs, pitch | velocity << 8)
+ * ```
+ */
+object BinaryNoteFormat {
+    private const val MAGIC = 0x4E575757 // "WWWN" read as little-endian Int32
+    const val VERSION = 1
+    const val FILE_EXTENSION = "wwn"
+    private const val HEADER_INTS = 5
+    private const val NOTE_INTS = 3
+    private const val BYTE_MASK = 0xFF
+    private const val VELOCITY_SHIFT = 8
+
+    /** Resource path of the precompiled stream for a `.mid` resource path. */
+    fun precompiledPath(midiResourcePath: String): String = "${midiResourcePath.substringBeforeLast('.')}.$FILE_EXTENSION"
+
+    /**
+     * Decodes a `.wwn` file.
+     *
+     * @return The track, or null for an empty input
+     * @throws IllegalArgumentException if the file is truncated, unsorted, has a wrong magic or an unknown version
+     */
+    fun decode(bytes: ByteArray): MidiTrack? {
+        if (bytes.isEmpty()) return null
+        require(bytes.size >= HEADER_INTS * 4) { "truncated header (${bytes.size} bytes)" }
+        require(bytes.int(0) == MAGIC) { "bad magic" }
+        val version = bytes.int(1)
+        require(version == VERSION) { "unsupported version $version" }
+
+        val noteCount = bytes.int(2)
+        val totalDurationUs = bytes.int(3)
+        val tempo = bytes.int(4)
+        require(noteCount >= 0 && totalDurationUs >= 0 && tempo > 0) { "invalid header" }
+        val expectedInts = HEADER_INTS.toLong() + noteCount.toLong() * NOTE_INTS
+        require(bytes.size.toLong() == expectedInts * 4) { "size ${bytes.size} does not match header ($expectedInts ints)" }
+
+        var previousStart = 0
+        val notes =
+            List(noteCount) { i ->
+                val o = HEADER_INTS + i * NOTE_INTS
+                val start = bytes.int(o)
+                val duration = bytes.int(o + 1)
+                val packed = bytes.int(o + 2)
+                require(start >= previousStart && duration > 0) { "note $i out of order or empty" }
+                previousStart = start
+                MidiNote(
+                    pitch = packed and BYTE_MASK,
+                    velocity = (packed shr VELOCITY_SHIFT) and BYTE_MASK,
+                    startTime = start.microseconds,
+                    duration = duration.microseconds,
+                )
+            }
+
+        return MidiTrack(
+            name = "Precompiled MIDI Track",
+            notes = notes,
+            totalDuration = totalDurationUs.microseconds,
+            tempo = tempo,
+        )
+    }
+
+    /**
+     * Encodes [track] to the `.wwn` layout, notes sorted by start.
+     * Mirrors `scripts/sound/midi-to-notes.js`; used by tests and tooling.
+     */
+    fun encode(track: MidiTrack): ByteArray {
+        val notes = MidiNoteStream(track.notes).notes
+        val ints = IntArray(HEADER_INTS + notes.size * NOTE_INTS)
+        ints[0] = MAGIC
+        ints[1] = VERSION
+        ints[2] = notes.size
+        ints[3] = track.totalDuration.roundedMicros()
+        ints[4] = track.tempo
+
+        notes.forEachIndexed { i, note ->
+            val o = HEADER_INTS + i * NOTE_INTS
+            val start = note.startTime.roundedMicros()
+            ints[o] = start
+            ints[o + 1] = (note.startTime + note.duration).roundedMicros() - start
+            ints[o + 2] = (note.pitch and BYTE_MASK) or ((note.velocity and BYTE_MASK) shl VELOCITY_SHIFT)
+        }
+
+        return ByteArray(ints.size * 4).also { bytes -> ints.forEachIndexed { i, value -> bytes.putInt(i, value) } }
+    }
+
+    // ------------------------------------------------------------------------
+
+    private fun Duration.roundedMicros(): Int = ((inWholeNanoseconds + 500) / 1000).toInt()
+
+    private fun ByteArray.int(index: Int): Int {
+        val o = index * 4
+        return (this[o].toInt() and BYTE_MASK) or
+            ((this[o + 1].toInt() and BYTE_MASK) shl 8) or
+            ((this[o + 2].toInt() and BYTE_MASK) shl 16) or
+            ((this[o + 3].toInt() and BYTE_MASK) shl 24)
+    }
+
+    private fun ByteArray.putInt(
+        index: Int,
+        value: Int,
+    ) {
+        val o = index * 4
+        this[o] = value.toByte()
+        this[o + 1] = (value shr 8).toByte()
+        this[o + 2] = (value shr 16).toByte()
+        this[o + 3] = (value shr 24).toByte()
+    }
+}
@@ -0,0 +1,116 @@
+package com.worldwidewaves.shared.sound.midi
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.sound.MidiNote
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.seconds
+
+/**
+ * Time-sorted view of a track's notes with a bucket index, answering "which notes are active
+ * at this position" without scanning the whole track.
+ *
+ * Built once per [com.worldwidewaves.shared.sound.MidiTrack] (tracks are cached per resource
+ * by [com.worldwidewaves.shared.sound.MidiParser]), so every event playing the same file
+ * shares it. Each player walks it with its own [Cursor].
+ */
+class MidiNoteStream(
+    notes: List<MidiNote>,
+) {
+    companion object {
+        /** Width of an index bucket: a seek starts at most this far before the target. */
+        val INDEX_BUCKET: Duration = 1.seconds
+    }
+
+    /** Notes sorted by start time (stable: ties keep the source order). */
+    val notes: List<MidiNote> = if (notes.isSortedByStart()) notes else notes.sortedBy { it.startTime }
+
+    private val starts = LongArray(this.notes.size) { this.notes[it].startTime.inWholeNanoseconds }
+    private val ends = LongArray(this.notes.size) { (this.notes[it].startTime + this.notes[it].duration).inWholeNanoseconds }
+
+    /** Longest note: bounds how far back an active note can have started. */
+    val maxNoteDuration: Duration = this.notes.maxOfOrNull { it.duration } ?: Duration.ZERO
+
+    // index[k] = first note starting at or after k × INDEX_BUCKET; linear pass over sorted starts
+    private val index: IntArray = buildIndex()
+
+    private val bucketNanos = INDEX_BUCKET.inWholeNanoseconds
+    private val maxDurationNanos = maxNoteDuration.inWholeNanoseconds
+
+    fun cursor(): Cursor = Cursor()
+
+    /**
+     * Sliding window over the stream. Queries with non-decreasing positions (playback moving
+     * forward) cost O(1) amortized plus the number of overlapping notes; going backwards (loop
+     * wrap, seek) restarts from the index bucket.
+     *
+     * Not thread-safe: one cursor per player.
+     */
+    inner class Cursor internal constructor() {
+        val stream: MidiNoteStream get() = this@MidiNoteStream
+
+        private var lastPosition = Long.MIN_VALUE
+        private var low = 0 // Notes before low started at least maxNoteDuration ago
+        private var high = 0 // First note starting after the last position
+
+        /** Notes with `startTime <= position < startTime + duration`, in start order. */
+        fun activeAt(position: Duration): List<MidiNote> {
+            val t = position.inWholeNanoseconds
+            if (t < lastPosition) seek(t)
+            lastPosition = t
+
+            while (high < starts.size && starts[high] <= t) high++
+            while (low < high && starts[low] + maxDurationNanos <= t) low++
+
+            var active: MutableList<MidiNote>? = null
+            for (i in low until high) {
+                if (ends[i] > t) {
+                    (active ?: ArrayList<MidiNote>(high - i).also { active = it }).add(notes[i])
+                }
+            }
+            return active ?: emptyList()
+        }
+
+        private fun seek(t: Long) {
+            val earliest = t - maxDurationNanos
+            val bucket = if (earliest <= 0) 0L else earliest / bucketNanos
+            low = if (bucket < index.size) index[bucket.toInt()] else index.lastOrNull() ?: 0
+            high = low
+        }
+    }
+
+    private fun buildIndex(): IntArray {
+        if (starts.isEmpty()) return IntArray(0)
+        val bucketNanos = INDEX_BUCKET.inWholeNanoseconds
+        val bucketCount = (starts.last() / bucketNanos + 2).toInt()
+        val result = IntArray(bucketCount)
+        var note = 0
+        for (k in 0 until bucketCount) {
+            val bucketStart = k * bucketNanos
+            while (note < starts.size && starts[note] < bucketStart) note++
+            result[k] = note
+        }
+        return result
+    }
+
+    private fun List<MidiNote>.isSortedByStart(): Boolean = (1 until size).all { this[it - 1].startTime <= this[it].startTime }
+}
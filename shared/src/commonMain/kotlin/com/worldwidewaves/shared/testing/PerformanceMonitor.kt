@@ -22,6 +22,8 @@
 package com.worldwidewaves.shared.testing
 
 import com.worldwidewaves.shared.utils.Log
+import com.worldwidewaves.shared.utils.RenderStageStats
+import com.worldwidewaves.shared.utils.RenderTrace
 import kotlinx.coroutines.CoroutineScope
 import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.flow.MutableStateFlow
@@ -163,6 +165,8 @@ data class PerformanceReport(
     val metrics: PerformanceMetrics,
     val criticalIssues: List<PerformanceIssue>,
     val recommendations: List<String>,
+    /** Latency per stage of the wave render chain (see [RenderTrace]), stages that ran only. */
+    val renderStages: List<RenderStageStats> = emptyList(),
 )
 
 /**
@@ -208,6 +212,7 @@ open class PerformanceMonitor : IPerformanceMonitor {
         private const val MAX_MEMORY_USAGE_PERCENT = 80.0
         private const val PERCENT_MULTIPLIER = 100.0
         private const val MAX_SCREEN_LOAD_TIME_MS = 2000L
+        private const val MAX_RENDER_STAGE_P95_MS = 16L // One frame at 60 fps
         private const val DEFAULT_APP_VERSION = "1.0.0"
         private const val PERFORMANCE_ACCURACY_PERCENT_MULTIPLIER = 100.0
 
@@ -397,6 +402,7 @@ open class PerformanceMonitor : IPerformanceMonitor {
             metrics = _performanceMetrics.value,
             criticalIssues = detectCriticalIssues(),
             recommendations = generateRecommendations(),
+            renderStages = RenderTrace.stats(),
         )
 
     @OptIn(ExperimentalTime::class)
@@ -491,6 +497,10 @@ open class PerformanceMonitor : IPerformanceMonitor {
             recommendations.add("Consider lazy loading and caching strategies")
         }
 
+        RenderTrace.stats().filter { it.p95 > MAX_RENDER_STAGE_P95_MS.milliseconds }.forEach {
+            recommendations.add("Render stage ${it.stage.traceName} p95 is ${it.p95.inWholeMilliseconds}ms (frame budget exceeded)")
+        }
+
         return recommendations
     }
 
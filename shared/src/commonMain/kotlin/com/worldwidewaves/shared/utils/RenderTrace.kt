@@ -0,0 +1,214 @@
+package com.worldwidewaves.shared.utils
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlinx.atomicfu.locks.reentrantLock
+import kotlinx.atomicfu.locks.withLock
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.nanoseconds
+import kotlin.time.TimeSource
+
+/**
+ * Stages of the wave render chain, from observation tick to pixels.
+ *
+ * iOS runs every stage; Android has no registry/bridge hop (the map update goes straight to
+ * the adapter), so only [OBSERVER_UPDATE], [MAP_UPDATE] and [LAYER_UPDATE] are reported there.
+ */
+enum class RenderStage(
+    val traceName: String,
+) {
+    /** `WWWEventObserver.updateStates`: wave state computation for one tick. */
+    OBSERVER_UPDATE("observer.updateStates"),
+
+    /** `updateWavePolygons` on the platform event map (iOS: LOD, packing, delta; Android: GeoJSON conversion). */
+    MAP_UPDATE("map.updateWavePolygons"),
+
+    /** `MapWrapperRegistry.setPendingPolygons`: publishing a frame for Swift (iOS). */
+    REGISTRY_PUBLISH("registry.setPendingPolygons"),
+
+    /** `IOSMapBridge.renderPendingPolygons`: taking the frame and handing it to the wrapper (iOS). */
+    BRIDGE_RENDER("bridge.renderPendingPolygons"),
+
+    /** Style source/layer mutation on the main thread. */
+    LAYER_UPDATE("map.updatePolygonLayers"),
+
+    /** From the layer update to the end of the next MapLibre frame (iOS). */
+    FRAME("map.frame"),
+}
+
+/**
+ * Latency distribution of one [RenderStage] over the last [RenderTrace.SAMPLES_PER_STAGE] runs.
+ */
+data class RenderStageStats(
+    val stage: RenderStage,
+    val count: Long,
+    val p50: Duration,
+    val p95: Duration,
+    val max: Duration,
+)
+
+/**
+ * Platform profiler sections: `os_signpost` intervals on iOS (Instruments), async
+ * `android.os.Trace` sections on Android (Perfetto / systrace).
+ *
+ * Async sections are used because a stage may suspend and resume on another thread.
+ */
+@PublishedApi
+internal expect object PlatformTraceSection {
+    /** True while a profiler records; section labels are only built then. */
+    val isRecording: Boolean
+
+    fun begin(
+        stage: RenderStage,
+        detail: String,
+        cookie: Int,
+    )
+
+    fun end(
+        stage: RenderStage,
+        detail: String,
+        cookie: Int,
+    )
+}
+
+/**
+ * Hot-path instrumentation for the wave render chain (see [RenderStage]).
+ *
+ * Each stage is reported twice:
+ * - to the platform profiler, tagged with event id, polygon count and vertex count, only while
+ *   a profiler is recording
+ * - to an in-app aggregate (bounded ring buffer per stage) exposed as p50/p95 by [stats] and
+ *   included in [com.worldwidewaves.shared.testing.PerformanceReport]
+ *
+ * Cost when no profiler is attached: two monotonic clock reads and one short locked array
+ * write per stage.
+ *
+ * ```kotlin
+ * RenderTrace.trace(RenderStage.MAP_UPDATE, event.id, polygons.size, vertexCount) {
+ *     // stage work
+ * }
+ * ```
+ *
+ * Swift measures its own stages and reports them with [recordNanos].
+ */
+object RenderTrace {
+    /** Samples kept per stage for percentiles. */
+    const val SAMPLES_PER_STAGE = 256
+
+    private const val P50 = 0.50
+    private const val P95 = 0.95
+
+    private val lock = reentrantLock()
+    private val samples = Array(RenderStage.entries.size) { LongArray(SAMPLES_PER_STAGE) }
+    private val counts = LongArray(RenderStage.entries.size)
+    private var nextCookie = 0
+
+    /**
+     * Runs [block] as [stage] of the render chain for [eventId].
+     * Counts are only used for profiler labels; pass 0 when not known at that stage.
+     */
+    inline fun <T> trace(
+        stage: RenderStage,
+        eventId: String,
+        polygonCount: Int = 0,
+        vertexCount: Int = 0,
+        block: () -> T,
+    ): T {
+        val detail = if (PlatformTraceSection.isRecording) label(eventId, polygonCount, vertexCount) else null
+        val cookie = if (detail != null) beginSection(stage, detail) else 0
+        val start = TimeSource.Monotonic.markNow()
+        try {
+            return block()
+        } finally {
+            record(stage, start.elapsedNow())
+            if (detail != null) PlatformTraceSection.end(stage, detail, cookie)
+        }
+    }
+
+    /** Adds a measured run of [stage] to the aggregate. */
+    fun record(
+        stage: RenderStage,
+        duration: Duration,
+    ) = recordNanos(stage, duration.inWholeNanoseconds)
+
+    /** Same as [record], for callers without [Duration] (Swift). */
+    fun recordNanos(
+        stage: RenderStage,
+        nanos: Long,
+    ) {
+        lock.withLock {
+            val index = stage.ordinal
+            samples[index][(counts[index] % SAMPLES_PER_STAGE).toInt()] = nanos
+            counts[index]++
+        }
+    }
+
+    /** p50/p95/max per stage that ran at least once, in chain order. */
+    fun stats(): List<RenderStageStats> {
+        val snapshot =
+            lock.withLock {
+                RenderStage.entries.mapNotNull { stage ->
+                    val count = counts[stage.ordinal]
+                    if (count == 0L) return@mapNotNull null
+                    val kept = minOf(count, SAMPLES_PER_STAGE.toLong()).toInt()
+                    Triple(stage, count, samples[stage.ordinal].copyOf(kept))
+                }
+            }
+        return snapshot.map { (stage, count, values) ->
+            values.sort()
+            RenderStageStats(
+                stage = stage,
+                count = count,
+                p50 = values.percentile(P50).nanoseconds,
+                p95 = values.percentile(P95).nanoseconds,
+                max = values.last().nanoseconds,
+            )
+        }
+    }
+
+    /** Clears the aggregate (tests, or when a new measurement session starts). */
+    fun reset() {
+        lock.withLock {
+            counts.fill(0)
+        }
+    }
+
+    @PublishedApi
+    internal fun label(
+        eventId: String,
+        polygonCount: Int,
+        vertexCount: Int,
+    ): String = "event=$eventId polygons=$polygonCount vertices=$vertexCount"
+
+    @PublishedApi
+    internal fun beginSection(
+        stage: RenderStage,
+        detail: String,
+    ): Int {
+        val cookie = lock.withLock { ++nextCookie }
+        PlatformTraceSection.begin(stage, detail, cookie)
+        return cookie
+    }
+
+    // Nearest-rank percentile of a sorted, non-empty array
+    private fun LongArray.percentile(fraction: Double): Long = this[((size - 1) * fraction + 0.5).toInt()]
+}
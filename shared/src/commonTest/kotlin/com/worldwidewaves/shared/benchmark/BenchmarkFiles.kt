@@ -0,0 +1,39 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Access to repository files (city GeoJSON, MIDI) for benchmarks.
+ *
+ * Paths are relative to the repository root: the `wwwRepoRoot` system property on the JVM,
+ * the `WWW_REPO_ROOT` environment variable on iOS (both set by shared/build.gradle.kts), and
+ * the parent of the working directory otherwise.
+ */
+expect object BenchmarkFiles {
+    /** Platform label stored with each result ("jvm", "ios-native"). */
+    val platform: String
+
+    /** File content, or null when the file is not available (benchmarks then skip). */
+    fun readBytes(relativePath: String): ByteArray?
+}
+
+fun BenchmarkFiles.readText(relativePath: String): String? = readBytes(relativePath)?.decodeToString()
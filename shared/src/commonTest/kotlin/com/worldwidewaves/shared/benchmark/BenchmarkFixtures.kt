@@ -0,0 +1,95 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Area
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlinx.serialization.json.Json
+import kotlinx.serialization.json.JsonArray
+import kotlinx.serialization.json.double
+import kotlinx.serialization.json.jsonArray
+import kotlinx.serialization.json.jsonObject
+import kotlinx.serialization.json.jsonPrimitive
+
+/**
+ * Real data used by the benchmarks: city areas from the `maps/` modules and the choreography MIDI.
+ */
+object BenchmarkFixtures {
+    /** City areas of increasing size: 21 KB, 238 KB and 1.4 MB of GeoJSON. */
+    val CITIES = listOf("paris_france", "sydney_australia", "london_england")
+
+    const val MIDI_PATH = "shared/src/commonMain/composeResources/files/symfony.mid"
+
+    private val json = Json { ignoreUnknownKeys = true }
+    private val areaCache = mutableMapOf<String, Area?>()
+
+    /** Outer rings of every polygon of the city GeoJSON, or null when the map module is absent. */
+    fun cityArea(city: String): Area? =
+        areaCache.getOrPut(city) {
+            BenchmarkFiles.readText("maps/$city/src/main/assets/$city.geojson")?.let { parseArea(it) }
+        }
+
+    private fun parseArea(geoJson: String): Area {
+        val polygons = mutableListOf<Polygon>()
+        val features = json.parseToJsonElement(geoJson).jsonObject["features"]?.jsonArray ?: return polygons
+        features.forEach { feature ->
+            val geometry = feature.jsonObject["geometry"]?.jsonObject ?: return@forEach
+            val coordinates = geometry["coordinates"]?.jsonArray ?: return@forEach
+            when (geometry["type"]?.jsonPrimitive?.content) {
+                "Polygon" -> coordinates.firstOrNull()?.jsonArray?.let { polygons.add(parseRing(it)) }
+                "MultiPolygon" ->
+                    coordinates.forEach { polygon ->
+                        polygon.jsonArray.firstOrNull()?.jsonArray?.let { polygons.add(parseRing(it)) }
+                    }
+            }
+        }
+        return polygons
+    }
+
+    private fun parseRing(ring: JsonArray): Polygon =
+        Polygon.fromPositions(
+            ring.map { point ->
+                val lngLat = point.jsonArray
+                Position(lat = lngLat[1].jsonPrimitive.double, lng = lngLat[0].jsonPrimitive.double)
+            },
+        )
+
+    /** Deterministic positions spread over the bounding box of [area] (inside and outside). */
+    fun probePositions(
+        area: Area,
+        count: Int,
+    ): List<Position> {
+        val minLat = area.minOf { polygon -> polygon.minOf { it.lat } }
+        val maxLat = area.maxOf { polygon -> polygon.maxOf { it.lat } }
+        val minLng = area.minOf { polygon -> polygon.minOf { it.lng } }
+        val maxLng = area.maxOf { polygon -> polygon.maxOf { it.lng } }
+        // Golden-ratio sequence: even coverage without a random source
+        return List(count) { index ->
+            val u = (index * GOLDEN_RATIO) % 1.0
+            val v = (index * GOLDEN_RATIO * GOLDEN_RATIO) % 1.0
+            Position(lat = minLat + u * (maxLat - minLat), lng = minLng + v * (maxLng - minLng))
+        }
+    }
+
+    private const val GOLDEN_RATIO = 1.618033988749895
+}
@@ -0,0 +1,111 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlin.time.TimeSource
+
+/**
+ * One benchmark measurement, reported on one line of test output as `WWW-BENCH {json}`.
+ * `scripts/benchmarks/run_benchmarks.sh` collects these lines from the test reports and
+ * compares them with the stored baseline of the platform.
+ */
+data class BenchmarkResult(
+    val name: String,
+    val platform: String,
+    val iterations: Int,
+    val operationsPerIteration: Int,
+    val medianNanos: Long,
+    val p95Nanos: Long,
+    val minNanos: Long,
+) {
+    /** Median time of one operation. */
+    val nanosPerOperation: Double get() = medianNanos.toDouble() / operationsPerIteration
+
+    fun toJson(): String =
+        "{\"name\":\"$name\",\"platform\":\"$platform\",\"iterations\":$iterations," +
+            "\"operationsPerIteration\":$operationsPerIteration,\"medianNanos\":$medianNanos," +
+            "\"p95Nanos\":$p95Nanos,\"minNanos\":$minNanos,\"nanosPerOperation\":$nanosPerOperation}"
+}
+
+/**
+ * Minimal measurement loop shared by the JVM (androidUnitTest) and Kotlin/Native (iosTest) runs.
+ *
+ * Each iteration runs the block [operationsPerIteration] times and is timed with the monotonic
+ * clock; [warmupIterations] untimed iterations come first (JIT on the JVM, caches everywhere).
+ * Results of the block are folded into a sink so the work cannot be optimized away.
+ *
+ * Benchmarks live in the `benchmark` test packages and only run with `-Pbenchmarks`
+ * (see shared/build.gradle.kts).
+ */
+object BenchmarkRunner {
+    const val REPORT_PREFIX = "WWW-BENCH "
+
+    private const val PERCENTILE_95 = 0.95
+
+    private var sink = 0
+
+    suspend fun <T> measure(
+        name: String,
+        warmupIterations: Int = 5,
+        iterations: Int = 20,
+        operationsPerIteration: Int = 1,
+        block: suspend (operation: Int) -> T,
+    ): BenchmarkResult {
+        repeat(warmupIterations) { runIteration(operationsPerIteration, block) }
+
+        val samples = LongArray(iterations) { runIteration(operationsPerIteration, block) }
+        return report(name, samples, operationsPerIteration)
+    }
+
+    /** Reports samples measured elsewhere (one per iteration, in nanoseconds). */
+    fun report(
+        name: String,
+        samples: LongArray,
+        operationsPerIteration: Int = 1,
+    ): BenchmarkResult {
+        require(samples.isNotEmpty()) { "$name: no samples" }
+        val sorted = samples.sortedArray()
+        val result =
+            BenchmarkResult(
+                name = name,
+                platform = BenchmarkFiles.platform,
+                iterations = sorted.size,
+                operationsPerIteration = operationsPerIteration,
+                medianNanos = sorted[sorted.size / 2],
+                p95Nanos = sorted[((sorted.size - 1) * PERCENTILE_95).toInt()],
+                minNanos = sorted.first(),
+            )
+        println(REPORT_PREFIX + result.toJson())
+        return result
+    }
+
+    private suspend fun <T> runIteration(
+        operations: Int,
+        block: suspend (operation: Int) -> T,
+    ): Long {
+        val mark = TimeSource.Monotonic.markNow()
+        for (operation in 0 until operations) {
+            sink += block(operation).hashCode()
+        }
+        return mark.elapsedNow().inWholeNanoseconds
+    }
+}
@@ -0,0 +1,96 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.geometry.AreaSpatialIndex
+import com.worldwidewaves.shared.events.geometry.EventAreaPositionTesting
+import com.worldwidewaves.shared.events.geometry.PolygonOperations
+import com.worldwidewaves.shared.events.geometry.PolygonTransformations
+import com.worldwidewaves.shared.events.utils.Area
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.time.Duration.Companion.minutes
+
+/**
+ * Geometry hot paths on real city areas: wave splitting, half-plane clipping and the
+ * user-in-area test. Cities whose map module is not checked out are skipped.
+ */
+class GeometryBenchmark {
+    private fun forEachCity(block: suspend (city: String, area: Area) -> Unit) =
+        runTest(timeout = 10.minutes) {
+            BenchmarkFixtures.CITIES.forEach { city ->
+                val area = BenchmarkFixtures.cityArea(city)
+                if (area.isNullOrEmpty()) {
+                    println("Skipping $city: GeoJSON not available")
+                } else {
+                    block(city, area)
+                }
+            }
+        }
+
+    @Test
+    fun splitByLongitude() =
+        forEachCity { city, area ->
+            val bbox = PolygonOperations.polygonsBbox(area)
+            val cuts = List(CUTS) { bbox.minLongitude + (it + 1) * (bbox.maxLongitude - bbox.minLongitude) / (CUTS + 1) }
+
+            BenchmarkRunner.measure("splitByLongitude.$city", operationsPerIteration = CUTS) { index ->
+                area.sumOf { polygon -> PolygonTransformations.splitByLongitude(polygon, cuts[index]).left.size }
+            }
+        }
+
+    @Test
+    fun clipToHalfPlane() =
+        forEachCity { city, area ->
+            val bbox = PolygonOperations.polygonsBbox(area)
+            val rings = area.map { polygon -> polygon.toList() }
+            val cuts = List(CUTS) { bbox.minLongitude + (it + 1) * (bbox.maxLongitude - bbox.minLongitude) / (CUTS + 1) }
+
+            BenchmarkRunner.measure("clipToHalfPlane.$city", operationsPerIteration = CUTS) { index ->
+                rings.sumOf { ring -> PolygonTransformations.clipToHalfPlane(ring, cuts[index], keepLeft = true).size }
+            }
+        }
+
+    @Test
+    fun isPositionWithin() =
+        forEachCity { city, area ->
+            val bbox = PolygonOperations.polygonsBbox(area)
+            val probes = BenchmarkFixtures.probePositions(area, PROBES)
+            val index = AreaSpatialIndex.fromArea(area)
+
+            // No result cache: every probe is a new position, as for a moving user
+            BenchmarkRunner.measure("isPositionWithin.indexed.$city", operationsPerIteration = PROBES) { probe ->
+                EventAreaPositionTesting.isPositionWithin(probes[probe], bbox, area, null, index).first
+            }
+            BenchmarkRunner.measure("isPositionWithin.linear.$city", operationsPerIteration = PROBES) { probe ->
+                EventAreaPositionTesting.isPositionWithin(probes[probe], bbox, area, null).first
+            }
+            BenchmarkRunner.measure("AreaSpatialIndex.build.$city", iterations = 10) {
+                AreaSpatialIndex.fromArea(area)
+            }
+        }
+
+    private companion object {
+        const val CUTS = 8
+        const val PROBES = 1_000
+    }
+}
@@ -0,0 +1,73 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.sound.MidiParser
+import com.worldwidewaves.shared.sound.SoundPlayer
+import com.worldwidewaves.shared.sound.WaveformGenerator
+import com.worldwidewaves.shared.sound.midi.BinaryNoteFormat
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.minutes
+
+/**
+ * Sound hot paths: MIDI parsing of the choreography file and tone synthesis at hit time.
+ */
+class SoundBenchmark {
+    @Test
+    fun parseMidiBytes() =
+        runTest(timeout = 10.minutes) {
+            val bytes = BenchmarkFiles.readBytes(BenchmarkFixtures.MIDI_PATH)
+            if (bytes == null) {
+                println("Skipping parseMidiBytes: ${BenchmarkFixtures.MIDI_PATH} not available")
+                return@runTest
+            }
+
+            BenchmarkRunner.measure("MidiParser.parseMidiBytes.symfony") {
+                MidiParser.parseMidiBytes(bytes).notes.size
+            }
+
+            // The precompiled stream shipped next to it, which the app actually loads
+            BenchmarkFiles.readBytes(BinaryNoteFormat.precompiledPath(BenchmarkFixtures.MIDI_PATH))?.let { stream ->
+                BenchmarkRunner.measure("BinaryNoteFormat.decode.symfony") {
+                    BinaryNoteFormat.decode(stream)?.notes?.size
+                }
+            }
+        }
+
+    @Test
+    fun generateWaveform() =
+        runTest(timeout = 10.minutes) {
+            SoundPlayer.Waveform.entries.forEach { waveform ->
+                BenchmarkRunner.measure("WaveformGenerator.generateWaveform.${waveform.name.lowercase()}", operationsPerIteration = 10) {
+                    WaveformGenerator.generateWaveform(SAMPLE_RATE, FREQUENCY, AMPLITUDE, 500.milliseconds, waveform).size
+                }
+            }
+        }
+
+    private companion object {
+        const val SAMPLE_RATE = 44_100
+        const val FREQUENCY = 440.0
+        const val AMPLITUDE = 0.8
+    }
+}
@@ -0,0 +1,158 @@
+package com.worldwidewaves.shared.domain.scheduling
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.IClock
+import kotlinx.coroutines.CoroutineScope
+import kotlinx.coroutines.Job
+import kotlinx.coroutines.cancel
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.time.Duration
+import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.seconds
+import kotlin.time.Instant
+
+/**
+ * Tests for [ObservationEngine]: slot alignment, shared wake-ups and loop ownership.
+ */
+class ObservationEngineTest {
+    /** Clock whose delay jumps virtual time, recording every wake-up. */
+    private class TestClock(
+        private var currentTime: Instant = Instant.fromEpochMilliseconds(0),
+    ) : IClock {
+        val delays = mutableListOf<Duration>()
+
+        override fun now(): Instant = currentTime
+
+        override suspend fun delay(duration: Duration) {
+            delays.add(duration)
+            currentTime += duration
+            kotlinx.coroutines.delay(1)
+        }
+    }
+
+    @Test
+    fun `deadline is aligned to the next interval multiple`() {
+        assertEquals(
+            Instant.fromEpochMilliseconds(2_000),
+            ObservationEngine.alignedDeadline(Instant.fromEpochMilliseconds(1_234), 1.seconds),
+        )
+        assertEquals(
+            Instant.fromEpochMilliseconds(3_000),
+            ObservationEngine.alignedDeadline(Instant.fromEpochMilliseconds(2_000), 1.seconds),
+        )
+        assertEquals(
+            Instant.fromEpochMilliseconds(1_250),
+            ObservationEngine.alignedDeadline(Instant.fromEpochMilliseconds(1_234), 50.milliseconds),
+        )
+    }
+
+    @Test
+    fun `registrations in the same tier share one wake-up per deadline`() =
+        runTest {
+            val clock = TestClock()
+            val engine = ObservationEngine(clock)
+            val counts = IntArray(3)
+
+            repeat(3) { index ->
+                engine.schedule("event-$index", this, 1.seconds) {
+                    counts[index]++
+                    if (counts[index] < 3) 1.seconds else null
+                }
+            }
+            testScheduler.advanceUntilIdle()
+
+            assertEquals(listOf(3, 3, 3), counts.toList())
+            assertEquals(3, clock.delays.size, "Expected one wake-up per deadline, got ${clock.delays}")
+            assertEquals(0, engine.registrationCount())
+        }
+
+    @Test
+    fun `shorter tiers are observed more often than longer ones`() =
+        runTest {
+            val clock = TestClock()
+            val engine = ObservationEngine(clock)
+            var fast = 0
+            var slow = 0
+
+            engine.schedule("slow", this, 1.seconds) {
+                slow++
+                if (slow < 2) 1.seconds else null
+            }
+            engine.schedule("fast", this, 200.milliseconds) {
+                fast++
+                if (clock.now() < Instant.fromEpochMilliseconds(2_000)) 200.milliseconds else null
+            }
+            testScheduler.advanceUntilIdle()
+
+            assertEquals(2, slow)
+            assertEquals(10, fast)
+            assertEquals(0, engine.registrationCount())
+        }
+
+    @Test
+    fun `cancelled registration is not observed again`() =
+        runTest {
+            val clock = TestClock()
+            val engine = ObservationEngine(clock)
+            var count = 0
+            lateinit var registration: ObservationEngine.Registration
+
+            registration =
+                engine.schedule("event", this, 1.seconds) {
+                    count++
+                    if (count == 2) registration.cancel()
+                    1.seconds
+                }
+            testScheduler.advanceUntilIdle()
+
+            assertEquals(2, count)
+            assertEquals(0, engine.registrationCount())
+        }
+
+    @Test
+    fun `loop moves to another registration when its owner scope is cancelled`() =
+        runTest {
+            val clock = TestClock()
+            val engine = ObservationEngine(clock)
+            val ownerScope = CoroutineScope(coroutineContext + Job(coroutineContext[Job]))
+            var ownerCount = 0
+            var otherCount = 0
+
+            engine.schedule("owner", ownerScope, 1.seconds) {
+                ownerCount++
+                ownerScope.cancel()
+                1.seconds
+            }
+            engine.schedule("other", this, 1.seconds) {
+                otherCount++
+                if (otherCount < 3) 1.seconds else null
+            }
+            testScheduler.advanceUntilIdle()
+
+            assertEquals(1, ownerCount)
+            assertEquals(3, otherCount)
+            assertEquals(0, engine.registrationCount())
+        }
+}
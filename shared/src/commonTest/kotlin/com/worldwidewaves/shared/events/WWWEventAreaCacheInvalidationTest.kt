@@ -104,7 +104,7 @@ class WWWEventAreaCacheInvalidationTest {
     fun testClearCachePreservesPolygonData() {
         // This test documents the expected behavior after the fix.
         // The fix is at WWWEventArea.kt lines 121-130:
-        //   clearCache() now preserves cachedAreaPolygons and _polygonsLoaded
+        //   clearCache() now preserves the cached polygons and _polygonsLoaded
         //   Only clears derived data: cachedBoundingBox, cachedCenter, cachedPositionWithinResult
         //
         // Before fix: clearCache() set cachedAreaPolygons = null, causing expensive reloads
@@ -148,7 +148,7 @@ class WWWEventAreaCacheInvalidationTest {
 
         // This test serves as documentation of the expected behavior:
         // - Called when map download completes (platformInvalidateGeoJson)
-        // - Clears cachedAreaPolygons to null (forces reload)
+        // - Removes the polygons from AreaGeometryCache (forces reload)
         // - Sets _polygonsLoaded to false (accurate state)
         // - Uses mutex for thread safety
         // - Allows next getPolygons() to load from downloaded file
@@ -0,0 +1,61 @@
+package com.worldwidewaves.shared.events.config
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class EventsConfigurationDiffTest {
+    @Test
+    fun `only new and modified events are reported as changed`() {
+        val previous = """[{"id":"paris","speed":5},{"id":"tokyo","speed":6},{"id":"lima","speed":7}]"""
+        val current = """[{"id":"tokyo", "speed": 6},{"id":"paris","speed":8},{"id":"rome","speed":5}]"""
+
+        val diff = EventsConfigurationDiff.between(previous, current)
+
+        assertEquals(listOf("tokyo", "paris", "rome"), diff.ids)
+        assertTrue(diff.isUnchanged("tokyo")) // Same tree, different formatting
+        assertFalse(diff.isUnchanged("paris"))
+        assertFalse(diff.isUnchanged("rome"))
+        assertFalse(diff.isUnchanged("lima")) // Removed
+        assertEquals("""[{"id":"paris","speed":8},{"id":"rome","speed":5}]""", diff.changedConfiguration())
+    }
+
+    @Test
+    fun `entries without an id are always decoded`() {
+        val diff = EventsConfigurationDiff.between("""[{"speed":5}]""", """[{"speed":5}]""")
+
+        assertTrue(diff.ids.isEmpty())
+        assertEquals(1, diff.changed.size)
+    }
+
+    @Test
+    fun `configuration that is not an array is rejected`() {
+        assertFailsWith<IllegalArgumentException> {
+            EventsConfigurationDiff.between("[]", """{"id":"paris"}""")
+        }
+    }
+}
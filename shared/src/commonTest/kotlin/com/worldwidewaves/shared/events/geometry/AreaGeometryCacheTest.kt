@@ -0,0 +1,170 @@
+package com.worldwidewaves.shared.events.geometry
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Area
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.hours
+import kotlin.time.Duration.Companion.minutes
+import kotlin.time.Duration.Companion.seconds
+
+class AreaGeometryCacheTest {
+    private fun square(offset: Double): Area =
+        listOf(
+            Polygon.fromPositions(
+                Position(offset, offset),
+                Position(offset + 1, offset),
+                Position(offset + 1, offset + 1),
+                Position(offset, offset + 1),
+                Position(offset, offset),
+            ),
+        )
+
+    private val areaBytes = AreaGeometryCache.estimateBytes(square(0.0))
+
+    private fun cacheFor(areas: Int) = AreaGeometryCache(budgetBytes = areas * areaBytes)
+
+    @Test
+    fun `put indexes the area and get returns the same entry`() {
+        val cache = cacheFor(2)
+        val polygons = square(0.0)
+        val key = cache.newKey()
+
+        val entry = cache.put(key, "paris", polygons)
+
+        assertSame(entry, cache.get(key))
+        assertSame(polygons, entry.polygons)
+        assertTrue(entry.spatialIndex.containsPosition(Position(0.5, 0.5)))
+        assertEquals(areaBytes, cache.sizeBytes())
+    }
+
+    @Test
+    fun `least recently used area is evicted over budget`() {
+        val cache = cacheFor(2)
+        val (a, b, c) = List(3) { cache.newKey() }
+        cache.put(a, "a", square(0.0))
+        cache.put(b, "b", square(2.0))
+        cache.get(a) // b is now the least recently used
+
+        cache.put(c, "c", square(4.0))
+
+        assertNotNull(cache.get(a))
+        assertNull(cache.get(b))
+        assertNotNull(cache.get(c))
+        assertEquals(2 * areaBytes, cache.sizeBytes())
+    }
+
+    @Test
+    fun `area larger than the budget is still cached`() {
+        val cache = AreaGeometryCache(budgetBytes = areaBytes / 2)
+        val key = cache.newKey()
+
+        cache.put(key, "tokyo", square(0.0))
+
+        assertNotNull(cache.get(key))
+    }
+
+    @Test
+    fun `areas observed soon stay resident while others are evicted`() {
+        val cache = cacheFor(2)
+        val (soon, later, next) = List(3) { cache.newKey() }
+        cache.put(soon, "soon", square(0.0))
+        cache.put(later, "later", square(2.0))
+        cache.noteNextObservation("soon", 1.seconds)
+        cache.noteNextObservation("later", 1.hours)
+
+        cache.put(next, "next", square(4.0))
+
+        assertNotNull(cache.get(soon))
+        assertNull(cache.get(later))
+    }
+
+    @Test
+    fun `resident area observed furthest ahead goes first when the budget requires it`() {
+        val cache = cacheFor(2)
+        val (a, b, c) = List(3) { cache.newKey() }
+        cache.put(a, "a", square(0.0))
+        cache.put(b, "b", square(2.0))
+        cache.noteNextObservation("a", 5.minutes)
+        cache.noteNextObservation("b", 1.seconds)
+
+        cache.put(c, "c", square(4.0))
+
+        assertNull(cache.get(a))
+        assertNotNull(cache.get(b))
+        assertNotNull(cache.get(c))
+    }
+
+    @Test
+    fun `stopped observation releases residency`() {
+        val cache = cacheFor(3)
+        val key = cache.newKey()
+        cache.put(key, "a", square(0.0))
+        cache.noteNextObservation("a", 1.seconds)
+        assertEquals(0, cache.trim(AreaGeometryCache.TrimLevel.CRITICAL))
+
+        cache.noteNextObservation("a", null)
+
+        assertEquals(1, cache.trim(AreaGeometryCache.TrimLevel.CRITICAL))
+        assertNull(cache.get(key))
+    }
+
+    @Test
+    fun `trim levels keep resident areas`() {
+        val cache = cacheFor(4)
+        val keys = List(4) { cache.newKey() }
+        keys.forEachIndexed { i, key -> cache.put(key, "e$i", square(i * 2.0)) }
+        cache.noteNextObservation("e0", 500.seconds)
+
+        // Moderate: down to half the budget, least recently used first
+        assertEquals(2, cache.trim(AreaGeometryCache.TrimLevel.MODERATE))
+        assertNotNull(cache.get(keys[0]))
+        assertNull(cache.get(keys[1]))
+        assertNull(cache.get(keys[2]))
+        assertNotNull(cache.get(keys[3]))
+
+        // Critical: everything but the resident area
+        assertEquals(1, cache.trim(AreaGeometryCache.TrimLevel.CRITICAL))
+        assertNotNull(cache.get(keys[0]))
+        assertEquals(1, cache.size())
+    }
+
+    @Test
+    fun `remove forgets the area and its size`() {
+        val cache = cacheFor(2)
+        val key = cache.newKey()
+        cache.put(key, "a", square(0.0))
+
+        cache.remove(key)
+
+        assertNull(cache.get(key))
+        assertEquals(0L, cache.sizeBytes())
+    }
+}
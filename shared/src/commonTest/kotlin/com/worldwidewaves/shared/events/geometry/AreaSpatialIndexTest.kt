@@ -0,0 +1,82 @@
+package com.worldwidewaves.shared.events.geometry
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.geometry.PolygonOperations.isPointInPolygons
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.PI
+import kotlin.math.cos
+import kotlin.math.sin
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+
+class AreaSpatialIndexTest {
+    /** Closed concave ring with [count] vertices (large enough to get edge strips). */
+    private fun jaggedRing(
+        centerLat: Double,
+        centerLng: Double,
+        count: Int,
+        random: Random,
+    ): Polygon =
+        Polygon().apply {
+            for (i in 0 until count) {
+                val angle = 2 * PI * i / count
+                val radius = 0.03 + random.nextDouble() * 0.02
+                add(Position(centerLat + radius * sin(angle), centerLng + radius * cos(angle)))
+            }
+            add(first()!!.let { Position(it.lat, it.lng) })
+        }
+
+    @Test
+    fun `indexed test matches full scan on a multipolygon area`() {
+        val random = Random(7)
+        val area = (0 until 12).map { jaggedRing(48.0 + (it / 4) * 0.1, 2.0 + (it % 4) * 0.1, 300, random) }
+        val index = AreaSpatialIndex.fromArea(area)
+
+        repeat(5000) {
+            val position = Position(47.9 + random.nextDouble() * 0.4, 1.9 + random.nextDouble() * 0.5)
+            assertEquals(isPointInPolygons(position, area), index.containsPosition(position), "Mismatch at $position")
+        }
+    }
+
+    @Test
+    fun `vertices and small rings are handled`() {
+        val random = Random(3)
+        val big = jaggedRing(10.0, 10.0, 200, random)
+        val triangle = Polygon.fromPositions(Position(0.0, 0.0), Position(1.0, 0.0), Position(0.0, 1.0))
+        val index = AreaSpatialIndex.fromArea(listOf(big, triangle))
+
+        big.forEach { assertTrue(index.containsPosition(it), "Vertex $it must be inside") }
+        assertTrue(index.containsPosition(Position(0.2, 0.2)))
+        assertFalse(index.containsPosition(Position(0.9, 0.9)))
+        assertFalse(index.containsPosition(Position(50.0, 50.0)))
+    }
+
+    @Test
+    fun `empty area contains nothing`() {
+        assertFalse(AreaSpatialIndex.fromArea(emptyList()).containsPosition(Position(0.0, 0.0)))
+    }
+}
@@ -0,0 +1,100 @@
+package com.worldwidewaves.shared.events.geometry
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.PI
+import kotlin.math.cos
+import kotlin.math.sin
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class PolygonSimplificationTest {
+    /** Closed circle-like ring with [count] vertices around (48.85, 2.35). */
+    private fun denseRing(
+        count: Int,
+        radius: Double = 0.05,
+    ): Polygon =
+        Polygon().apply {
+            for (i in 0 until count) {
+                val angle = 2 * PI * i / count
+                add(Position(48.85 + radius * sin(angle), 2.35 + radius * cos(angle)))
+            }
+            add(Position(48.85, 2.35 + radius))
+        }
+
+    @Test
+    fun `dense ring is decimated by an order of magnitude at city overview zoom`() {
+        val ring = denseRing(5000)
+
+        val simplified = PolygonSimplification.simplify(ring, PolygonSimplification.degreesPerPixel(11.0))
+
+        assertTrue(simplified.size * 10 < ring.size, "Expected >10x reduction, got ${simplified.size}/${ring.size}")
+        assertEquals(simplified.first(), simplified.last(), "Closure must be preserved")
+    }
+
+    @Test
+    fun `collinear intermediate points are removed`() {
+        val square =
+            Polygon().apply {
+                add(Position(0.0, 0.0))
+                for (i in 1..9) add(Position(0.0, i * 0.1))
+                add(Position(0.0, 1.0))
+                add(Position(1.0, 1.0))
+                add(Position(1.0, 0.0))
+                add(Position(0.0, 0.0))
+            }
+
+        val simplified = PolygonSimplification.simplify(square, 1e-9)
+
+        assertEquals(5, simplified.size)
+    }
+
+    @Test
+    fun `zero tolerance and tiny rings are returned unchanged`() {
+        val ring = denseRing(100)
+        val triangle = Polygon.fromPositions(Position(0.0, 0.0), Position(0.0, 1.0), Position(1.0, 0.0))
+
+        assertSame(ring, PolygonSimplification.simplify(ring, 0.0))
+        assertSame(triangle, PolygonSimplification.simplify(triangle, 10.0))
+    }
+
+    @Test
+    fun `huge tolerance still keeps a triangle`() {
+        val simplified = PolygonSimplification.simplify(denseRing(500), 10.0)
+
+        assertEquals(4, simplified.size) // three distinct vertices + closing point
+    }
+
+    @Test
+    fun `content fingerprint ignores identity but not coordinates`() {
+        val a = Polygon.fromPositions(Position(1.0, 2.0), Position(3.0, 4.0))
+        val b = Polygon.fromPositions(Position(1.0, 2.0), Position(3.0, 4.0))
+        val c = Polygon.fromPositions(Position(1.0, 2.0), Position(3.0, 4.5))
+
+        assertEquals(a.contentFingerprint(), b.contentFingerprint())
+        assertTrue(a.contentFingerprint() != c.contentFingerprint())
+    }
+}
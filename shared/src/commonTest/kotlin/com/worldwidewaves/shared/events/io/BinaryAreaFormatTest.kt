@@ -0,0 +1,78 @@
+package com.worldwidewaves.shared.events.io
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.abs
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class BinaryAreaFormatTest {
+    private fun ring(
+        random: Random,
+        count: Int,
+    ): List<Position> =
+        List(count) { Position(-60.0 + random.nextDouble() * 120.0, -179.0 + random.nextDouble() * 358.0) }
+
+    @Test
+    fun `round trip keeps rings within quantization step`() {
+        val random = Random(5)
+        val rings = listOf(ring(random, 500), ring(random, 3), ring(random, 42))
+        val decoded = assertNotNull(BinaryAreaFormat.decode(BinaryAreaFormat.encode(rings)))
+
+        assertEquals(3, decoded.ringCount)
+        assertEquals(545, decoded.vertexCount)
+        rings.forEachIndexed { index, expected ->
+            val actual = decoded.ringPositions(index)
+            assertEquals(expected.size, actual.size)
+            expected.zip(actual).forEach { (e, a) ->
+                assertTrue(abs(e.lat - a.lat) <= 1e-7 && abs(e.lng - a.lng) <= 1e-7, "Drift at $e -> $a")
+            }
+        }
+    }
+
+    @Test
+    fun `empty area round trips`() {
+        val decoded = assertNotNull(BinaryAreaFormat.decode(BinaryAreaFormat.encode(emptyList())))
+        assertEquals(0, decoded.ringCount)
+        assertNull(BinaryAreaFormat.decode(ByteArray(0)))
+    }
+
+    @Test
+    fun `corrupt files are rejected`() {
+        val bytes = BinaryAreaFormat.encode(listOf(ring(Random(1), 10)))
+
+        assertFailsWith<IllegalArgumentException> { BinaryAreaFormat.decode(bytes.copyOf(bytes.size - 4)) }
+        assertFailsWith<IllegalArgumentException> { BinaryAreaFormat.decode(bytes.copyOf(12)) }
+        assertFailsWith<IllegalArgumentException> {
+            BinaryAreaFormat.decode(bytes.copyOf().also { it[0] = 'X'.code.toByte() })
+        }
+        assertFailsWith<IllegalArgumentException> {
+            BinaryAreaFormat.decode(bytes.copyOf().also { it[4] = 99 })
+        }
+    }
+}
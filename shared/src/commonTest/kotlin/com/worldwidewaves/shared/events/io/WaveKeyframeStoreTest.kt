@@ -0,0 +1,101 @@
+package com.worldwidewaves.shared.events.io
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.io.WaveKeyframeStore.Keyframe
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.abs
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+class WaveKeyframeStoreTest {
+    private val stamp = "1700000000000"
+    private val waveKey = "linear;5.0;EAST;"
+
+    private fun polygon(
+        random: Random,
+        count: Int,
+    ): Polygon = Polygon.fromPositions(List(count) { Position(48.0 + random.nextDouble(), 2.0 + random.nextDouble()) })
+
+    private fun keyframe(): Keyframe {
+        val random = Random(3)
+        return Keyframe(
+            elapsed = 12_345.milliseconds,
+            traversedPolygons = listOf(polygon(random, 40), polygon(random, 3)),
+            remainingPolygons = listOf(polygon(random, 120)),
+        )
+    }
+
+    @Test
+    fun `round trip keeps the split within quantization step`() {
+        val expected = keyframe()
+        val decoded = assertNotNull(WaveKeyframeStore.decode(WaveKeyframeStore.encode(stamp, waveKey, expected), stamp, waveKey))
+
+        assertEquals(expected.elapsed, decoded.elapsed)
+        assertEquals(expected.vertexCount, decoded.vertexCount)
+        assertEquals(expected.traversedPolygons.size, decoded.traversedPolygons.size)
+        assertEquals(expected.remainingPolygons.size, decoded.remainingPolygons.size)
+        (expected.traversedPolygons + expected.remainingPolygons)
+            .zip(decoded.traversedPolygons + decoded.remainingPolygons)
+            .forEach { (e, a) ->
+                e.zip(a).forEach { (ep, ap) ->
+                    assertTrue(abs(ep.lat - ap.lat) <= 1e-7 && abs(ep.lng - ap.lng) <= 1e-7, "Drift at $ep -> $ap")
+                }
+            }
+    }
+
+    @Test
+    fun `empty split round trips`() {
+        val empty = Keyframe(1_000.milliseconds, emptyList(), listOf(Polygon()))
+        val decoded = assertNotNull(WaveKeyframeStore.decode(WaveKeyframeStore.encode(stamp, waveKey, empty), stamp, waveKey))
+
+        assertTrue(decoded.traversedPolygons.isEmpty() && decoded.remainingPolygons.isEmpty())
+        assertNull(WaveKeyframeStore.decode("", stamp, waveKey))
+    }
+
+    @Test
+    fun `keyframes of another app version or wave are ignored`() {
+        val text = WaveKeyframeStore.encode(stamp, waveKey, keyframe())
+
+        assertNull(WaveKeyframeStore.decode(text, "1800000000000", waveKey))
+        assertNull(WaveKeyframeStore.decode(text, stamp, "linear;5.0;WEST;"))
+    }
+
+    @Test
+    fun `corrupt files are rejected`() {
+        val text = WaveKeyframeStore.encode(stamp, waveKey, keyframe())
+        val lines = text.lines()
+
+        // Write interrupted before the end marker, or in the middle of a polygon
+        assertFailsWith<IllegalArgumentException> { WaveKeyframeStore.decode(lines.dropLast(2).joinToString("\n"), stamp, waveKey) }
+        assertFailsWith<IllegalArgumentException> { WaveKeyframeStore.decode(text.substring(0, text.length / 2), stamp, waveKey) }
+        assertFailsWith<IllegalArgumentException> { WaveKeyframeStore.decode(text.replace("WWWK 1", "WWWK 9"), stamp, waveKey) }
+        assertFailsWith<IllegalArgumentException> { WaveKeyframeStore.decode("not a keyframe\n", stamp, waveKey) }
+    }
+}
@@ -0,0 +1,134 @@
+package com.worldwidewaves.shared.events.utils
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.geometry.PolygonOperations.containsPosition
+import com.worldwidewaves.shared.events.geometry.PolygonOperations.isPointInPackedPolygons
+import com.worldwidewaves.shared.events.geometry.PolygonOperations.isPointInPolygons
+import com.worldwidewaves.shared.events.geometry.PolygonTransformations
+import kotlin.math.PI
+import kotlin.math.abs
+import kotlin.math.cos
+import kotlin.math.sin
+import kotlin.random.Random
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class PackedPolygonTest {
+    /** Closed star-shaped (concave) ring around (48.85, 2.35). */
+    private fun star(count: Int = 40): Polygon =
+        Polygon().apply {
+            for (i in 0 until count) {
+                val angle = 2 * PI * i / count
+                val radius = if (i % 2 == 0) 0.05 else 0.02
+                add(Position(48.85 + radius * sin(angle), 2.35 + radius * cos(angle)))
+            }
+            add(Position(48.85, 2.40))
+        }
+
+    @Test
+    fun `packing drops the closing vertex and caches bbox and area`() {
+        val square =
+            Polygon.fromPositions(
+                Position(0.0, 0.0),
+                Position(0.0, 2.0),
+                Position(1.0, 2.0),
+                Position(1.0, 0.0),
+                Position(0.0, 0.0),
+            )
+
+        val packed = PackedPolygon.fromPolygon(square)
+
+        assertEquals(4, packed.size)
+        assertEquals(square.bbox(), packed.bbox())
+        assertEquals(2.0, packed.area, 1e-12)
+        assertEquals(square.isClockwise(), packed.isClockwise)
+        assertEquals(square.toList(), packed.toPolygon().toList())
+    }
+
+    @Test
+    fun `containment matches the linked polygon on random points`() {
+        val ring = star()
+        val packed = PackedPolygon.fromPolygon(ring)
+        val random = Random(42)
+
+        repeat(2000) {
+            val position = Position(48.78 + random.nextDouble() * 0.14, 2.28 + random.nextDouble() * 0.14)
+            assertEquals(ring.containsPosition(position), packed.containsPosition(position), "Mismatch at $position")
+        }
+        assertTrue(packed.containsPosition(ring.first()!!), "Vertices are inside")
+    }
+
+    @Test
+    fun `packed area test matches area test`() {
+        val area = listOf(star(), Polygon.fromPositions(Position(10.0, 10.0), Position(11.0, 10.0), Position(11.0, 11.0)))
+        val packed = area.packed()
+
+        for (position in listOf(Position(48.85, 2.35), Position(10.9, 10.5), Position(10.1, 10.9), Position(0.0, 0.0))) {
+            assertEquals(isPointInPolygons(position, area), isPointInPackedPolygons(position, packed), "Mismatch at $position")
+        }
+    }
+
+    @Test
+    fun `clipping matches the list based clip`() {
+        val ring = star()
+        val packed = PackedPolygon.fromPolygon(ring)
+
+        for (cut in listOf(2.31, 2.35, 2.372)) {
+            for (keepLeft in listOf(true, false)) {
+                val expected = PolygonTransformations.clipToHalfPlane(packed.toPolygon(close = false).toList(), cut, keepLeft)
+                val clipped = packed.clipToHalfPlane(cut, keepLeft)
+
+                assertEquals(expected.size, clipped.size, "cut=$cut keepLeft=$keepLeft")
+                expected.forEachIndexed { i, position ->
+                    assertEquals(position.lat, clipped.lat(i), 1e-12)
+                    assertEquals(position.lng, clipped.lng(i), 1e-12)
+                }
+            }
+        }
+    }
+
+    @Test
+    fun `clipping keeps the whole ring or nothing when the cut misses it`() {
+        val packed = PackedPolygon.fromPolygon(star())
+
+        assertSame(packed, packed.clipToHalfPlane(3.0, keepLeft = true))
+        assertTrue(packed.clipToHalfPlane(3.0, keepLeft = false).isEmpty())
+    }
+
+    @Test
+    fun `vertical split of a plain ring preserves total area`() {
+        val ring = star()
+        val total = PackedPolygon.fromPolygon(ring).area
+
+        val split = PolygonTransformations.splitByLongitude(ring, 2.36)
+        val left = split.left.sumOf { PackedPolygon.fromPolygon(it).area }
+        val right = split.right.sumOf { PackedPolygon.fromPolygon(it).area }
+
+        assertTrue(abs(total - left - right) < 1e-9, "Area $total != $left + $right")
+        assertFalse(split.left.isEmpty() || split.right.isEmpty())
+        split.left.forEach { assertEquals(it.first(), it.last(), "Split parts are closed") }
+    }
+}
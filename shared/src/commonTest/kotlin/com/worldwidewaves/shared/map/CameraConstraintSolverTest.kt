@@ -0,0 +1,129 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.BoundingBox
+import com.worldwidewaves.shared.events.utils.Position
+import com.worldwidewaves.shared.map.MapBoundsEnforcer.VisibleRegionPadding
+import kotlin.math.PI
+import kotlin.math.ln
+import kotlin.math.log2
+import kotlin.math.pow
+import kotlin.math.tan
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertNotEquals
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class CameraConstraintSolverTest {
+    private val paris = BoundingBox.fromCorners(Position(48.80, 2.20), Position(48.92, 2.47))
+    private val noPadding = VisibleRegionPadding(0.0, 0.0)
+
+    private fun mercatorY(latitude: Double) = ln(tan(PI / 4 + latitude * PI / 360))
+
+    /** Longitude and Mercator spans shown by a [width] x [height] viewport at [zoom] (512pt tiles). */
+    private fun viewportSpans(
+        zoom: Double,
+        width: Double,
+        height: Double,
+    ): Pair<Double, Double> {
+        val scale = 512 * 2.0.pow(zoom)
+        return width * 360 / scale to height * 2 * PI / scale
+    }
+
+    @Test
+    fun `bounds mode min zoom fits the whole event area`() {
+        val zoom = CameraConstraintSolver.computeMinZoom(paris, 390.0, 844.0, isWindowMode = false)
+        val (lngSpan, ySpan) = viewportSpans(zoom, 390.0, 844.0)
+        val eventYSpan = mercatorY(paris.ne.lat) - mercatorY(paris.sw.lat)
+
+        assertTrue(lngSpan >= paris.width - 1e-9, "viewport narrower than the event")
+        assertTrue(ySpan >= eventYSpan - 1e-9, "viewport shorter than the event")
+        // Portrait viewport, landscape event: the width constrains
+        assertEquals(paris.width, lngSpan, 1e-9)
+    }
+
+    @Test
+    fun `window mode min zoom keeps the viewport inside the event area`() {
+        val boundsZoom = CameraConstraintSolver.computeMinZoom(paris, 390.0, 844.0, isWindowMode = false)
+        val windowZoom = CameraConstraintSolver.computeMinZoom(paris, 390.0, 844.0, isWindowMode = true)
+        val (lngSpan, ySpan) = viewportSpans(windowZoom, 390.0, 844.0)
+        val eventYSpan = mercatorY(paris.ne.lat) - mercatorY(paris.sw.lat)
+
+        assertTrue(windowZoom > boundsZoom)
+        assertTrue(lngSpan <= paris.width + 1e-9)
+        assertEquals(eventYSpan, ySpan, 1e-6)
+    }
+
+    @Test
+    fun `min zoom matches the web mercator fit at the equator`() {
+        val bounds = BoundingBox.fromCorners(Position(-0.001, 0.0), Position(0.001, 1.0))
+
+        val zoom = CameraConstraintSolver.computeMinZoom(bounds, 512.0, 512.0, isWindowMode = false)
+
+        assertEquals(log2(360.0), zoom, 1e-9)
+    }
+
+    @Test
+    fun `min zoom is NaN while the viewport is not laid out`() {
+        val solver = CameraConstraintSolver()
+
+        assertTrue(solver.minZoom(paris, 0.0, 844.0, isWindowMode = true).isNaN())
+        assertTrue(solver.solve(paris, 390.0, 0.0, noPadding, isWindowMode = false).minZoom.isNaN())
+    }
+
+    @Test
+    fun `solve is memoized per bounds viewport and padding`() {
+        val solver = CameraConstraintSolver()
+        val padding = VisibleRegionPadding(0.01, 0.02)
+
+        val first = solver.solve(paris, 390.0, 844.0, padding, isWindowMode = true)
+        val again = solver.solve(paris, 390.0, 844.0, VisibleRegionPadding(0.01, 0.02), isWindowMode = true)
+        val rotated = solver.solve(paris, 844.0, 390.0, padding, isWindowMode = true)
+
+        assertSame(first, again)
+        assertNotEquals(first.minZoom, rotated.minZoom)
+        assertEquals(first.minZoom, solver.minZoom(paris, 390.0, 844.0, isWindowMode = true))
+        assertEquals(2, solver.size())
+    }
+
+    @Test
+    fun `memo is bounded`() {
+        val solver = CameraConstraintSolver()
+
+        repeat(100) { solver.solve(paris, 300.0 + it, 844.0, noPadding, isWindowMode = false) }
+
+        assertTrue(solver.size() <= 16)
+    }
+
+    @Test
+    fun `padded bounds shrink the event by the padding, at most 49 percent per side`() {
+        val padded = CameraConstraintSolver.paddedBounds(paris, VisibleRegionPadding(0.01, 0.02))
+        assertEquals(paris.sw.lat + 0.01, padded.sw.lat, 1e-9)
+        assertEquals(paris.ne.lng - 0.02, padded.ne.lng, 1e-9)
+
+        val clamped = CameraConstraintSolver.paddedBounds(paris, VisibleRegionPadding(1.0, 1.0))
+        assertTrue(clamped.ne.lat > clamped.sw.lat)
+        assertEquals(paris.height * 0.02, clamped.height, 1e-9)
+    }
+}
@@ -0,0 +1,64 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.domain.scheduling.DefaultObservationScheduler
+import com.worldwidewaves.shared.domain.scheduling.ObservationPhase
+import com.worldwidewaves.shared.events.utils.DefaultCoroutineScopeProvider
+import com.worldwidewaves.shared.events.utils.IClock
+import kotlinx.coroutines.test.runTest
+import kotlin.test.Test
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+import kotlin.time.Clock
+import kotlin.time.Duration
+import kotlin.time.ExperimentalTime
+import kotlin.time.Instant
+
+@OptIn(ExperimentalTime::class)
+class MapPrefetcherTest {
+    private val clock =
+        object : IClock {
+            override fun now(): Instant = Clock.System.now()
+
+            override suspend fun delay(duration: Duration) = Unit
+        }
+
+    private val prefetcher = MapPrefetcher(DefaultObservationScheduler(clock), DefaultCoroutineScopeProvider())
+
+    @Test
+    fun `only phases close to the wave trigger a prefetch`() {
+        assertFalse(MapPrefetcher.isPrefetchPhase(ObservationPhase.DISTANT))
+        assertFalse(MapPrefetcher.isPrefetchPhase(ObservationPhase.APPROACHING))
+        assertTrue(MapPrefetcher.isPrefetchPhase(ObservationPhase.NEAR))
+        assertTrue(MapPrefetcher.isPrefetchPhase(ObservationPhase.ACTIVE))
+        assertTrue(MapPrefetcher.isPrefetchPhase(ObservationPhase.CRITICAL))
+    }
+
+    @Test
+    fun `an event is claimed once until the retry delay elapses`() =
+        runTest {
+            assertTrue(prefetcher.claim("event_a"))
+            assertFalse(prefetcher.claim("event_a"), "Second attempt within RETRY_DELAY")
+            assertTrue(prefetcher.claim("event_b"), "Other events are independent")
+        }
+}
@@ -0,0 +1,83 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.math.PI
+import kotlin.math.cos
+import kotlin.math.sin
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+
+class PolygonLodCacheTest {
+    private val ring =
+        Polygon().apply {
+            for (i in 0 until 2000) {
+                val angle = 2 * PI * i / 2000
+                add(Position(40.0 + 0.1 * sin(angle), -3.7 + 0.1 * cos(angle)))
+            }
+        }
+
+    @Test
+    fun `zoom bands map to expected tolerance`() {
+        assertEquals(PolygonLodCache.ZoomBand.COUNTRY, PolygonLodCache.ZoomBand.forZoom(5.0))
+        assertEquals(PolygonLodCache.ZoomBand.REGION, PolygonLodCache.ZoomBand.forZoom(10.5))
+        assertEquals(PolygonLodCache.ZoomBand.CITY, PolygonLodCache.ZoomBand.forZoom(12.0))
+        assertEquals(PolygonLodCache.ZoomBand.STREET, PolygonLodCache.ZoomBand.forZoom(16.0))
+        assertEquals(PolygonLodCache.ZoomBand.STREET, PolygonLodCache.ZoomBand.forZoom(null))
+        assertEquals(0.0, PolygonLodCache.ZoomBand.STREET.toleranceDegrees)
+    }
+
+    @Test
+    fun `full resolution band returns input untouched`() {
+        val cache = PolygonLodCache()
+        val input = listOf(ring)
+
+        assertSame(input, cache.polygonsForZoom(input, 17.0))
+    }
+
+    @Test
+    fun `unchanged rings reuse the memoised simplification`() {
+        val cache = PolygonLodCache()
+
+        val first = cache.polygonsForZoom(listOf(ring), 10.0).single()
+        val second = cache.polygonsForZoom(listOf(ring), 10.2).single()
+
+        assertTrue(first.size < ring.size)
+        assertSame(first, second)
+    }
+
+    @Test
+    fun `band change is reported once the camera leaves the band`() {
+        val cache = PolygonLodCache()
+        assertFalse(cache.bandChanged(10.0), "Nothing rendered yet")
+
+        cache.polygonsForZoom(listOf(ring), 10.0)
+
+        assertFalse(cache.bandChanged(10.9))
+        assertTrue(cache.bandChanged(15.0))
+    }
+}
@@ -0,0 +1,105 @@
+package com.worldwidewaves.shared.position
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.minutes
+import kotlin.time.Duration.Companion.seconds
+import kotlin.time.Instant
+
+class PositionFilterTest {
+    private val origin = Position(lat = 48.8566, lng = 2.3522)
+    private val start = Instant.fromEpochMilliseconds(1_000_000)
+
+    /** ~1 m north per unit. */
+    private fun north(meters: Double) = Position(lat = origin.lat + meters / 111_320.0, lng = origin.lng)
+
+    @Test
+    fun `first fix is kept as is and significant`() {
+        val fix = PositionFilter().filter(origin, start)
+
+        assertEquals(origin, fix.position)
+        assertTrue(fix.significant)
+    }
+
+    @Test
+    fun `jitter within the accuracy radius is not significant`() {
+        val filter = PositionFilter()
+        filter.filter(origin, start)
+
+        val noise = listOf(6.0, -8.0, 4.0, -5.0, 7.0, -3.0, 8.0, -6.0)
+        noise.forEachIndexed { index, meters ->
+            val fix = filter.filter(north(meters), start + (index + 1).seconds, accuracyMeters = 10.0)
+            assertFalse(fix.significant, "Fix $index (${meters}m) should be filtered out")
+        }
+    }
+
+    @Test
+    fun `steady walk becomes significant`() {
+        val filter = PositionFilter()
+        filter.filter(origin, start)
+
+        val fixes = (1..30).map { second -> filter.filter(north(second * 1.5), start + second.seconds, accuracyMeters = 10.0) }
+
+        assertTrue(fixes.any { it.significant }, "A 45 m walk should produce a significant fix")
+        assertTrue(fixes.count { it.significant } < fixes.size / 2, "Most walking fixes should still be gated")
+    }
+
+    @Test
+    fun `large jump resets to the raw fix`() {
+        val filter = PositionFilter()
+        filter.filter(origin, start)
+
+        val far = north(500.0)
+        val fix = filter.filter(far, start + 1.seconds)
+
+        assertEquals(far, fix.position)
+        assertTrue(fix.significant)
+    }
+
+    @Test
+    fun `fix after a long gap resets to the raw fix`() {
+        val filter = PositionFilter()
+        filter.filter(origin, start)
+
+        val near = north(3.0)
+        val fix = filter.filter(near, start + 5.minutes)
+
+        assertEquals(near, fix.position)
+        assertTrue(fix.significant)
+    }
+
+    @Test
+    fun `invalid coordinates reset the filter`() {
+        val filter = PositionFilter()
+        filter.filter(Position(lat = Double.NaN, lng = Double.NaN), start)
+
+        val fix = filter.filter(origin, start + 1.seconds)
+
+        assertEquals(origin, fix.position)
+        assertTrue(fix.significant)
+    }
+}
@@ -33,9 +33,11 @@ import kotlinx.coroutines.test.advanceTimeBy
 import kotlinx.coroutines.test.runTest
 import kotlin.test.Test
 import kotlin.test.assertEquals
+import kotlin.test.assertNotEquals
 import kotlin.test.assertNull
 import kotlin.time.Duration
 import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.seconds
 import kotlin.time.ExperimentalTime
 import kotlin.time.Instant
 
@@ -161,6 +163,50 @@ class PositionManagerTest {
             assertEquals(position, positionManager.getCurrentPosition()) // Should still be original position
         }
 
+    @Test
+    fun `should not publish GPS jitter below the accuracy radius`() =
+        runTest {
+            val coroutineScopeProvider = TestCoroutineScopeProvider(this)
+            val clock = TestClock()
+            val positionManager = PositionManager(coroutineScopeProvider, debounceDelay = 0.milliseconds, clock = clock)
+            val position = Position(lat = 48.8566, lng = 2.3522)
+
+            positionManager.updatePosition(PositionManager.PositionSource.GPS, position)
+            testScheduler.runCurrent()
+            val revision = positionManager.getPositionRevision()
+
+            // ~8 m of noise around a stationary user, one fix per second
+            listOf(0.00007, -0.00005, 0.00006, -0.00007).forEach { offset ->
+                clock.advance(1.seconds)
+                positionManager.updatePosition(
+                    PositionManager.PositionSource.GPS,
+                    Position(lat = position.lat + offset, lng = position.lng - offset),
+                    accuracyMeters = 10.0,
+                )
+                testScheduler.runCurrent()
+            }
+
+            assertEquals(position, positionManager.getCurrentPosition())
+            assertEquals(revision, positionManager.getPositionRevision())
+            // The raw fix is still available for GPS-specific checks
+            assertEquals(Position(lat = position.lat - 0.00007, lng = position.lng + 0.00007), positionManager.getGPSPosition())
+        }
+
+    @Test
+    fun `cleanup should change the revision when it drops a pending update`() =
+        runTest {
+            val coroutineScopeProvider = TestCoroutineScopeProvider(this)
+            val positionManager = PositionManager(coroutineScopeProvider, debounceDelay = 100.milliseconds, clock = TestClock())
+
+            positionManager.updatePosition(PositionManager.PositionSource.GPS, Position(lat = 48.8566, lng = 2.3522))
+            val revision = positionManager.getPositionRevision()
+
+            positionManager.cleanup()
+
+            assertNull(positionManager.getCurrentPosition())
+            assertNotEquals(revision, positionManager.getPositionRevision())
+        }
+
     @Test
     fun `should not deduplicate significantly different positions`() =
         runTest {
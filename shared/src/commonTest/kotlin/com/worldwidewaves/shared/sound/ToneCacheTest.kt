@@ -0,0 +1,99 @@
+package com.worldwidewaves.shared.sound
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertSame
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+class ToneCacheTest {
+    private fun tone(
+        frequency: Double = 440.0,
+        durationMs: Int = 100,
+    ) = ToneSpec(frequency, 0.5, durationMs.milliseconds, SoundPlayer.Waveform.SINE)
+
+    @Test
+    fun `durations in the same bucket share one rendering`() {
+        val cache = ToneCache(sampleRate = 1000)
+
+        val first = cache.get(tone(durationMs = 91))
+        val second = cache.get(tone(durationMs = 100))
+
+        assertSame(first, second)
+        assertEquals(100, first.size, "Duration rounded up to the 10ms bucket")
+        assertEquals(1, cache.size)
+    }
+
+    @Test
+    fun `cached PCM matches the waveform generator`() {
+        val cache = ToneCache(sampleRate = 8000)
+        val expected =
+            WaveformGenerator.generateFloatWaveform(8000, 440.0, 0.5, 100.milliseconds, SoundPlayer.Waveform.SINE)
+
+        val samples = cache.get(tone())
+
+        assertTrue(expected.contentEquals(samples))
+    }
+
+    @Test
+    fun `least recently used tones are evicted beyond the budget`() {
+        val cache = ToneCache(sampleRate = 1000, maxCachedSamples = 250)
+
+        cache.get(tone(440.0))
+        cache.get(tone(550.0))
+        cache.get(tone(440.0)) // 440 is now the most recent
+        cache.get(tone(660.0))
+
+        assertTrue(cache.contains(tone(440.0)))
+        assertFalse(cache.contains(tone(550.0)))
+        assertTrue(cache.contains(tone(660.0)))
+    }
+
+    @Test
+    fun `prepare renders missing tones until the budget is full`() {
+        val cache = ToneCache(sampleRate = 1000, maxCachedSamples = 250)
+        cache.get(tone(440.0))
+
+        val rendered = cache.prepare(listOf(tone(440.0), tone(550.0), tone(660.0)))
+
+        assertEquals(1, rendered)
+        assertTrue(cache.contains(tone(550.0)))
+        assertFalse(cache.contains(tone(660.0)))
+    }
+
+    @Test
+    fun `tones rendered outside the cache are put back once`() {
+        val cache = ToneCache(sampleRate = 1000)
+        cache.get(tone(440.0))
+
+        val missing = cache.missingKeys(listOf(tone(440.0), tone(550.0), tone(550.0, durationMs = 95)))
+        assertEquals(listOf(ToneCache.keyOf(tone(550.0))), missing)
+
+        val samples = cache.render(missing.single())
+        assertTrue(cache.put(missing.single(), samples))
+        assertTrue(cache.put(missing.single(), FloatArray(1)), "Already cached: kept as is")
+        assertSame(samples, cache.get(tone(550.0)))
+    }
+}
@@ -485,4 +485,51 @@ class WaveformGeneratorTest {
         assertEquals(44, shortSamples.size, "1ms at 44100Hz should produce 44 samples")
         assertTrue(shortSamples.all { it.isFinite() }, "All samples should be finite")
     }
+
+    @Test
+    fun `float sine matches the double generator`() {
+        // GIVEN: The same tone through both generators
+        val reference = WaveformGenerator.generateWaveform(44100, 440.0, 0.8, 200.milliseconds, SoundPlayer.Waveform.SINE)
+        val floats = WaveformGenerator.generateFloatWaveform(44100, 440.0, 0.8, 200.milliseconds, SoundPlayer.Waveform.SINE)
+
+        // THEN: Same length and phase origin, within wavetable/vForce precision
+        assertEquals(reference.size, floats.size)
+        for (i in reference.indices) {
+            assertEquals(reference[i], floats[i].toDouble(), 1e-4, "Sample $i")
+        }
+    }
+
+    @Test
+    fun `band-limited float waveforms stay within amplitude`() {
+        // GIVEN: A high note, where naive square/sawtooth alias the most
+        for (waveform in SoundPlayer.Waveform.entries) {
+            val samples = WaveformGenerator.generateFloatWaveform(44100, 3520.0, 0.5, 100.milliseconds, waveform)
+
+            // THEN: PolyBLEP smoothing never overshoots the requested amplitude
+            assertEquals(4410, samples.size)
+            assertTrue(samples.all { it.isFinite() && abs(it) <= 0.5f + 1e-6f }, "$waveform exceeds amplitude")
+        }
+    }
+
+    @Test
+    fun `mixed voices span the longest voice without clipping`() {
+        // GIVEN: A full-amplitude chord of three voices
+        val voices =
+            listOf(60, 64, 67).mapIndexed { index, pitch ->
+                ToneSpec(
+                    frequency = WaveformGenerator.midiPitchToFrequency(pitch),
+                    amplitude = 1.0,
+                    duration = (100 + index * 50).milliseconds,
+                    waveform = SoundPlayer.Waveform.SQUARE,
+                )
+            }
+
+        // WHEN: Mixing them into one buffer
+        val mix = WaveformGenerator.mixVoices(44100, voices)
+
+        // THEN: Length of the longest voice, peak within full scale
+        assertEquals(8820, mix.size)
+        assertTrue(mix.all { abs(it) <= 1.0f + 1e-6f }, "Mix should not clip")
+        assertTrue(mix.any { abs(it) > 0.1f }, "Mix should not be silent")
+    }
 }
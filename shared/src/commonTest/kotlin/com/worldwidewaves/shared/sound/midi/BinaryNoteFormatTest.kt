@@ -0,0 +1,75 @@
+package com.worldwidewaves.shared.sound.midi
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.sound.MidiNote
+import com.worldwidewaves.shared.sound.MidiTrack
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.time.Duration.Companion.microseconds
+import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.seconds
+
+class BinaryNoteFormatTest {
+    private val track =
+        MidiTrack(
+            name = "test",
+            notes =
+                listOf(
+                    MidiNote(67, 90, 750.milliseconds, 250.milliseconds),
+                    MidiNote(60, 127, 0.milliseconds, 500.microseconds),
+                    MidiNote(127, 1, 750.milliseconds, 1.seconds),
+                ),
+            totalDuration = 1750.milliseconds,
+            tempo = 110,
+        )
+
+    @Test
+    fun `encode then decode keeps notes, duration and tempo`() {
+        val decoded = assertNotNull(BinaryNoteFormat.decode(BinaryNoteFormat.encode(track)))
+
+        assertEquals(track.notes.sortedBy { it.startTime }, decoded.notes)
+        assertEquals(track.totalDuration, decoded.totalDuration)
+        assertEquals(track.tempo, decoded.tempo)
+    }
+
+    @Test
+    fun `precompiled path replaces the MIDI extension`() {
+        assertEquals("files/symfony.wwn", BinaryNoteFormat.precompiledPath("files/symfony.mid"))
+    }
+
+    @Test
+    fun `empty input decodes to null`() {
+        assertNull(BinaryNoteFormat.decode(ByteArray(0)))
+    }
+
+    @Test
+    fun `invalid input is rejected`() {
+        val bytes = BinaryNoteFormat.encode(track)
+
+        assertFailsWith<IllegalArgumentException> { BinaryNoteFormat.decode(bytes.copyOf().also { it[0] = 0 }) }
+        assertFailsWith<IllegalArgumentException> { BinaryNoteFormat.decode(bytes.copyOf(bytes.size - 4)) }
+    }
+}
@@ -0,0 +1,91 @@
+package com.worldwidewaves.shared.sound.midi
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.sound.MidiNote
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+class MidiNoteStreamTest {
+    private fun note(
+        startMs: Int,
+        durationMs: Int,
+        pitch: Int = 60,
+    ) = MidiNote(pitch, 100, startMs.milliseconds, durationMs.milliseconds)
+
+    // Overlapping notes, a long one spanning several index buckets, given out of order
+    private val notes =
+        listOf(
+            note(2500, 300, 64),
+            note(0, 500),
+            note(400, 200, 62),
+            note(1000, 4000, 48),
+            note(1000, 100, 67),
+            note(6200, 50, 72),
+        )
+
+    @Test
+    fun `notes are sorted by start time`() {
+        val stream = MidiNoteStream(notes)
+
+        assertEquals(notes.sortedBy { it.startTime }, stream.notes)
+        assertEquals(4000.milliseconds, stream.maxNoteDuration)
+    }
+
+    @Test
+    fun `cursor moving forward matches a full scan`() {
+        val cursor = MidiNoteStream(notes).cursor()
+
+        for (ms in 0..7000 step 50) {
+            val position = ms.milliseconds
+            assertEquals(
+                cursor.stream.notes.filter { it.isActiveAt(position) },
+                cursor.activeAt(position),
+                "At $position",
+            )
+        }
+    }
+
+    @Test
+    fun `cursor going backwards matches a full scan`() {
+        val cursor = MidiNoteStream(notes).cursor()
+        val positions = listOf(6200, 450, 5500, 1050, 2600, 0, 4999, 1000).map { it.milliseconds }
+
+        for (position in positions) {
+            assertEquals(
+                cursor.stream.notes.filter { it.isActiveAt(position) },
+                cursor.activeAt(position),
+                "At $position",
+            )
+        }
+    }
+
+    @Test
+    fun `empty stream has no active notes`() {
+        val cursor = MidiNoteStream(emptyList()).cursor()
+
+        assertTrue(cursor.activeAt(1000.milliseconds).isEmpty())
+        assertTrue(cursor.activeAt(0.milliseconds).isEmpty())
+    }
+}
@@ -0,0 +1,88 @@
+package com.worldwidewaves.shared.utils
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertTrue
+import kotlin.time.Duration.Companion.milliseconds
+
+class RenderTraceTest {
+    @BeforeTest
+    fun setUp() {
+        RenderTrace.reset()
+    }
+
+    @Test
+    fun `percentiles are computed per stage`() {
+        for (ms in 1..100) RenderTrace.record(RenderStage.LAYER_UPDATE, ms.milliseconds)
+        RenderTrace.record(RenderStage.MAP_UPDATE, 3.milliseconds)
+
+        val stats = RenderTrace.stats().associateBy { it.stage }
+
+        assertEquals(setOf(RenderStage.MAP_UPDATE, RenderStage.LAYER_UPDATE), stats.keys, "Only stages that ran")
+        val layer = stats.getValue(RenderStage.LAYER_UPDATE)
+        assertEquals(100, layer.count)
+        assertEquals(51.milliseconds, layer.p50)
+        assertEquals(95.milliseconds, layer.p95)
+        assertEquals(100.milliseconds, layer.max)
+        assertEquals(3.milliseconds, stats.getValue(RenderStage.MAP_UPDATE).p95)
+    }
+
+    @Test
+    fun `only the most recent samples are kept`() {
+        repeat(RenderTrace.SAMPLES_PER_STAGE) { RenderTrace.record(RenderStage.FRAME, 100.milliseconds) }
+        repeat(RenderTrace.SAMPLES_PER_STAGE) { RenderTrace.record(RenderStage.FRAME, 1.milliseconds) }
+
+        val frame = RenderTrace.stats().single()
+
+        assertEquals(2L * RenderTrace.SAMPLES_PER_STAGE, frame.count)
+        assertEquals(1.milliseconds, frame.max)
+    }
+
+    @Test
+    fun `trace records the stage and returns the block result`() {
+        val result = RenderTrace.trace(RenderStage.OBSERVER_UPDATE, "event", polygonCount = 2, vertexCount = 10) { 42 }
+
+        assertEquals(42, result)
+        assertEquals(RenderStage.OBSERVER_UPDATE, RenderTrace.stats().single().stage)
+    }
+
+    @Test
+    fun `trace records a stage that throws`() {
+        assertFailsWith<IllegalStateException> {
+            RenderTrace.trace(RenderStage.REGISTRY_PUBLISH, "event") { error("boom") }
+        }
+
+        assertEquals(1, RenderTrace.stats().single().count)
+    }
+
+    @Test
+    fun `reset clears every stage`() {
+        RenderTrace.record(RenderStage.BRIDGE_RENDER, 1.milliseconds)
+        RenderTrace.reset()
+
+        assertTrue(RenderTrace.stats().isEmpty())
+    }
+}
@@ -23,6 +23,7 @@ package com.worldwidewaves.shared
 import androidx.compose.runtime.Composable
 import androidx.compose.runtime.remember
 import androidx.compose.ui.window.ComposeUIViewController
+import com.worldwidewaves.shared.events.geometry.AreaGeometryCache
 import com.worldwidewaves.shared.map.EventMapConfig
 import com.worldwidewaves.shared.map.IosEventMap
 import com.worldwidewaves.shared.map.MapCameraPosition
@@ -395,6 +396,25 @@ fun stopEventObservers() {
     }
 }
 
+/**
+ * Releases cached event area geometry on an iOS memory warning (areas of events about to
+ * start are kept, see [AreaGeometryCache]).
+ *
+ * ## Swift Usage
+ * ```swift
+ * // In SceneDelegate.swift, didReceiveMemoryWarningNotification observer
+ * try RootControllerKt.trimMemory()
+ * ```
+ */
+@Throws(Throwable::class)
+fun trimMemory() {
+    try {
+        AreaGeometryCache.shared.trim(AreaGeometryCache.TrimLevel.CRITICAL)
+    } catch (e: Exception) {
+        Log.e(TAG, "Failed to trim memory", throwable = e)
+    }
+}
+
 /**
  * Restarts event observers when the app returns to foreground.
  * Call this from Swift UIViewController lifecycle methods (viewWillAppear, sceneWillEnterForeground).
@@ -27,9 +27,12 @@ import com.worldwidewaves.shared.events.data.GeoJsonDataProvider
 import com.worldwidewaves.shared.utils.Log
 import kotlinx.cinterop.BetaInteropApi
 import kotlinx.cinterop.ExperimentalForeignApi
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.usePinned
 import kotlinx.coroutines.suspendCancellableCoroutine
 import platform.Foundation.NSApplicationSupportDirectory
 import platform.Foundation.NSBundle
+import platform.Foundation.NSData
 import platform.Foundation.NSFileManager
 import platform.Foundation.NSOperationQueue
 import platform.Foundation.NSString
@@ -38,9 +41,11 @@ import platform.Foundation.NSURL
 import platform.Foundation.NSUTF8StringEncoding
 import platform.Foundation.NSUserDomainMask
 import platform.Foundation.create
+import platform.Foundation.dataWithContentsOfFile
 import platform.Foundation.stringByDeletingLastPathComponent
 import platform.Foundation.stringWithContentsOfFile
 import platform.Foundation.writeToFile
+import platform.posix.memcpy
 import kotlin.coroutines.resume
 
 // ---------- ODR lookup helpers (shared) ----------
@@ -213,8 +218,14 @@ actual suspend fun platformTryCopyInitialTagToCache(
 
     Log.i("MapStore.ios", "platformTryCopyInitialTagToCache: Cached $eventId.$extension")
 
-    // Since initial tag is visible (no mount needed), also cache the other file type
-    val otherExtension = if (extension == "geojson") "mbtiles" else "geojson"
+    // Since initial tag is visible (no mount needed), also cache the other file type.
+    // A requested binary area (.wwa) is stamped by getAreaFileAbsolutePath itself.
+    val otherExtension =
+        when (extension) {
+            "geojson" -> "mbtiles"
+            "mbtiles" -> "geojson"
+            else -> return true
+        }
     val root = platformCacheRoot()
     val otherPath = "$root/$eventId.$otherExtension"
     val otherMeta = metaPath(root, "$eventId.$otherExtension")
@@ -230,6 +241,7 @@ actual suspend fun platformTryCopyInitialTagToCache(
             Log.i("MapStore.ios", "platformTryCopyInitialTagToCache: Also cached $eventId.$otherExtension")
         }
     }
+    cacheBinaryArea(eventId, root)
 
     return true
 }
@@ -250,6 +262,16 @@ actual suspend fun platformReadText(path: String): String =
         (NSString.stringWithContentsOfFile(path, NSUTF8StringEncoding, null) ?: "")
     }
 
+@OptIn(ExperimentalForeignApi::class)
+actual suspend fun platformReadBytes(path: String): ByteArray =
+    kotlinx.coroutines.withContext(kotlinx.coroutines.Dispatchers.Default) {
+        val data = NSData.dataWithContentsOfFile(path) ?: return@withContext ByteArray(0)
+        val size = data.length.toInt()
+        ByteArray(size).also { bytes ->
+            if (size > 0) bytes.usePinned { memcpy(it.addressOf(0), data.bytes, data.length) }
+        }
+    }
+
 @OptIn(BetaInteropApi::class)
 actual suspend fun platformWriteText(
     path: String,
@@ -356,6 +378,25 @@ private suspend fun mountAndCopyResource(
         Log.d("MapStore.ios", "mountAndCopyResource: Could not cache $eventId.$otherExtension (may not exist in ODR)")
     }
 
+    // The binary area is only reachable while the tag is mounted: getAreaFileAbsolutePath
+    // looks in the visible bundle only and would fall back to GeoJSON parsing for the session
+    if (extension != MapFileExtension.AREA.value) cacheBinaryArea(eventId, root)
+
+    return true
+}
+
+/** Copies the optional `.wwa` of [eventId] from the reachable bundle or ODR tag into [root]. */
+private suspend fun cacheBinaryArea(
+    eventId: String,
+    root: String,
+): Boolean {
+    val fileName = "$eventId.${MapFileExtension.AREA}"
+    if (!copyResourceToDestination(eventId, MapFileExtension.AREA.value, "$root/$fileName")) {
+        Log.d("MapStore.ios", "cacheBinaryArea: No $fileName in resources, GeoJSON will be parsed")
+        return false
+    }
+    onAreaFileCached(root, eventId)
+    Log.i("MapStore.ios", "cacheBinaryArea: Also cached $fileName")
     return true
 }
 
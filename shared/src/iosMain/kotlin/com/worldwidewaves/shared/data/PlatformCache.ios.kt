@@ -190,6 +190,8 @@ fun clearEventCache(eventId: String): Boolean {
             "$eventId.mbtiles.metadata",
             "$eventId.geojson",
             "$eventId.geojson.metadata",
+            "$eventId.wwa",
+            "$eventId.wwa.metadata",
             "style-$eventId.json",
             "style-$eventId.json.metadata",
         )
@@ -212,6 +214,7 @@ fun clearEventCache(eventId: String): Boolean {
             }
         }
     }
+    clearEventAreaCache(eventId, root)
 
     return deletedAny
 }
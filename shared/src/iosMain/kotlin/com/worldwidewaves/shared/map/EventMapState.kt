@@ -0,0 +1,219 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.BoundingBox
+import kotlinx.atomicfu.atomic
+import kotlinx.atomicfu.loop
+import kotlin.concurrent.Volatile
+
+/**
+ * Everything [MapWrapperRegistry] knows about one map, keyed by event id (or registry key).
+ *
+ * Resolved once per operation with [MapWrapperRegistry.handle] instead of one map lookup per
+ * field. Threading model:
+ * - **Pending slots** (wave polygons, camera commands, bbox draw, resync flag) are atomic
+ *   single-producer / single-consumer slots: Kotlin publishes from any dispatcher, Swift
+ *   consumes on the main thread. Consumers take a slot atomically, so a frame published while
+ *   Swift renders the previous one is never lost.
+ * - **Callbacks** are registered by Swift on the main thread and read from any thread; they are
+ *   published through volatile fields.
+ * - **Viewport and listener lists** are written and read on the main thread only.
+ */
+internal class EventMapState(
+    val eventId: String,
+) {
+    // ------------------------------------------------------------------------
+    // Wrapper
+
+    @Volatile
+    var wrapper: Any? = null
+
+    /** Registry access tick of the wrapper, for LRU eviction. */
+    @Volatile
+    var lastAccess: Long = 0L
+
+    // ------------------------------------------------------------------------
+    // Pending slots (any thread -> main thread)
+
+    private val pendingPolygons = atomic<MapWrapperRegistry.PendingPolygonData?>(null)
+    private val polygonResync = atomic(false)
+    private val pendingBboxDraw = atomic<BoundingBox?>(null)
+    private val pendingAnimationCommand = atomic<CameraCommand?>(null)
+    private val pendingConfigCommands = atomic<List<CameraCommand>>(emptyList())
+
+    fun publishPolygons(data: MapWrapperRegistry.PendingPolygonData) {
+        pendingPolygons.value = data
+    }
+
+    /** Atomically replaces the pending polygons with [fold] of the current entry. */
+    fun foldPolygons(
+        fold: (MapWrapperRegistry.PendingPolygonData?) -> MapWrapperRegistry.PendingPolygonData,
+    ): MapWrapperRegistry.PendingPolygonData {
+        pendingPolygons.loop { current ->
+            val folded = fold(current)
+            if (pendingPolygons.compareAndSet(current, folded)) return folded
+        }
+    }
+
+    fun peekPolygons(): MapWrapperRegistry.PendingPolygonData? = pendingPolygons.value
+
+    fun takePolygons(): MapWrapperRegistry.PendingPolygonData? = pendingPolygons.getAndSet(null)
+
+    fun clearPolygons() {
+        pendingPolygons.value = null
+    }
+
+    fun requestPolygonResync() {
+        polygonResync.value = true
+    }
+
+    fun consumePolygonResync(): Boolean = polygonResync.getAndSet(false)
+
+    fun publishBboxDraw(bbox: BoundingBox) {
+        pendingBboxDraw.value = bbox
+    }
+
+    fun hasBboxDraw(): Boolean = pendingBboxDraw.value != null
+
+    fun takeBboxDraw(): BoundingBox? = pendingBboxDraw.getAndSet(null)
+
+    /** Latest animation wins: replaces any animation Swift has not started yet. */
+    fun publishAnimationCommand(command: CameraCommand) {
+        pendingAnimationCommand.value = command
+    }
+
+    /**
+     * Configuration commands all execute, in order. Returns the queue size.
+     * Constraints carrying a solved min zoom supersede the constraints still queued (one apply per settle).
+     */
+    fun enqueueConfigCommand(command: CameraCommand): Int {
+        val supersedes = command is CameraCommand.SetConstraintBounds && !command.minZoom.isNaN()
+        pendingConfigCommands.loop { queue ->
+            val kept = if (supersedes) queue.filterNot { it is CameraCommand.SetConstraintBounds } else queue
+            if (pendingConfigCommands.compareAndSet(queue, kept + command)) return kept.size + 1
+        }
+    }
+
+    /** Next command to execute: configuration first (FIFO), then the animation slot. */
+    fun peekCameraCommand(): CameraCommand? = pendingConfigCommands.value.firstOrNull() ?: pendingAnimationCommand.value
+
+    fun hasCameraCommand(): Boolean = pendingConfigCommands.value.isNotEmpty() || pendingAnimationCommand.value != null
+
+    /**
+     * Removes [executed] once Swift has run it. A newer animation published meanwhile is kept.
+     * With a null [executed], removes whatever [peekCameraCommand] returns now.
+     *
+     * @return The removed command, or null if there was nothing to remove
+     */
+    fun removeCameraCommand(executed: CameraCommand? = null): CameraCommand? {
+        pendingConfigCommands.loop { queue ->
+            val head = queue.firstOrNull() ?: return removeAnimationCommand(executed)
+            if (executed != null && executed !== head) return removeAnimationCommand(executed)
+            if (pendingConfigCommands.compareAndSet(queue, queue.drop(1))) return head
+        }
+    }
+
+    private fun removeAnimationCommand(executed: CameraCommand?): CameraCommand? {
+        val current = pendingAnimationCommand.value ?: return null
+        if (executed != null && executed !== current) return null
+        return if (pendingAnimationCommand.compareAndSet(current, null)) current else null
+    }
+
+    val configCommandCount: Int get() = pendingConfigCommands.value.size
+
+    // ------------------------------------------------------------------------
+    // Swift callbacks (registered on main, invoked from any thread)
+
+    @Volatile var renderCallback: (() -> Unit)? = null
+
+    @Volatile var cameraCallback: (() -> Unit)? = null
+
+    @Volatile var mapClickCallback: (() -> Unit)? = null
+
+    @Volatile var mapClickRegistrationCallback: ((() -> Unit) -> Unit)? = null
+
+    @Volatile var mapClickCoordinateListener: ((Double, Double) -> Unit)? = null
+
+    @Volatile var locationComponentCallback: ((Boolean) -> Unit)? = null
+
+    @Volatile var userPositionCallback: ((Double, Double) -> Unit)? = null
+
+    @Volatile var gesturesEnabledCallback: ((Boolean) -> Unit)? = null
+
+    // Latest values requested before the matching callback was registered
+    @Volatile var pendingLocationComponentState: Boolean? = null
+
+    @Volatile var pendingUserPosition: Pair<Double, Double>? = null
+
+    @Volatile var pendingGesturesState: Boolean? = null
+
+    // ------------------------------------------------------------------------
+    // Main thread state
+
+    val cameraIdleListeners = mutableListOf<() -> Unit>()
+    val onMapReadyCallbacks = mutableListOf<() -> Unit>()
+
+    @Volatile var styleLoaded: Boolean = false
+
+    val viewport = ViewportState()
+
+    /**
+     * Camera and viewport state reported by Swift.
+     * Updated in place on every region change so gestures do not allocate per callback;
+     * [visibleRegion] is materialized lazily when Kotlin reads it.
+     */
+    class ViewportState {
+        var centerLatitude = Double.NaN
+        var centerLongitude = Double.NaN
+        var zoom = Double.NaN
+        var minZoom = Double.NaN
+        var width = Double.NaN
+        var height = Double.NaN
+        private var swLat = Double.NaN
+        private var swLng = Double.NaN
+        private var neLat = Double.NaN
+        private var neLng = Double.NaN
+        private var cachedRegion: BoundingBox? = null
+
+        val hasCameraPosition: Boolean get() = !centerLatitude.isNaN()
+
+        fun setVisibleRegion(
+            swLat: Double,
+            swLng: Double,
+            neLat: Double,
+            neLng: Double,
+        ) {
+            if (swLat == this.swLat && swLng == this.swLng && neLat == this.neLat && neLng == this.neLng) return
+            this.swLat = swLat
+            this.swLng = swLng
+            this.neLat = neLat
+            this.neLng = neLng
+            cachedRegion = null
+        }
+
+        fun visibleRegion(): BoundingBox? {
+            if (swLat.isNaN()) return null
+            return cachedRegion ?: BoundingBox(swLat, swLng, neLat, neLng).also { cachedRegion = it }
+        }
+    }
+}
@@ -56,6 +56,8 @@ import com.worldwidewaves.shared.events.utils.Position
 import com.worldwidewaves.shared.map.EventMapDownloadManager
 import com.worldwidewaves.shared.ui.components.DownloadProgressIndicator
 import com.worldwidewaves.shared.ui.components.LoadingIndicator
+import com.worldwidewaves.shared.utils.RenderStage
+import com.worldwidewaves.shared.utils.RenderTrace
 import dev.icerock.moko.resources.compose.stringResource
 import kotlinx.cinterop.ExperimentalForeignApi
 import kotlinx.coroutines.CoroutineScope
@@ -95,6 +97,9 @@ class IosEventMap(
         KoinPlatform.getKoin().getOrNull<LocationProvider>()
 
     private var currentPolygons = mutableListOf<Polygon>()
+    private val polygonDeltaEncoder = WavePolygonDeltaEncoder()
+    private val polygonLodCache = PolygonLodCache()
+    private var lastWaveFrame: List<Polygon> = emptyList() // Full resolution, for LOD re-renders
     private val mapScope = CoroutineScope(SupervisorJob())
     private var setupMapCalled = false
 
@@ -102,29 +107,72 @@ class IosEventMap(
     override fun updateWavePolygons(
         wavePolygons: List<Polygon>,
         clearPolygons: Boolean,
-    ) {
+    ): Unit = RenderTrace.trace(RenderStage.MAP_UPDATE, mapRegistryKey, wavePolygons.size, wavePolygons.sumOf { it.size }) {
         if (clearPolygons) currentPolygons.clear()
         currentPolygons.addAll(wavePolygons)
 
-        storePolygonsForRendering(wavePolygons, clearPolygons)
+        // One registry lookup per frame; not cached across frames (unregister/LRU drops the record)
+        val mapState = MapWrapperRegistry.handle(mapRegistryKey)
+
+        // Decimate for the current zoom band: fewer vertices across the bridge and to tessellate
+        lastWaveFrame = wavePolygons
+        val rendered = polygonLodCache.polygonsForZoom(wavePolygons, MapWrapperRegistry.getCameraZoom(mapState))
+        if (!storePolygonsForRendering(mapState, rendered, clearPolygons)) return@trace
 
         // Render immediately if wrapper ready, otherwise queue for async render
-        val wrapper = MapWrapperRegistry.getWrapper(mapRegistryKey)
-        if (wrapper != null && MapWrapperRegistry.isStyleLoaded(mapRegistryKey)) {
-            MapWrapperRegistry.getRenderCallback(mapRegistryKey)?.invoke()
+        if (mapState.wrapper != null && mapState.styleLoaded) {
+            mapState.renderCallback?.invoke()
         } else {
-            MapWrapperRegistry.requestImmediateRender(mapRegistryKey)
+            MapWrapperRegistry.requestImmediateRender(mapState)
         }
     }
 
+    /**
+     * Re-renders the last wave frame when the camera settles in another zoom band.
+     * Needed once the wave is DONE, when no further progression ticks would pick up the new band.
+     */
+    private fun refreshPolygonLevelOfDetail() {
+        val zoom = MapWrapperRegistry.getCameraZoom(mapRegistryKey)
+        if (lastWaveFrame.isEmpty() || !polygonLodCache.bandChanged(zoom)) return
+        updateWavePolygons(lastWaveFrame, clearPolygons = true)
+    }
+
+    /**
+     * Queues [polygons] for Swift, as a ring-level delta whenever the native side is in sync.
+     * Returns false when the frame is identical to the previous one and nothing was queued.
+     */
     private fun storePolygonsForRendering(
+        mapState: EventMapState,
         polygons: List<Polygon>,
         clearExisting: Boolean,
-    ) {
-        val coordinates: List<List<Pair<Double, Double>>> =
-            polygons.map { polygon -> polygon.map { Pair(it.lat, it.lng) } }
+    ): Boolean {
+        val resyncRequested = mapState.consumePolygonResync()
+        if (resyncRequested || (clearExisting && polygons.isEmpty())) {
+            polygonDeltaEncoder.reset()
+        }
 
-        MapWrapperRegistry.setPendingPolygons(mapRegistryKey, coordinates, clearExisting)
+        val delta = polygonDeltaEncoder.encode(polygons)
+        when {
+            delta == null -> {
+                // Pack directly from the linked lists: no per-vertex Pair allocation.
+                // Single-source mode keeps fragmented waves (Jakarta, Istanbul) to one style layer.
+                MapWrapperRegistry.setPendingPolygons(
+                    state = mapState,
+                    packed = PackedPolygonBuffer.fromPolygons(polygons),
+                    clearExisting = clearExisting,
+                    renderMode = WavePolygonRenderMode.SINGLE_SOURCE,
+                )
+            }
+            delta.isEmpty -> return false
+            else ->
+                MapWrapperRegistry.setPendingPolygonDelta(
+                    state = mapState,
+                    delta = delta,
+                    clearExisting = clearExisting,
+                    renderMode = WavePolygonRenderMode.SINGLE_SOURCE,
+                )
+        }
+        return true
     }
 
     @OptIn(ExperimentalForeignApi::class)
@@ -216,6 +264,7 @@ class IosEventMap(
                             onMapLoaded = onMapLoaded,
                             onMapClick = onMapClick?.let { callback -> { _: Double, _: Double -> callback() } },
                         )
+                        MapWrapperRegistry.setCameraIdleListener(mapRegistryKey) { refreshPolygonLevelOfDetail() }
                     }
                 }
             }
@@ -45,6 +45,8 @@ class IosMapLibreAdapter(
     override val currentPosition: StateFlow<Position?> = _currentPosition
     override val currentZoom: StateFlow<Double> = _currentZoom
 
+    private var solvedMinZoom = Double.NaN
+
     /**
      * Sets the map wrapper.
      * Map rendering happens via SwiftUI EventMapView embedded in Compose.
@@ -163,17 +165,27 @@ class IosMapLibreAdapter(
         applyZoomSafetyMargin: Boolean,
         originalEventBounds: BoundingBox?,
     ) {
-        // Pass constraint bounds (for gestures) and original bounds (for min zoom) to iOS
+        // Min zoom from the shared solver (already solved by MapBoundsEnforcer for this viewport),
+        // sent with the constraint bounds so Swift applies both without computing anything
+        val minZoom =
+            CameraConstraintSolver.shared.minZoom(
+                originalEventBounds ?: constraintBounds,
+                getWidth(),
+                getHeight(),
+                applyZoomSafetyMargin,
+            )
+        if (!minZoom.isNaN()) solvedMinZoom = minZoom
+
         MapWrapperRegistry.setPendingCameraCommand(
             eventId,
-            CameraCommand.SetConstraintBounds(constraintBounds, originalEventBounds, applyZoomSafetyMargin),
+            CameraCommand.SetConstraintBounds(constraintBounds, originalEventBounds, applyZoomSafetyMargin, minZoom),
         )
     }
 
+    /** Last min zoom sent to Swift, else the one reported by the map view with the viewport. */
     override fun getMinZoomLevel(): Double {
-        val wrapper = MapWrapperRegistry.getWrapper(eventId) ?: return 0.0
-        MapWrapperRegistry.syncActualMinZoomFromWrapper(eventId)
-        return MapWrapperRegistry.getActualMinZoom(eventId)
+        MapWrapperRegistry.getWrapper(eventId) ?: return 0.0
+        return solvedMinZoom.takeUnless { it.isNaN() }?.coerceAtLeast(0.0) ?: MapWrapperRegistry.getMinZoom(eventId)
     }
 
     override fun setMinZoomPreference(minZoom: Double) {
@@ -246,6 +258,7 @@ class IosMapLibreAdapter(
     fun cleanup() {
         _currentPosition.value = null
         _currentZoom.value = 10.0
+        solvedMinZoom = Double.NaN
         wrapper = null
     }
 }
@@ -13,6 +13,10 @@ package com.worldwidewaves.shared.map
 import com.worldwidewaves.shared.events.utils.BoundingBox
 import com.worldwidewaves.shared.events.utils.Position
 import com.worldwidewaves.shared.utils.Log
+import com.worldwidewaves.shared.utils.RenderStage
+import com.worldwidewaves.shared.utils.RenderTrace
+import kotlinx.atomicfu.atomic
+import kotlin.concurrent.Volatile
 import kotlin.experimental.ExperimentalNativeApi
 
 /**
@@ -35,10 +39,12 @@ sealed class CameraCommand {
         val bounds: BoundingBox,
     ) : CameraCommand()
 
+    /** [minZoom] is solved by [CameraConstraintSolver]; NaN leaves the map min zoom unchanged. */
     data class SetConstraintBounds(
         val constraintBounds: BoundingBox,
         val originalEventBounds: BoundingBox?,
         val applyZoomSafetyMargin: Boolean,
+        val minZoom: Double = Double.NaN,
     ) : CameraCommand()
 
     data class SetMinZoom(
@@ -57,6 +63,17 @@ sealed class CameraCommand {
     ) : CameraCommand()
 }
 
+/**
+ * How the Swift wrapper turns wave polygons into MapLibre style objects.
+ */
+enum class WavePolygonRenderMode {
+    /** One MLNShapeSource + MLNFillStyleLayer per polygon (legacy behaviour). */
+    LAYER_PER_POLYGON,
+
+    /** All polygons merged into one MLNMultiPolygon source drawn by a single fill layer. */
+    SINGLE_SOURCE,
+}
+
 /**
  * Registry to store MapLibreViewWrapper instances, polygon data, and camera commands.
  * This allows coordination between Kotlin (IosEventMap) and Swift (MapLibreViewWrapper).
@@ -73,6 +90,11 @@ sealed class CameraCommand {
  * - CRITICAL: Must call unregisterWrapper() on screen exit to prevent leaks
  * - DisposableEffect in IosEventMap handles cleanup automatically
  * - LRU eviction (MAX_WRAPPERS=10): Prevents unbounded growth if cleanup fails
+ *
+ * State (see [EventMapState]):
+ * - One record per event, resolved once per operation instead of one map lookup per field
+ * - Pending polygons / camera commands are atomic slots: Kotlin may publish from any dispatcher
+ * - Swift callbacks are still dispatched to the main queue
  */
 @OptIn(ExperimentalNativeApi::class)
 object MapWrapperRegistry {
@@ -85,46 +107,69 @@ object MapWrapperRegistry {
      */
     private const val MAX_WRAPPERS = 10
 
-    /**
-     * Strong references to wrappers.
-     * Wrappers are kept alive for entire screen session.
-     * Explicit cleanup via unregisterWrapper() is required on screen exit.
-     *
-     * Changed from WeakReference to strong references to prevent premature GC.
-     * The wrapper MUST survive the entire screen session to handle dynamic updates.
-     *
-     * LRU eviction policy: When MAX_WRAPPERS is exceeded, oldest wrapper is evicted.
-     */
-    private val wrappers = mutableMapOf<String, Any>()
+    /** Visible regions wider than this (degrees) are fallback world bounds and ignored. */
+    private const val MAX_VISIBLE_REGION_SPAN = 10.0
 
     /**
-     * Track wrapper access order for LRU eviction.
-     * Most recently accessed wrapper is at the end of the list.
+     * Per-event state records, as an immutable map swapped atomically.
+     * Lookups are lock-free from any thread; records are only added or removed on
+     * registration changes, so copy-on-write is cheap.
      */
-    private val wrapperAccessOrder = mutableListOf<String>()
+    private val states = atomic<Map<String, EventMapState>>(emptyMap())
 
-    // Store pending polygon data that Swift will render
-    private val pendingPolygons = mutableMapOf<String, PendingPolygonData>()
+    /** Monotonic tick for wrapper LRU order (most recently used = highest). */
+    private val accessClock = atomic(0L)
 
-    // Store pending bbox draw requests that Swift will render
-    private val pendingBboxDraws = mutableMapOf<String, BoundingBox>()
-
-    // Store pending camera commands that Swift will execute
-    // Configuration commands (bounds/zoom) are stored separately and applied immediately
-    // Animation commands (AnimateToPosition, AnimateToBounds) use single slot (latest wins)
-    private val pendingAnimationCommands = mutableMapOf<String, CameraCommand>()
-    private val pendingConfigCommands = mutableMapOf<String, MutableList<CameraCommand>>()
-
-    // Store map click callbacks that Swift will invoke
-    private val mapClickCallbacks = mutableMapOf<String, () -> Unit>()
+    // Store camera animation callbacks (for async completion signaling), keyed by callback id
+    private val cameraAnimationCallbacks = mutableMapOf<String, MapCameraCallback>()
 
-    // Store render callbacks that Swift wrappers can register for immediate notifications
-    private val renderCallbacks = mutableMapOf<String, () -> Unit>()
+    // App-wide hook told about every wrapper dropped by unregisterWrapper (Swift map view pool)
+    @Volatile
+    private var wrapperReleasedListener: ((String, Any) -> Unit)? = null
 
+    /**
+     * Pending wave polygons in packed form (see [PackedPolygonBuffer]).
+     * Swift reads [packed] through NSData; [coordinates] is a lazily boxed view kept for
+     * diagnostics and tests, and is never touched on the render path.
+     *
+     * When [delta] is set the entry is an incremental update: [packed] is empty and Swift
+     * patches its current rings with the delta instead of replacing them.
+     */
     data class PendingPolygonData(
-        val coordinates: List<List<Pair<Double, Double>>>, // List of polygons, each containing lat/lng pairs
+        val packed: PackedPolygonBuffer,
         val clearExisting: Boolean,
-    )
+        val renderMode: WavePolygonRenderMode = WavePolygonRenderMode.LAYER_PER_POLYGON,
+        val delta: WavePolygonDelta? = null,
+    ) {
+        val coordinates: List<List<Pair<Double, Double>>> by lazy { packed.toPairs() }
+
+        val isDelta: Boolean get() = delta != null
+    }
+
+    /**
+     * Resolves [eventId] to its state record, creating it if needed.
+     * Callers on hot paths resolve once and work on the record.
+     */
+    internal fun handle(eventId: String): EventMapState {
+        states.value[eventId]?.let { return it }
+        while (true) {
+            val current = states.value
+            current[eventId]?.let { return it }
+            val created = EventMapState(eventId)
+            if (states.compareAndSet(current, current + (eventId to created))) return created
+        }
+    }
+
+    /** State record of [eventId] if one exists (never creates one). */
+    private fun stateOf(eventId: String): EventMapState? = states.value[eventId]
+
+    private fun removeState(eventId: String) {
+        while (true) {
+            val current = states.value
+            if (eventId !in current) return
+            if (states.compareAndSet(current, current - eventId)) return
+        }
+    }
 
     /**
      * Register a MapLibreViewWrapper for an event.
@@ -138,30 +183,30 @@ object MapWrapperRegistry {
         eventId: String,
         wrapper: Any,
     ) {
-        Log.d(TAG, "Registering wrapper for event: $eventId (total wrappers: ${wrappers.size})")
+        val registered = states.value.values.filter { it.wrapper != null }
+        Log.d(TAG, "Registering wrapper for event: $eventId (total wrappers: ${registered.size})")
 
         // Check if we need to evict LRU wrapper
-        if (wrappers.size >= MAX_WRAPPERS && !wrappers.containsKey(eventId)) {
-            val lruEventId = wrapperAccessOrder.firstOrNull()
-            if (lruEventId != null) {
-                Log.w(TAG, "MAX_WRAPPERS ($MAX_WRAPPERS) exceeded, evicting LRU wrapper: $lruEventId")
-                unregisterWrapper(lruEventId)
+        if (registered.size >= MAX_WRAPPERS && registered.none { it.eventId == eventId }) {
+            val lru = registered.minByOrNull { it.lastAccess }
+            if (lru != null) {
+                Log.w(TAG, "MAX_WRAPPERS ($MAX_WRAPPERS) exceeded, evicting LRU wrapper: ${lru.eventId}")
+                unregisterWrapper(lru.eventId)
             }
         }
 
-        // Remove from access order if already exists (will re-add at end)
-        wrapperAccessOrder.remove(eventId)
-
-        // Store strong reference
-        wrappers[eventId] = wrapper
-
-        // Add to end of access order (most recent)
-        wrapperAccessOrder.add(eventId)
+        // Store strong reference, most recently used
+        val state = handle(eventId)
+        state.wrapper = wrapper
+        state.lastAccess = accessClock.incrementAndGet()
 
         Log.i(TAG, "Wrapper registered with STRONG reference for: $eventId")
 
+        // A new wrapper starts with no rings: deltas computed against the old one are meaningless
+        state.requestPolygonResync()
+
         // If there are pending polygons, notify that they should be rendered
-        if (pendingPolygons.containsKey(eventId)) {
+        if (state.peekPolygons() != null) {
             Log.i(TAG, "Wrapper registered, pending polygons available for: $eventId")
         }
     }
@@ -171,23 +216,32 @@ object MapWrapperRegistry {
      * Returns null if not yet registered.
      * With strong references, wrapper is guaranteed to exist until unregisterWrapper() is called.
      *
-     * Updates LRU access order (moves wrapper to end of list as most recently used).
+     * Updates LRU access order (marks wrapper as most recently used).
      */
     fun getWrapper(eventId: String): Any? {
-        val wrapper = wrappers[eventId]
+        val state = stateOf(eventId)
+        val wrapper = state?.wrapper
         if (wrapper == null) {
             Log.w(TAG, "No wrapper registered for event: $eventId")
             return null
         }
 
-        // Update LRU access order (move to end = most recently used)
-        wrapperAccessOrder.remove(eventId)
-        wrapperAccessOrder.add(eventId)
+        state.lastAccess = accessClock.incrementAndGet()
 
         Log.v(TAG, "Retrieved wrapper for event: $eventId")
         return wrapper
     }
 
+    /**
+     * Register the app-wide listener invoked (on the main queue) with each wrapper released by
+     * [unregisterWrapper], including LRU evictions. Swift uses it to return map views to its pool.
+     * Pass null to remove it. Not reset by [clear].
+     */
+    fun setWrapperReleasedListener(listener: ((String, Any) -> Unit)?) {
+        Log.d(TAG, "Wrapper released listener ${if (listener != null) "set" else "cleared"}")
+        wrapperReleasedListener = listener
+    }
+
     /**
      * Store polygon data to be rendered.
      * Called from Kotlin when polygons need to be displayed.
@@ -197,27 +251,105 @@ object MapWrapperRegistry {
         coordinates: List<List<Pair<Double, Double>>>,
         clearExisting: Boolean,
     ) {
-        val totalPoints = coordinates.sumOf { it.size }
+        setPendingPolygons(eventId, PackedPolygonBuffer.fromPairs(coordinates), clearExisting)
+    }
+
+    /**
+     * Store packed polygon data to be rendered.
+     * Preferred entry point: the buffer crosses the bridge as two NSData blobs.
+     * Safe to call from any thread.
+     */
+    fun setPendingPolygons(
+        eventId: String,
+        packed: PackedPolygonBuffer,
+        clearExisting: Boolean,
+        renderMode: WavePolygonRenderMode = WavePolygonRenderMode.LAYER_PER_POLYGON,
+    ) {
+        setPendingPolygons(handle(eventId), packed, clearExisting, renderMode)
+    }
+
+    internal fun setPendingPolygons(
+        state: EventMapState,
+        packed: PackedPolygonBuffer,
+        clearExisting: Boolean,
+        renderMode: WavePolygonRenderMode,
+    ): Unit = RenderTrace.trace(RenderStage.REGISTRY_PUBLISH, state.eventId, packed.ringCount, packed.vertexCount) {
         Log.i(
             TAG,
-            "[WAVE] Storing ${coordinates.size} pending polygons for event: $eventId " +
-                "($totalPoints total points, clearExisting=$clearExisting)",
+            "[WAVE] Storing ${packed.ringCount} pending polygons for event: ${state.eventId} " +
+                "(${packed.vertexCount} total points, clearExisting=$clearExisting, mode=$renderMode)",
+        )
+        state.publishPolygons(PendingPolygonData(packed, clearExisting, renderMode))
+    }
+
+    /**
+     * Store an incremental wave update.
+     *
+     * Deltas must reach Swift in order, so an unconsumed entry is folded rather than overwritten:
+     * a pending full frame absorbs the delta, a pending delta is merged with it.
+     * Safe to call from any thread (the fold is a compare-and-set on the pending slot).
+     */
+    fun setPendingPolygonDelta(
+        eventId: String,
+        delta: WavePolygonDelta,
+        clearExisting: Boolean,
+        renderMode: WavePolygonRenderMode = WavePolygonRenderMode.SINGLE_SOURCE,
+    ) {
+        setPendingPolygonDelta(handle(eventId), delta, clearExisting, renderMode)
+    }
+
+    internal fun setPendingPolygonDelta(
+        state: EventMapState,
+        delta: WavePolygonDelta,
+        clearExisting: Boolean,
+        renderMode: WavePolygonRenderMode,
+    ): Unit = RenderTrace.trace(RenderStage.REGISTRY_PUBLISH, state.eventId, delta.ringCount, delta.changed.vertexCount) {
+        val folded =
+            state.foldPolygons { existing ->
+                when {
+                    existing == null -> PendingPolygonData(PackedPolygonBuffer.EMPTY, clearExisting, renderMode, delta)
+                    existing.delta != null -> existing.copy(delta = existing.delta.merge(delta), clearExisting = clearExisting)
+                    else -> existing.copy(packed = delta.applyTo(existing.packed), clearExisting = clearExisting)
+                }.copy(renderMode = renderMode)
+            }
+        Log.v(
+            TAG,
+            "[WAVE] Stored polygon delta for event: ${state.eventId} " +
+                "(${delta.changedIndices.size}/${delta.ringCount} rings changed, pendingDelta=${folded.isDelta})",
         )
-        pendingPolygons[eventId] = PendingPolygonData(coordinates, clearExisting)
-        Log.d(TAG, "Polygons stored, hasPending=${hasPendingPolygons(eventId)}, registrySize=${pendingPolygons.size}")
     }
 
+    /**
+     * Ask for the next wave frame of [eventId] to be sent in full.
+     * Swift calls this when a delta does not match its current rings.
+     */
+    fun requestFullPolygonResync(eventId: String) {
+        Log.i(TAG, "Full polygon resync requested for event: $eventId")
+        handle(eventId).requestPolygonResync()
+    }
+
+    /**
+     * Returns true (once) if a full frame is required for [eventId].
+     */
+    fun consumeFullPolygonResync(eventId: String): Boolean = stateOf(eventId)?.consumePolygonResync() ?: false
+
     /**
      * Get pending polygon data for an event.
      * Swift calls this to retrieve polygons that need to be rendered.
      * Returns null if no pending polygons.
      */
-    fun getPendingPolygons(eventId: String): PendingPolygonData? = pendingPolygons[eventId]
+    fun getPendingPolygons(eventId: String): PendingPolygonData? = stateOf(eventId)?.peekPolygons()
+
+    /**
+     * Get and clear pending polygon data in one atomic step.
+     * Preferred by Swift over get + clear: a frame published in between is kept for the next render.
+     */
+    fun takePendingPolygons(eventId: String): PendingPolygonData? = stateOf(eventId)?.takePolygons()
 
     /**
      * Check if there are pending polygons for an event.
      */
-    fun hasPendingPolygons(eventId: String): Boolean = pendingPolygons.containsKey(eventId)
+    fun hasPendingPolygons(eventId: String): Boolean = stateOf(eventId)?.peekPolygons() != null
 
     /**
      * Clear pending polygons after they've been rendered.
@@ -225,7 +357,7 @@ object MapWrapperRegistry {
      */
     fun clearPendingPolygons(eventId: String) {
         Log.v(TAG, "Clearing pending polygons for event: $eventId")
-        pendingPolygons.remove(eventId)
+        stateOf(eventId)?.clearPolygons()
     }
 
     /**
@@ -236,42 +368,25 @@ object MapWrapperRegistry {
     fun unregisterWrapper(eventId: String) {
         Log.i(TAG, "Unregistering wrapper and cleaning up for event: $eventId")
 
-        // Remove wrapper (releases strong reference)
-        wrappers.remove(eventId)
-
-        // Remove from LRU access order
-        wrapperAccessOrder.remove(eventId)
-
-        // Clean up all associated data and callbacks
-        pendingPolygons.remove(eventId)
-        pendingConfigCommands.remove(eventId)
-        pendingAnimationCommands.remove(eventId)
-        mapClickCallbacks.remove(eventId)
-        mapClickRegistrationCallbacks.remove(eventId)
-        renderCallbacks.remove(eventId)
-        cameraCallbacks.remove(eventId)
-        visibleRegions.remove(eventId)
-        minZoomLevels.remove(eventId)
-        mapWidths.remove(eventId)
-        mapHeights.remove(eventId)
-        cameraIdleListeners.remove(eventId)
-        onMapReadyCallbacks.remove(eventId)
-        styleLoadedStates.remove(eventId)
-        locationComponentCallbacks.remove(eventId)
-        setUserPositionCallbacks.remove(eventId)
-        pendingLocationComponentStates.remove(eventId)
-        pendingUserPositions.remove(eventId)
-        setGesturesEnabledCallbacks.remove(eventId)
-        pendingGesturesStates.remove(eventId)
+        val released = stateOf(eventId)?.wrapper
+
+        // Dropping the record releases the wrapper and every pending slot and callback at once
+        removeState(eventId)
+
+        // Let Swift recycle the wrapper's map view once the screen is gone
+        val listener = wrapperReleasedListener
+        if (released != null && listener != null) {
+            platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
+                listener.invoke(eventId, released)
+            }
+        }
 
         Log.i(TAG, "Wrapper unregistered and cleanup complete for: $eventId")
     }
 
-    // REMOVED: pruneStaleReferences() - no longer needed with strong references
-
     /**
      * Store a camera command to be executed.
-     * Called from Kotlin when camera needs to be controlled.
+     * Called from Kotlin when camera needs to be controlled. Safe to call from any thread.
      *
      * Architecture:
      * - Configuration commands (SetConstraintBounds, SetMinZoom, SetMaxZoom) are queued
@@ -289,7 +404,7 @@ object MapWrapperRegistry {
                     "AnimateToPosition(${command.position.lat},${command.position.lng},zoom=${command.zoom})"
                 is CameraCommand.AnimateToBounds -> "AnimateToBounds(padding=${command.padding})"
                 is CameraCommand.MoveToBounds -> "MoveToBounds"
-                is CameraCommand.SetConstraintBounds -> "SetConstraintBounds"
+                is CameraCommand.SetConstraintBounds -> "SetConstraintBounds(minZoom=${command.minZoom})"
                 is CameraCommand.SetMinZoom -> "SetMinZoom(${command.minZoom})"
                 is CameraCommand.SetMaxZoom -> "SetMaxZoom(${command.maxZoom})"
                 is CameraCommand.SetAttributionMargins ->
@@ -297,6 +412,8 @@ object MapWrapperRegistry {
             }
         Log.i(TAG, "[CAMERA] Storing camera command for event: $eventId -> $commandDetails")
 
+        val state = handle(eventId)
+
         // Separate configuration commands (must all execute) from animation commands (latest wins)
         when (command) {
             is CameraCommand.SetConstraintBounds,
@@ -305,27 +422,23 @@ object MapWrapperRegistry {
             is CameraCommand.SetAttributionMargins,
             -> {
                 // Queue configuration commands (all must execute in order)
-                val queue = pendingConfigCommands.getOrPut(eventId) { mutableListOf() }
-                queue.add(command)
-                Log.d(TAG, "Config command queued, queue size=${queue.size}")
+                val queueSize = state.enqueueConfigCommand(command)
+                Log.d(TAG, "Config command queued, queue size=$queueSize")
             }
             is CameraCommand.AnimateToPosition,
             is CameraCommand.AnimateToBounds,
             is CameraCommand.MoveToBounds,
             -> {
                 // Single slot for animations (latest wins, cancel previous)
-                pendingAnimationCommands[eventId] = command
+                state.publishAnimationCommand(command)
                 Log.d(TAG, "Animation command stored (overwrites previous animation)")
             }
         }
 
         // Trigger immediate execution (like wave polygons)
-        requestImmediateCameraExecution(eventId)
+        requestImmediateCameraExecution(state)
     }
 
-    // Store camera execution callbacks
-    private val cameraCallbacks = mutableMapOf<String, () -> Unit>()
-
     /**
      * Register a callback that Swift wrapper will invoke when camera command needs execution.
      * This enables direct dispatch pattern (no polling).
@@ -335,7 +448,7 @@ object MapWrapperRegistry {
         callback: () -> Unit,
     ) {
         Log.d(TAG, "Setting camera callback for event: $eventId")
-        cameraCallbacks[eventId] = callback
+        handle(eventId).cameraCallback = callback
     }
 
     /**
@@ -343,14 +456,19 @@ object MapWrapperRegistry {
      * Invokes the registered camera callback if available.
      */
     fun requestImmediateCameraExecution(eventId: String) {
-        val callback = cameraCallbacks[eventId]
+        stateOf(eventId)?.let { requestImmediateCameraExecution(it) }
+            ?: Log.v(TAG, "No camera callback registered for event: $eventId (will fall back to polling)")
+    }
+
+    private fun requestImmediateCameraExecution(state: EventMapState) {
+        val callback = state.cameraCallback
         if (callback != null) {
-            Log.i(TAG, "[CAMERA] Triggering immediate camera execution for event: $eventId")
+            Log.i(TAG, "[CAMERA] Triggering immediate camera execution for event: ${state.eventId}")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke()
             }
         } else {
-            Log.v(TAG, "No camera callback registered for event: $eventId (will fall back to polling)")
+            Log.v(TAG, "No camera callback registered for event: ${state.eventId} (will fall back to polling)")
         }
     }
 
@@ -362,25 +480,12 @@ object MapWrapperRegistry {
      * Priority: Configuration commands execute first (in queue order), then animation commands.
      * This ensures map constraints are set before animations run.
      */
-    fun getPendingCameraCommand(eventId: String): CameraCommand? {
-        // Check configuration queue first (must execute before animations)
-        val configQueue = pendingConfigCommands[eventId]
-        if (configQueue != null && configQueue.isNotEmpty()) {
-            return configQueue.first() // Return oldest config command (FIFO)
-        }
-
-        // Then check animation slot
-        return pendingAnimationCommands[eventId]
-    }
+    fun getPendingCameraCommand(eventId: String): CameraCommand? = stateOf(eventId)?.peekCameraCommand()
 
     /**
      * Check if there is a pending camera command for an event.
      */
-    fun hasPendingCameraCommand(eventId: String): Boolean {
-        val hasConfig = pendingConfigCommands[eventId]?.isNotEmpty() == true
-        val hasAnimation = pendingAnimationCommands.containsKey(eventId)
-        return hasConfig || hasAnimation
-    }
+    fun hasPendingCameraCommand(eventId: String): Boolean = stateOf(eventId)?.hasCameraCommand() ?: false
 
     /**
      * Clear pending camera command after it's been executed.
@@ -391,23 +496,21 @@ object MapWrapperRegistry {
      */
     fun clearPendingCameraCommand(eventId: String) {
         Log.v(TAG, "Clearing pending camera command for event: $eventId")
+        val removed = stateOf(eventId)?.removeCameraCommand() ?: return
+        Log.v(TAG, "Removed camera command: ${removed::class.simpleName}")
+    }
 
-        // Try to clear from config queue first (FIFO removal)
-        val configQueue = pendingConfigCommands[eventId]
-        if (configQueue != null && configQueue.isNotEmpty()) {
-            val removed = configQueue.removeAt(0)
-            Log.v(TAG, "Removed config command: ${removed::class.simpleName}, remaining=${configQueue.size}")
-            if (configQueue.isEmpty()) {
-                pendingConfigCommands.remove(eventId)
-            }
-            return
-        }
-
-        // Then try animation slot
-        if (pendingAnimationCommands.containsKey(eventId)) {
-            pendingAnimationCommands.remove(eventId)
-            Log.v(TAG, "Cleared animation command")
-        }
+    /**
+     * Clear [command] after Swift executed it.
+     * Unlike [clearPendingCameraCommand], an animation published by Kotlin while Swift was
+     * executing [command] is kept.
+     */
+    fun clearPendingCameraCommand(
+        eventId: String,
+        command: CameraCommand,
+    ) {
+        val removed = stateOf(eventId)?.removeCameraCommand(command)
+        Log.v(TAG, "Cleared executed camera command for event: $eventId (removed=${removed != null})")
     }
 
     /**
@@ -419,13 +522,9 @@ object MapWrapperRegistry {
         callback: () -> Unit,
     ) {
         Log.i(TAG, "Registering map click callback for event: $eventId")
-        mapClickCallbacks[eventId] = callback
-        Log.d(TAG, "Map click callback registered, totalCallbacks=${mapClickCallbacks.size}")
+        handle(eventId).mapClickCallback = callback
     }
 
-    // Store map click registration callbacks (for direct wrapper registration)
-    private val mapClickRegistrationCallbacks = mutableMapOf<String, (() -> Unit) -> Unit>()
-
     /**
      * Register a callback that Swift wrapper will invoke to register map click callbacks.
      * This enables direct callback storage in wrapper (no registry lookup).
@@ -435,7 +534,7 @@ object MapWrapperRegistry {
         callback: ((() -> Unit) -> Unit),
     ) {
         Log.d(TAG, "Setting map click registration callback for event: $eventId")
-        mapClickRegistrationCallbacks[eventId] = callback
+        handle(eventId).mapClickRegistrationCallback = callback
     }
 
     /**
@@ -446,7 +545,7 @@ object MapWrapperRegistry {
         eventId: String,
         clickCallback: () -> Unit,
     ) {
-        val registrationCallback = mapClickRegistrationCallbacks[eventId]
+        val registrationCallback = stateOf(eventId)?.mapClickRegistrationCallback
         if (registrationCallback != null) {
             Log.i(TAG, "Triggering map click callback registration for event: $eventId")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
@@ -459,34 +558,41 @@ object MapWrapperRegistry {
         }
     }
 
-    // Store visible region that Swift can update
-    private val visibleRegions = mutableMapOf<String, BoundingBox>()
-
-    // Store zoom levels that Swift can update
-    private val minZoomLevels = mutableMapOf<String, Double>()
-
-    // Store map dimensions that Swift can update
-    private val mapWidths = mutableMapOf<String, Double>()
-    private val mapHeights = mutableMapOf<String, Double>()
-
-    // Store camera idle listeners (support multiple listeners per event like Android)
-    private val cameraIdleListeners = mutableMapOf<String, MutableList<() -> Unit>>()
-
-    // Store camera positions and zoom for StateFlow updates
-    private val cameraPositions = mutableMapOf<String, Pair<Double, Double>>()
-    private val cameraZooms = mutableMapOf<String, Double>()
-
-    // Store camera animation callbacks (for async completion signaling)
-    private val cameraAnimationCallbacks = mutableMapOf<String, MapCameraCallback>()
-
-    // Store map click coordinate listeners (for tap with coordinates)
-    private val mapClickCoordinateListeners = mutableMapOf<String, (Double, Double) -> Unit>()
-
-    // Store map ready callbacks (invoked after style loads)
-    private val onMapReadyCallbacks = mutableMapOf<String, MutableList<() -> Unit>>()
-
-    // Track style loaded state
-    private val styleLoadedStates = mutableMapOf<String, Boolean>()
+    /**
+     * Update the whole viewport from Swift in one call (regionDidChangeAnimated).
+     * Replaces the separate camera/zoom/region/dimension updates on the gesture path, then
+     * invokes the camera idle listeners so they observe the new state.
+     *
+     * The visible region is only stored when it spans less than [MAX_VISIBLE_REGION_SPAN]
+     * degrees, to ignore the world bounds MapLibre reports before the camera is settled.
+     */
+    fun updateViewportSnapshot(
+        eventId: String,
+        centerLatitude: Double,
+        centerLongitude: Double,
+        zoom: Double,
+        minZoom: Double,
+        swLat: Double,
+        swLng: Double,
+        neLat: Double,
+        neLng: Double,
+        width: Double,
+        height: Double,
+    ) {
+        val state = handle(eventId)
+        state.viewport.apply {
+            this.centerLatitude = centerLatitude
+            this.centerLongitude = centerLongitude
+            this.zoom = zoom
+            this.minZoom = minZoom
+            this.width = width
+            this.height = height
+            if (neLat - swLat < MAX_VISIBLE_REGION_SPAN && neLng - swLng < MAX_VISIBLE_REGION_SPAN) {
+                setVisibleRegion(swLat, swLng, neLat, neLng)
+            }
+        }
+        invokeCameraIdleListeners(state)
+    }
 
     /**
      * Update visible region from Swift.
@@ -496,14 +602,14 @@ object MapWrapperRegistry {
         eventId: String,
         bbox: BoundingBox,
     ) {
-        visibleRegions[eventId] = bbox
+        handle(eventId).viewport.setVisibleRegion(bbox.sw.lat, bbox.sw.lng, bbox.ne.lat, bbox.ne.lng)
     }
 
     /**
      * Get visible region from wrapper.
      * Returns the current visible bounds of the map.
      */
-    fun getVisibleRegion(eventId: String): BoundingBox? = visibleRegions[eventId]
+    fun getVisibleRegion(eventId: String): BoundingBox? = stateOf(eventId)?.viewport?.visibleRegion()
 
     /**
      * Update min zoom level from Swift.
@@ -512,13 +618,13 @@ object MapWrapperRegistry {
         eventId: String,
         minZoom: Double,
     ) {
-        minZoomLevels[eventId] = minZoom
+        handle(eventId).viewport.minZoom = minZoom
     }
 
     /**
      * Get min zoom level for event (cached from Swift).
      */
-    fun getMinZoom(eventId: String): Double = minZoomLevels[eventId] ?: 0.0
+    fun getMinZoom(eventId: String): Double = stateOf(eventId)?.viewport?.minZoom?.takeUnless { it.isNaN() } ?: 0.0
 
     /**
      * Update map width from Swift.
@@ -528,7 +634,7 @@ object MapWrapperRegistry {
         eventId: String,
         width: Double,
     ) {
-        mapWidths[eventId] = width
+        handle(eventId).viewport.width = width
         Log.v(TAG, "Map width updated: $width for event: $eventId")
     }
 
@@ -540,7 +646,7 @@ object MapWrapperRegistry {
         eventId: String,
         height: Double,
     ) {
-        mapHeights[eventId] = height
+        handle(eventId).viewport.height = height
         Log.v(TAG, "Map height updated: $height for event: $eventId")
     }
 
@@ -548,83 +654,13 @@ object MapWrapperRegistry {
      * Get map width for event.
      * Returns actual map view width from Swift wrapper.
      */
-    fun getMapWidth(eventId: String): Double = mapWidths[eventId] ?: 0.0
+    fun getMapWidth(eventId: String): Double = stateOf(eventId)?.viewport?.width?.takeUnless { it.isNaN() } ?: 0.0
 
     /**
      * Get map height for event.
      * Returns actual map view height from Swift wrapper.
      */
-    fun getMapHeight(eventId: String): Double = mapHeights[eventId] ?: 0.0
-
-    /**
-     * Get actual min zoom from map view (bypasses cache to prevent race condition).
-     * This directly queries the Swift wrapper's map view for the current minimum zoom level.
-     * Called from IosMapLibreAdapter.getMinZoomLevel() to get real-time value.
-     *
-     * NOTE: This method should be called from Swift via IOSMapBridge to populate
-     * the actualMinZoomLevels map with real-time values before querying.
-     */
-    private val actualMinZoomLevels = mutableMapOf<String, Double>()
-
-    fun getActualMinZoom(eventId: String): Double {
-        val wrapper =
-            getWrapper(eventId) ?: run {
-                Log.w(TAG, "getActualMinZoom: wrapper is null for event: $eventId")
-                return 0.0
-            }
-
-        // Call wrapper's getMinZoom() which queries mapView.minimumZoomLevel directly
-        return actualMinZoomLevels[eventId] ?: run {
-            Log.v(TAG, "getActualMinZoom: no cached value for $eventId, requesting from Swift")
-            // Will be populated by Swift calling updateActualMinZoom()
-            0.0
-        }
-    }
-
-    /**
-     * Update actual min zoom from Swift (called synchronously before getActualMinZoom).
-     */
-    fun updateActualMinZoom(
-        eventId: String,
-        actualMinZoom: Double,
-    ) {
-        actualMinZoomLevels[eventId] = actualMinZoom
-        Log.v(TAG, "updateActualMinZoom: $eventId -> $actualMinZoom")
-    }
-
-    /**
-     * Synchronously fetch actualMinZoom from wrapper and update cache.
-     * This is called before getActualMinZoom() to ensure fresh value.
-     *
-     * NOTE: This triggers the registered callback which will call updateActualMinZoom().
-     */
-    fun syncActualMinZoomFromWrapper(eventId: String) {
-        val wrapper = getWrapper(eventId)
-        if (wrapper != null) {
-            // Trigger getActualMinZoom callback (registered by Swift wrapper)
-            val callback = getActualMinZoomCallbacks[eventId]
-            if (callback != null) {
-                callback.invoke()
-                Log.v(TAG, "syncActualMinZoomFromWrapper: triggered callback for $eventId")
-            } else {
-                Log.w(TAG, "syncActualMinZoomFromWrapper: no callback registered for $eventId")
-            }
-        }
-    }
-
-    private val getActualMinZoomCallbacks = mutableMapOf<String, () -> Unit>()
-
-    /**
-     * Register callback for getActualMinZoom requests.
-     * Swift wrapper registers this to provide real-time min zoom values.
-     */
-    fun setGetActualMinZoomCallback(
-        eventId: String,
-        callback: () -> Unit,
-    ) {
-        getActualMinZoomCallbacks[eventId] = callback
-        Log.d(TAG, "Registered getActualMinZoom callback for event: $eventId")
-    }
+    fun getMapHeight(eventId: String): Double = stateOf(eventId)?.viewport?.height?.takeUnless { it.isNaN() } ?: 0.0
 
     /**
      * Set min zoom command (Swift will execute).
@@ -671,7 +707,7 @@ object MapWrapperRegistry {
         callback: () -> Unit,
     ) {
         Log.d(TAG, "Adding camera idle listener for event: $eventId")
-        val listeners = cameraIdleListeners.getOrPut(eventId) { mutableListOf() }
+        val listeners = handle(eventId).cameraIdleListeners
         listeners.add(callback)
         Log.d(TAG, "Camera idle listeners for $eventId: ${listeners.size}")
     }
@@ -681,18 +717,22 @@ object MapWrapperRegistry {
      * Executes all registered callbacks in order.
      */
     fun invokeCameraIdleListener(eventId: String) {
-        val listeners = cameraIdleListeners[eventId]
-        if (listeners == null || listeners.isEmpty()) {
+        stateOf(eventId)?.let { invokeCameraIdleListeners(it) }
+    }
+
+    private fun invokeCameraIdleListeners(state: EventMapState) {
+        val listeners = state.cameraIdleListeners
+        if (listeners.isEmpty()) {
             return
         }
 
-        Log.v(TAG, "Invoking ${listeners.size} camera idle callback(s) for event: $eventId")
+        Log.v(TAG, "Invoking ${listeners.size} camera idle callback(s) for event: ${state.eventId}")
         // Create a copy to avoid ConcurrentModificationException if callbacks add more listeners
         listeners.toList().forEach { callback ->
             try {
                 callback.invoke()
             } catch (e: Exception) {
-                Log.e(TAG, "Error invoking camera idle callback for event: $eventId", throwable = e)
+                Log.e(TAG, "Error invoking camera idle callback for event: ${state.eventId}", throwable = e)
             }
         }
     }
@@ -705,14 +745,14 @@ object MapWrapperRegistry {
         listener: (Double, Double) -> Unit,
     ) {
         Log.d(TAG, "Setting map click coordinate listener for event: $eventId")
-        mapClickCoordinateListeners[eventId] = listener
+        handle(eventId).mapClickCoordinateListener = listener
     }
 
     /**
      * Clear map click coordinate listener.
      */
     fun clearMapClickCoordinateListener(eventId: String) {
-        mapClickCoordinateListeners.remove(eventId)
+        stateOf(eventId)?.mapClickCoordinateListener = null
     }
 
     /**
@@ -723,7 +763,7 @@ object MapWrapperRegistry {
         latitude: Double,
         longitude: Double,
     ) {
-        val listener = mapClickCoordinateListeners[eventId]
+        val listener = stateOf(eventId)?.mapClickCoordinateListener
         if (listener != null) {
             Log.d(TAG, "Invoking map click coordinate listener: ($latitude, $longitude)")
             listener.invoke(latitude, longitude)
@@ -739,20 +779,20 @@ object MapWrapperRegistry {
         bbox: BoundingBox,
     ) {
         Log.d(TAG, "Storing pending bbox for event: $eventId")
-        pendingBboxDraws[eventId] = bbox
+        handle(eventId).publishBboxDraw(bbox)
     }
 
     /**
      * Check if there is a pending bbox draw for this event.
      * Called from Swift IOSMapBridge to poll for bbox requests.
      */
-    fun hasPendingBboxDraw(eventId: String): Boolean = pendingBboxDraws.containsKey(eventId)
+    fun hasPendingBboxDraw(eventId: String): Boolean = stateOf(eventId)?.hasBboxDraw() ?: false
 
     /**
      * Get and clear pending bbox draw.
      * Called from Swift IOSMapBridge after rendering.
      */
-    fun getPendingBboxDraw(eventId: String): BoundingBox? = pendingBboxDraws.remove(eventId)
+    fun getPendingBboxDraw(eventId: String): BoundingBox? = stateOf(eventId)?.takeBboxDraw()
 
     /**
      * Update camera position from Swift (for StateFlow reactive updates).
@@ -763,7 +803,10 @@ object MapWrapperRegistry {
         latitude: Double,
         longitude: Double,
     ) {
-        cameraPositions[eventId] = Pair(latitude, longitude)
+        handle(eventId).viewport.apply {
+            centerLatitude = latitude
+            centerLongitude = longitude
+        }
         Log.v(TAG, "Camera position updated: ($latitude, $longitude)")
     }
 
@@ -775,19 +818,22 @@ object MapWrapperRegistry {
         eventId: String,
         zoom: Double,
     ) {
-        cameraZooms[eventId] = zoom
+        handle(eventId).viewport.zoom = zoom
         Log.v(TAG, "Camera zoom updated: $zoom")
     }
 
     /**
      * Get camera position for event.
      */
-    fun getCameraPosition(eventId: String): Pair<Double, Double>? = cameraPositions[eventId]
+    fun getCameraPosition(eventId: String): Pair<Double, Double>? =
+        stateOf(eventId)?.viewport?.takeIf { it.hasCameraPosition }?.let { Pair(it.centerLatitude, it.centerLongitude) }
 
     /**
      * Get camera zoom for event.
      */
-    fun getCameraZoom(eventId: String): Double? = cameraZooms[eventId]
+    fun getCameraZoom(eventId: String): Double? = stateOf(eventId)?.let { getCameraZoom(it) }
+
+    internal fun getCameraZoom(state: EventMapState): Double? = state.viewport.zoom.takeUnless { it.isNaN() }
 
     /**
      * Store camera animation callback for async completion.
@@ -825,7 +871,7 @@ object MapWrapperRegistry {
     @Suppress("ReturnCount") // Early returns for error handling - clearer than nested conditionals
     fun invokeMapClickCallback(eventId: String): Boolean {
         Log.i(TAG, "invokeMapClickCallback called for event: $eventId")
-        val callback = mapClickCallbacks[eventId]
+        val callback = stateOf(eventId)?.mapClickCallback
         if (callback != null) {
             Log.i(TAG, "Map click callback found, invoking for event: $eventId")
             try {
@@ -837,7 +883,7 @@ object MapWrapperRegistry {
                 return false
             }
         }
-        Log.w(TAG, "WARNING: No map click callback registered for event: $eventId (available: ${mapClickCallbacks.keys})")
+        Log.w(TAG, "WARNING: No map click callback registered for event: $eventId")
         return false
     }
 
@@ -846,39 +892,27 @@ object MapWrapperRegistry {
      */
     fun clearMapClickCallback(eventId: String) {
         Log.v(TAG, "Clearing map click callback for event: $eventId")
-        mapClickCallbacks.remove(eventId)
+        stateOf(eventId)?.mapClickCallback = null
     }
 
     /**
      * Register a callback that Swift wrapper will invoke when immediate render is requested.
-     * This enables direct dispatch pattern (no polling).
+     * This enables direct dispatch pattern (no polling). The Swift side only marks the event
+     * dirty; the actual render happens on the next display refresh.
      */
     fun setRenderCallback(
         eventId: String,
         callback: () -> Unit,
     ) {
         Log.d(TAG, "Setting render callback for event: $eventId")
-        renderCallbacks[eventId] = callback
+        handle(eventId).renderCallback = callback
     }
 
     /**
      * Get the registered render callback for an event.
      * Used for synchronous polygon rendering.
      */
-    fun getRenderCallback(eventId: String): (() -> Unit)? = renderCallbacks[eventId]
-
-    // Store callbacks for location component control
-    private val locationComponentCallbacks = mutableMapOf<String, (Boolean) -> Unit>()
-    private val setUserPositionCallbacks = mutableMapOf<String, (Double, Double) -> Unit>()
-
-    // Store callbacks for gesture control
-    private val setGesturesEnabledCallbacks = mutableMapOf<String, (Boolean) -> Unit>()
-
-    // Store pending user position (for race condition handling)
-    private val pendingUserPositions = mutableMapOf<String, Pair<Double, Double>>()
-
-    // Store pending gestures state (for race condition handling)
-    private val pendingGesturesStates = mutableMapOf<String, Boolean>()
+    fun getRenderCallback(eventId: String): (() -> Unit)? = stateOf(eventId)?.renderCallback
 
     /**
      * Register callback for enabling/disabling location component.
@@ -888,17 +922,18 @@ object MapWrapperRegistry {
         eventId: String,
         callback: (Boolean) -> Unit,
     ) {
-        locationComponentCallbacks[eventId] = callback
+        val state = handle(eventId)
+        state.locationComponentCallback = callback
         Log.d(TAG, "Location component callback registered for event: $eventId")
 
         // Apply pending location component state if it was set before callback registered
-        val pendingState = pendingLocationComponentStates[eventId]
+        val pendingState = state.pendingLocationComponentState
         if (pendingState != null) {
             Log.i(TAG, "Applying pending location component state: $pendingState for event: $eventId")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke(pendingState)
             }
-            pendingLocationComponentStates.remove(eventId)
+            state.pendingLocationComponentState = null
         }
     }
 
@@ -910,27 +945,25 @@ object MapWrapperRegistry {
         eventId: String,
         callback: (Double, Double) -> Unit,
     ) {
-        setUserPositionCallbacks[eventId] = callback
+        val state = handle(eventId)
+        state.userPositionCallback = callback
         Log.d(TAG, "User position callback registered for event: $eventId")
 
         // Apply pending user position if it was set before callback registered
-        val pendingPosition = pendingUserPositions[eventId]
+        val pendingPosition = state.pendingUserPosition
         if (pendingPosition != null) {
             Log.i(TAG, "Applying pending user position: (${pendingPosition.first}, ${pendingPosition.second}) for event: $eventId")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke(pendingPosition.first, pendingPosition.second)
             }
-            pendingUserPositions.remove(eventId)
+            state.pendingUserPosition = null
         }
     }
 
     /**
      * Check if user position callback is registered for an event.
      */
-    fun hasUserPositionCallback(eventId: String): Boolean = setUserPositionCallbacks.containsKey(eventId)
-
-    // Store pending location component state (for race condition handling)
-    private val pendingLocationComponentStates = mutableMapOf<String, Boolean>()
+    fun hasUserPositionCallback(eventId: String): Boolean = stateOf(eventId)?.userPositionCallback != null
 
     /**
      * Enable or disable location component on the map wrapper.
@@ -939,18 +972,19 @@ object MapWrapperRegistry {
         eventId: String,
         enabled: Boolean,
     ) {
-        val callback = locationComponentCallbacks[eventId]
+        val state = handle(eventId)
+        val callback = state.locationComponentCallback
         if (callback != null) {
             Log.d(TAG, "Invoking location component callback: $enabled for event: $eventId")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke(enabled)
             }
             // Clear pending state after successful invocation
-            pendingLocationComponentStates.remove(eventId)
+            state.pendingLocationComponentState = null
         } else {
             Log.w(TAG, "No location component callback registered for event: $eventId - storing pending state")
             // Store pending state to apply when callback is registered
-            pendingLocationComponentStates[eventId] = enabled
+            state.pendingLocationComponentState = enabled
         }
     }
 
@@ -964,7 +998,8 @@ object MapWrapperRegistry {
     ) {
         Log.i(TAG, "[POSITION] setUserPositionOnWrapper called: ($latitude, $longitude) for event: $eventId")
 
-        val callback = setUserPositionCallbacks[eventId]
+        val state = handle(eventId)
+        val callback = state.userPositionCallback
         if (callback != null) {
             Log.d(TAG, "Dispatching position update to Swift via callback")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
@@ -972,11 +1007,11 @@ object MapWrapperRegistry {
                 Log.v(TAG, "Position callback invoked on main queue")
             }
             // Clear pending position after successful dispatch
-            pendingUserPositions.remove(eventId)
+            state.pendingUserPosition = null
         } else {
             Log.w(TAG, "WARNING: No user position callback registered for event: $eventId - storing latest position")
             // Store only the latest position (overwrites previous)
-            pendingUserPositions[eventId] = Pair(latitude, longitude)
+            state.pendingUserPosition = Pair(latitude, longitude)
         }
     }
 
@@ -988,17 +1023,18 @@ object MapWrapperRegistry {
         eventId: String,
         callback: (Boolean) -> Unit,
     ) {
-        setGesturesEnabledCallbacks[eventId] = callback
+        val state = handle(eventId)
+        state.gesturesEnabledCallback = callback
         Log.d(TAG, "Gestures callback registered for event: $eventId")
 
         // Apply pending gestures state if it was set before callback registered
-        val pendingState = pendingGesturesStates[eventId]
+        val pendingState = state.pendingGesturesState
         if (pendingState != null) {
             Log.i(TAG, "Applying pending gestures state: $pendingState for event: $eventId")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke(pendingState)
             }
-            pendingGesturesStates.remove(eventId)
+            state.pendingGesturesState = null
         }
     }
 
@@ -1009,36 +1045,43 @@ object MapWrapperRegistry {
         eventId: String,
         enabled: Boolean,
     ) {
-        val callback = setGesturesEnabledCallbacks[eventId]
+        val state = handle(eventId)
+        val callback = state.gesturesEnabledCallback
         if (callback != null) {
             Log.d(TAG, "Invoking gestures callback: $enabled for event: $eventId")
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke(enabled)
             }
             // Clear pending state after successful invocation
-            pendingGesturesStates.remove(eventId)
+            state.pendingGesturesState = null
         } else {
             Log.w(TAG, "No gestures callback registered for event: $eventId - storing pending state")
             // Store pending state to apply when callback is registered
-            pendingGesturesStates[eventId] = enabled
+            state.pendingGesturesState = enabled
         }
     }
 
     /**
-     * Request immediate render of pending polygons.
-     * Invokes the registered render callback if available.
-     * Called from Kotlin when polygons are updated.
+     * Request render of pending polygons.
+     * Invokes the registered render callback if available; Swift coalesces these requests
+     * (MapRenderScheduler) and renders at most once per display refresh.
+     * Called from Kotlin when polygons are updated, from any thread.
      */
     fun requestImmediateRender(eventId: String) {
-        val callback = renderCallbacks[eventId]
+        stateOf(eventId)?.let { requestImmediateRender(it) }
+            ?: Log.v(TAG, "No render callback registered for event: $eventId (will fall back to polling)")
+    }
+
+    internal fun requestImmediateRender(state: EventMapState) {
+        val callback = state.renderCallback
         if (callback != null) {
-            Log.i(TAG, "[RENDER] Triggering immediate render callback for event: $eventId")
+            Log.i(TAG, "[RENDER] Triggering immediate render callback for event: ${state.eventId}")
             // Dispatch to main queue to ensure UI thread execution
             platform.darwin.dispatch_async(platform.darwin.dispatch_get_main_queue()) {
                 callback.invoke()
             }
         } else {
-            Log.v(TAG, "No render callback registered for event: $eventId (will fall back to polling)")
+            Log.v(TAG, "No render callback registered for event: ${state.eventId} (will fall back to polling)")
         }
     }
 
@@ -1051,8 +1094,7 @@ object MapWrapperRegistry {
         callback: () -> Unit,
     ) {
         Log.d(TAG, "Adding map ready callback for event: $eventId")
-        val callbacks = onMapReadyCallbacks.getOrPut(eventId) { mutableListOf() }
-        callbacks.add(callback)
+        handle(eventId).onMapReadyCallbacks.add(callback)
     }
 
     /**
@@ -1064,20 +1106,20 @@ object MapWrapperRegistry {
         loaded: Boolean,
     ) {
         Log.i(TAG, "Style loaded state updated: $loaded for event: $eventId")
-        styleLoadedStates[eventId] = loaded
+        handle(eventId).styleLoaded = loaded
     }
 
     /**
      * Check if style is loaded for an event.
      */
-    fun isStyleLoaded(eventId: String): Boolean = styleLoadedStates[eventId] ?: false
+    fun isStyleLoaded(eventId: String): Boolean = stateOf(eventId)?.styleLoaded ?: false
 
     /**
      * Invoke all registered map ready callbacks for an event.
      * Called from Swift after style loads.
      */
     fun invokeMapReadyCallbacks(eventId: String) {
-        val callbacks = onMapReadyCallbacks[eventId]
+        val callbacks = stateOf(eventId)?.onMapReadyCallbacks
         if (callbacks == null || callbacks.isEmpty()) {
             Log.v(TAG, "No map ready callbacks registered for event: $eventId")
             return
@@ -1094,7 +1136,7 @@ object MapWrapperRegistry {
         }
 
         // Clear callbacks after invoking (one-time use)
-        onMapReadyCallbacks.remove(eventId)
+        callbacks.clear()
         Log.d(TAG, "Map ready callbacks cleared for event: $eventId")
     }
 
@@ -1104,31 +1146,7 @@ object MapWrapperRegistry {
      */
     fun clear() {
         Log.d(TAG, "Clearing all registered wrappers, pending data, and callbacks")
-        wrappers.clear()
-        wrapperAccessOrder.clear()
-        pendingPolygons.clear()
-        pendingConfigCommands.clear()
-        pendingAnimationCommands.clear()
-        mapClickCallbacks.clear()
-        mapClickRegistrationCallbacks.clear()
-        mapClickCoordinateListeners.clear()
-        renderCallbacks.clear()
-        cameraCallbacks.clear()
-        visibleRegions.clear()
-        minZoomLevels.clear()
-        mapWidths.clear()
-        mapHeights.clear()
-        cameraIdleListeners.clear()
-        cameraPositions.clear()
-        cameraZooms.clear()
+        states.value = emptyMap()
         cameraAnimationCallbacks.clear()
-        onMapReadyCallbacks.clear()
-        styleLoadedStates.clear()
-        locationComponentCallbacks.clear()
-        setUserPositionCallbacks.clear()
-        pendingLocationComponentStates.clear()
-        pendingUserPositions.clear()
-        setGesturesEnabledCallbacks.clear()
-        pendingGesturesStates.clear()
     }
 }
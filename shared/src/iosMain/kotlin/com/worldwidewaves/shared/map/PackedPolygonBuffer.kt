@@ -0,0 +1,154 @@
+@file:OptIn(ExperimentalForeignApi::class, BetaInteropApi::class)
+
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Polygon
+import kotlinx.cinterop.BetaInteropApi
+import kotlinx.cinterop.ExperimentalForeignApi
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.usePinned
+import platform.Foundation.NSData
+import platform.Foundation.create
+
+/**
+ * Flat polygon representation used to move wave polygons across the Kotlin → Swift bridge.
+ *
+ * Layout:
+ * - [coordinates]: interleaved `lat0, lng0, lat1, lng1, ...` for every ring, back to back.
+ *   Two consecutive doubles have the same memory layout as `CLLocationCoordinate2D`, so Swift
+ *   can reinterpret the buffer directly without per-vertex conversion.
+ * - [ringOffsets]: `ringCount + 1` vertex indices. Ring `i` spans vertices
+ *   `ringOffsets[i] until ringOffsets[i + 1]`.
+ *
+ * Replaces the `List<List<Pair<Double, Double>>>` form that boxed two objects per vertex on
+ * the Kotlin side and unboxed them again through `NSNumber` on the Swift side.
+ */
+class PackedPolygonBuffer(
+    val coordinates: DoubleArray,
+    val ringOffsets: IntArray,
+) {
+    init {
+        require(coordinates.size % 2 == 0) { "Interleaved coordinates must contain lat/lng pairs" }
+        require(ringOffsets.isNotEmpty() && ringOffsets.first() == 0) { "Ring offsets must start at 0" }
+        require(ringOffsets.last() * 2 == coordinates.size) { "Ring offsets must end at the vertex count" }
+    }
+
+    /** Number of polygon rings in the buffer. */
+    val ringCount: Int get() = ringOffsets.size - 1
+
+    /** Total number of vertices across all rings. */
+    val vertexCount: Int get() = coordinates.size / 2
+
+    /** Number of vertices in ring [index]. */
+    fun ringSize(index: Int): Int = ringOffsets[index + 1] - ringOffsets[index]
+
+    /**
+     * Interleaved coordinates as a single NSData blob (one memcpy, no per-vertex objects).
+     * Swift reads it as `UnsafeBufferPointer<CLLocationCoordinate2D>`.
+     */
+    fun coordinateData(): NSData = coordinates.toNSData()
+
+    /** Ring offsets as packed Int32 values for Swift. */
+    fun ringOffsetData(): NSData = ringOffsets.toNSData()
+
+    /** Expands the buffer back to boxed pairs. Only intended for diagnostics and tests. */
+    fun toPairs(): List<List<Pair<Double, Double>>> =
+        List(ringCount) { ring ->
+            val start = ringOffsets[ring]
+            List(ringSize(ring)) { i ->
+                val base = (start + i) * 2
+                Pair(coordinates[base], coordinates[base + 1])
+            }
+        }
+
+    /** Interleaved coordinates of ring [index] as a standalone copy. */
+    fun ringCoordinates(index: Int): DoubleArray = coordinates.copyOfRange(ringOffsets[index] * 2, ringOffsets[index + 1] * 2)
+
+    /** Splits the buffer into one interleaved coordinate array per ring. */
+    fun toRings(): List<DoubleArray> = List(ringCount) { ringCoordinates(it) }
+
+    companion object {
+        val EMPTY = PackedPolygonBuffer(DoubleArray(0), IntArray(1))
+
+        /** Packs polygons by walking each linked list once; no intermediate collections. */
+        fun fromPolygons(polygons: List<Polygon>): PackedPolygonBuffer {
+            val offsets = IntArray(polygons.size + 1)
+            polygons.forEachIndexed { index, polygon -> offsets[index + 1] = offsets[index] + polygon.size }
+
+            val coords = DoubleArray(offsets.last() * 2)
+            var cursor = 0
+            polygons.forEach { polygon ->
+                polygon.forEach { position ->
+                    coords[cursor++] = position.lat
+                    coords[cursor++] = position.lng
+                }
+            }
+            return PackedPolygonBuffer(coords, offsets)
+        }
+
+        /** Packs legacy lat/lng pair lists (kept for existing callers of setPendingPolygons). */
+        fun fromPairs(polygons: List<List<Pair<Double, Double>>>): PackedPolygonBuffer {
+            val offsets = IntArray(polygons.size + 1)
+            polygons.forEachIndexed { index, ring -> offsets[index + 1] = offsets[index] + ring.size }
+
+            val coords = DoubleArray(offsets.last() * 2)
+            var cursor = 0
+            polygons.forEach { ring ->
+                ring.forEach { (lat, lng) ->
+                    coords[cursor++] = lat
+                    coords[cursor++] = lng
+                }
+            }
+            return PackedPolygonBuffer(coords, offsets)
+        }
+
+        /** Concatenates per-ring interleaved coordinate arrays (inverse of [toRings]). */
+        fun fromRings(rings: List<DoubleArray>): PackedPolygonBuffer {
+            val offsets = IntArray(rings.size + 1)
+            rings.forEachIndexed { index, ring -> offsets[index + 1] = offsets[index] + ring.size / 2 }
+
+            val coords = DoubleArray(offsets.last() * 2)
+            rings.forEachIndexed { index, ring -> ring.copyInto(coords, offsets[index] * 2) }
+            return PackedPolygonBuffer(coords, offsets)
+        }
+    }
+}
+
+private fun DoubleArray.toNSData(): NSData =
+    if (isEmpty()) {
+        NSData()
+    } else {
+        usePinned { pinned ->
+            NSData.create(bytes = pinned.addressOf(0), length = (size * Double.SIZE_BYTES).toULong())
+        }
+    }
+
+internal fun IntArray.toNSData(): NSData =
+    if (isEmpty()) {
+        NSData()
+    } else {
+        usePinned { pinned ->
+            NSData.create(bytes = pinned.addressOf(0), length = (size * Int.SIZE_BYTES).toULong())
+        }
+    }
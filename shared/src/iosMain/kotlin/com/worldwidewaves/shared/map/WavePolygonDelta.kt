@@ -0,0 +1,143 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.geometry.contentFingerprint
+import com.worldwidewaves.shared.events.utils.Polygon
+import platform.Foundation.NSData
+
+/**
+ * Ring-level patch between two consecutive wave frames.
+ *
+ * A linear wave only moves its front: polygons fully behind the cut longitude come out of
+ * `splitByLongitude` identical from one tick to the next, only the rings crossed by the front
+ * change. The delta carries just those rings, so bytes crossing the bridge and native work per
+ * tick follow the front movement rather than the covered area.
+ *
+ * Applying a delta to a ring list of size [baseRingCount]:
+ * 1. resize the list to [ringCount] (truncate or pad with empty rings),
+ * 2. replace ring `changedIndices[i]` with ring `i` of [changed].
+ *
+ * The receiver must reject the delta when its ring count differs from [baseRingCount]
+ * and ask for a full frame instead (see [MapWrapperRegistry.requestFullPolygonResync]).
+ */
+class WavePolygonDelta(
+    val baseRingCount: Int,
+    val ringCount: Int,
+    val changedIndices: IntArray,
+    val changed: PackedPolygonBuffer,
+) {
+    init {
+        require(changedIndices.size == changed.ringCount) { "One packed ring per changed index" }
+        require(changedIndices.all { it in 0 until ringCount }) { "Changed index outside target ring count" }
+    }
+
+    val isEmpty: Boolean get() = changedIndices.isEmpty() && ringCount == baseRingCount
+
+    /** Changed indices as packed Int32 values for Swift. */
+    fun changedIndexData(): NSData = changedIndices.toNSData()
+
+    /** Applies this delta to a full frame, yielding the full frame the receiver would end up with. */
+    fun applyTo(base: PackedPolygonBuffer): PackedPolygonBuffer {
+        require(base.ringCount == baseRingCount) { "Delta base $baseRingCount does not match ${base.ringCount} rings" }
+        return PackedPolygonBuffer.fromRings(expand(base.toRings()))
+    }
+
+    /**
+     * Folds [next] (computed against the result of this delta) into a single delta against
+     * this delta's base. Used when a tick lands before the previous one was rendered.
+     */
+    fun merge(next: WavePolygonDelta): WavePolygonDelta {
+        require(next.baseRingCount == ringCount) { "Deltas are not consecutive" }
+
+        val merged = HashMap<Int, DoubleArray>()
+        changedIndices.forEachIndexed { i, index -> merged[index] = changed.ringCoordinates(i) }
+        merged.keys.removeAll { it >= next.ringCount }
+        next.changedIndices.forEachIndexed { i, index -> merged[index] = next.changed.ringCoordinates(i) }
+
+        val indices = merged.keys.sorted().toIntArray()
+        return WavePolygonDelta(
+            baseRingCount = baseRingCount,
+            ringCount = next.ringCount,
+            changedIndices = indices,
+            changed = PackedPolygonBuffer.fromRings(indices.map { merged.getValue(it) }),
+        )
+    }
+
+    private fun expand(base: List<DoubleArray>): List<DoubleArray> {
+        val rings = MutableList(ringCount) { index -> base.getOrElse(index) { DoubleArray(0) } }
+        changedIndices.forEachIndexed { i, index -> rings[index] = changed.ringCoordinates(i) }
+        return rings
+    }
+}
+
+/**
+ * Produces [WavePolygonDelta]s from successive full wave frames.
+ *
+ * Keeps one 64-bit fingerprint per ring of the last encoded frame. Each frame is walked once to
+ * fingerprint it; only rings whose fingerprint changed are packed. One instance per map, and
+ * [reset] whenever the native side may have lost its state (new wrapper, explicit clear).
+ */
+class WavePolygonDeltaEncoder {
+    private var fingerprints = LongArray(0)
+    private var hasBaseline = false
+
+    /** True once a full frame has been encoded; until then [encode] returns null. */
+    val isSynced: Boolean get() = hasBaseline
+
+    /**
+     * Records [polygons] as the current frame.
+     * Returns null when no baseline exists yet (caller must send a full frame),
+     * otherwise the delta from the previous frame (possibly empty).
+     */
+    fun encode(polygons: List<Polygon>): WavePolygonDelta? {
+        val next = LongArray(polygons.size) { polygons[it].contentFingerprint() }
+        val previous = fingerprints
+        fingerprints = next
+
+        if (!hasBaseline) {
+            hasBaseline = true
+            return null
+        }
+
+        val changed = ArrayList<Polygon>()
+        val indices = ArrayList<Int>()
+        for (index in next.indices) {
+            if (index >= previous.size || previous[index] != next[index]) {
+                indices += index
+                changed += polygons[index]
+            }
+        }
+
+        return WavePolygonDelta(
+            baseRingCount = previous.size,
+            ringCount = next.size,
+            changedIndices = indices.toIntArray(),
+            changed = PackedPolygonBuffer.fromPolygons(changed),
+        )
+    }
+
+    fun reset() {
+        fingerprints = LongArray(0)
+        hasBaseline = false
+    }
+}
@@ -23,28 +23,45 @@ package com.worldwidewaves.shared.sound
 
 import com.worldwidewaves.shared.utils.Log
 import kotlinx.cinterop.ExperimentalForeignApi
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.alloc
 import kotlinx.cinterop.get
-import kotlinx.cinterop.set
+import kotlinx.cinterop.memScoped
+import kotlinx.cinterop.ptr
+import kotlinx.cinterop.usePinned
+import kotlinx.coroutines.Dispatchers
 import kotlinx.coroutines.delay
 import kotlinx.coroutines.sync.Mutex
 import kotlinx.coroutines.sync.withLock
+import kotlinx.coroutines.withContext
 import platform.AVFAudio.AVAudioEngine
+import platform.AVFAudio.AVAudioFormat
 import platform.AVFAudio.AVAudioMixerNode
 import platform.AVFAudio.AVAudioPCMBuffer
 import platform.AVFAudio.AVAudioPlayerNode
 import platform.AVFAudio.AVAudioSession
 import platform.AVFAudio.AVAudioSessionCategoryOptionMixWithOthers
 import platform.AVFAudio.AVAudioSessionCategoryPlayback
+import platform.AVFAudio.AVAudioTime
 import platform.AVFAudio.outputVolume
 import platform.AVFAudio.setActive
+import platform.darwin.mach_absolute_time
+import platform.darwin.mach_timebase_info
+import platform.darwin.mach_timebase_info_data_t
+import platform.posix.memcpy
 import kotlin.time.Duration
 import kotlin.time.Duration.Companion.milliseconds
+import kotlin.time.Duration.Companion.seconds
 
 /**
  * iOS implementation of SoundPlayer using AVAudioEngine
  *
  * This is a working implementation that provides functional audio capabilities
  * while using iOS-safe APIs that compile correctly with Kotlin/Native.
+ *
+ * Tones come from a [ToneCache] at the hardware sample rate and are copied into pooled
+ * `AVAudioPCMBuffer`s, so a wave hit only costs a memcpy and a schedule. [scheduleTone]
+ * starts them at a host time on the audio clock instead of after a coroutine timer.
  */
 @OptIn(kotlinx.cinterop.ExperimentalForeignApi::class)
 class IosSoundPlayer :
@@ -52,6 +69,13 @@ class IosSoundPlayer :
     VolumeController {
     companion object {
         private const val TAG = "WWW.Sound.iOS"
+
+        // Reusable PCM buffers: one playing, one being filled
+        private const val BUFFER_POOL_SIZE = 2
+        private val POOLED_BUFFER_DURATION = 2.seconds + ToneCache.DURATION_BUCKET
+
+        // Margin after the tone so the buffer has drained before its reuse
+        private val PLAYBACK_TAIL = 50.milliseconds
     }
 
     private val audioSession = AVAudioSession.sharedInstance()
@@ -63,6 +87,20 @@ class IosSoundPlayer :
     private var isEngineSetupAttempted = false
     private var originalMixerVolume: Float = 1.0f
 
+    // Created with the engine, at the hardware sample rate
+    private var pcmFormat: AVAudioFormat? = null
+    private var toneCache: ToneCache? = null
+    private val bufferPool = mutableListOf<AVAudioPCMBuffer>()
+
+    // mach_absolute_time() ticks per nanosecond (1 on Intel, 1/41.67 on Apple silicon)
+    private val hostTicksPerNanosecond: Double by lazy {
+        memScoped {
+            val timebase = alloc<mach_timebase_info_data_t>()
+            mach_timebase_info(timebase.ptr)
+            timebase.denom.toDouble() / timebase.numer.toDouble()
+        }
+    }
+
     init {
         setupAudioSession()
         // Defer engine setup to first playback attempt
@@ -116,6 +154,8 @@ class IosSoundPlayer :
 
             audioEngine.prepare()
             audioEngine.startAndReturnError(null)
+            pcmFormat = mixerNode.outputFormatForBus(0u)
+            toneCache = ToneCache(sampleRate = sampleRate.toInt())
             isEngineStarted = true
             Log.v(TAG, "Audio engine setup completed successfully")
         } catch (e: Exception) {
@@ -143,82 +183,77 @@ class IosSoundPlayer :
         amplitude: Double,
         duration: Duration,
         waveform: SoundPlayer.Waveform,
+    ) = play(ToneSpec(frequency, amplitude, duration, waveform), Duration.ZERO)
+
+    /**
+     * Queues [tone] at an `AVAudioTime` host time, so its first sample plays [startDelay] from
+     * the call regardless of mutex waits or coroutine wakeups.
+     */
+    override suspend fun scheduleTone(
+        tone: ToneSpec,
+        startDelay: Duration,
+    ) = play(tone, startDelay)
+
+    private suspend fun play(
+        tone: ToneSpec,
+        startDelay: Duration,
     ) {
+        // Converted on entry: everything below only has to finish before the start time
+        val startTime = if (startDelay > Duration.ZERO) AVAudioTime(hostTime = hostTimeAfter(startDelay)) else null
+
         playbackMutex.withLock {
             // Lazy engine initialization on first playback
             if (!isEngineSetupAttempted) {
                 setupAudioEngine()
             }
 
-            if (!isEngineStarted) {
+            val cache = toneCache
+            if (!isEngineStarted || cache == null) {
                 Log.w(TAG, "Audio engine not available (simulator mode), skipping playback")
-                delay(duration) // Maintain timing even without audio
+                delay(startDelay + tone.duration) // Maintain timing even without audio
                 return@withLock
             }
 
+            var buffer: AVAudioPCMBuffer? = null
+            var bufferScheduled = false
             try {
-                // Save current mixer volume
+                // Save current mixer volume, then play at maximum volume
+                // (applied on the next render cycle, before the 10ms attack envelope is over)
                 originalMixerVolume = mixerNode.volume
-
-                // Set mixer to maximum volume
                 mixerNode.setVolume(1.0f)
                 Log.v(TAG, "Set volume to max (1.0) from $originalMixerVolume")
 
-                // Wait for volume change to take effect
-                delay(50.milliseconds)
-
-                Log.v(TAG, "Playing tone: freq=$frequency, amp=$amplitude, dur=$duration, wave=$waveform")
+                Log.v(TAG, "Playing tone: $tone, startDelay=$startDelay")
 
-                // Generate waveform samples using shared generator
-                val sampleRate = 44100
-                val samples =
-                    WaveformGenerator.generateWaveform(
-                        sampleRate = sampleRate,
-                        frequency = frequency,
-                        amplitude = amplitude,
-                        duration = duration,
-                        waveform = waveform,
-                    )
+                // Pre-rendered by prepareTones() for choreography notes, rendered once otherwise
+                val samples = cache.get(tone)
 
                 if (samples.isNotEmpty()) {
-                    // Use the mixer's output format to ensure compatibility
-                    val format = mixerNode.outputFormatForBus(0u)
-
-                    val frameCapacity = samples.size.toUInt()
-                    val buffer =
-                        AVAudioPCMBuffer(
-                            pCMFormat = format,
-                            frameCapacity = frameCapacity,
-                        )
-
-                    buffer.frameLength = frameCapacity
-
-                    // Copy samples to buffer
-                    val floatChannelData = buffer.floatChannelData
-                    if (floatChannelData != null) {
-                        val channel0 = floatChannelData[0]
-                        if (channel0 != null) {
-                            samples.forEachIndexed { index, sample ->
-                                channel0[index] = sample.toFloat()
-                            }
-
-                            // Schedule and play buffer
-                            playerNode.scheduleBuffer(buffer, null)
-                            playerNode.play()
-
-                            // Wait for playback to complete
-                            delay(duration + 50.milliseconds)
-                            Log.v(TAG, "iOS audio playback completed (${samples.size} samples)")
-                        } else {
-                            Log.w(TAG, "Failed to get channel 0 pointer")
-                        }
+                    buffer = acquireBuffer(samples.size)
+                    if (buffer != null && fillBuffer(buffer, samples)) {
+                        // Schedule and play buffer (a past start time plays immediately)
+                        playerNode.scheduleBuffer(buffer, startTime, 0u, null)
+                        bufferScheduled = true
+                        playerNode.play()
+
+                        // Wait for playback to complete
+                        delay(startDelay + tone.duration + PLAYBACK_TAIL)
+                        bufferScheduled = false
+                        Log.v(TAG, "iOS audio playback completed (${samples.size} samples)")
                     } else {
                         Log.w(TAG, "Failed to get channel data from buffer")
                     }
                 }
+            } catch (e: kotlinx.coroutines.CancellationException) {
+                throw e
             } catch (e: Exception) {
-                Log.e(TAG, "Error playing tone: freq=$frequency, dur=$duration", e)
+                Log.e(TAG, "Error playing tone: freq=${tone.frequency}, dur=${tone.duration}", e)
             } finally {
+                // Cancelled (or failed) before the tail: the node may still be reading the buffer,
+                // stop it so the next tone cannot overwrite samples being played
+                if (bufferScheduled) playerNode.stop()
+                buffer?.let { recycleBuffer(it) }
+
                 // Always restore original mixer volume
                 mixerNode.setVolume(originalMixerVolume)
                 Log.v(TAG, "Restored volume to $originalMixerVolume")
@@ -226,6 +261,70 @@ class IosSoundPlayer :
         }
     }
 
+    private fun hostTimeAfter(delay: Duration): ULong =
+        mach_absolute_time() + (delay.inWholeNanoseconds * hostTicksPerNanosecond).toULong()
+
+    /**
+     * Renders [tones] into the tone cache off the main thread.
+     *
+     * Also sets up the audio engine when needed, which takes that cost out of the first hit.
+     * Rendering happens outside [playbackMutex], so a hit during preparation is not delayed
+     * by the batch; only the cache insertions are serialized with playback.
+     */
+    override suspend fun prepareTones(tones: Collection<ToneSpec>) {
+        val (cache, missing) =
+            playbackMutex.withLock {
+                if (!isEngineSetupAttempted) {
+                    setupAudioEngine()
+                }
+                val cache = toneCache ?: return
+                cache to cache.missingKeys(tones)
+            }
+
+        val rendered =
+            withContext(Dispatchers.Default) {
+                var count = 0
+                for (key in missing) {
+                    val samples = cache.render(key)
+                    if (!playbackMutex.withLock { cache.put(key, samples) }) break
+                    count++
+                }
+                count
+            }
+        Log.d(TAG, "Prepared $rendered tones (${missing.size} missing, ${tones.size} requested)")
+    }
+
+    // Buffers are sized for the longest choreography tone so any of them fits any cached tone
+    private fun acquireBuffer(frameCount: Int): AVAudioPCMBuffer? {
+        val format = pcmFormat ?: return null
+        val index = bufferPool.indexOfFirst { it.frameCapacity.toInt() >= frameCount }
+        if (index >= 0) return bufferPool.removeAt(index)
+
+        val capacity = maxOf(frameCount, (format.sampleRate * POOLED_BUFFER_DURATION.inWholeMilliseconds / 1000.0).toInt())
+        return AVAudioPCMBuffer(pCMFormat = format, frameCapacity = capacity.toUInt())
+    }
+
+    private fun recycleBuffer(buffer: AVAudioPCMBuffer) {
+        if (bufferPool.size < BUFFER_POOL_SIZE) bufferPool.add(buffer)
+    }
+
+    // Copies mono PCM into every channel of the (possibly stereo) mixer format
+    private fun fillBuffer(
+        buffer: AVAudioPCMBuffer,
+        samples: FloatArray,
+    ): Boolean {
+        val floatChannelData = buffer.floatChannelData ?: return false
+        val byteCount = (samples.size * Float.SIZE_BYTES).toULong()
+        samples.usePinned { pinned ->
+            for (channelIndex in 0 until buffer.format.channelCount.toInt()) {
+                val channel = floatChannelData[channelIndex] ?: return false
+                memcpy(channel, pinned.addressOf(0), byteCount)
+            }
+        }
+        buffer.frameLength = samples.size.toUInt()
+        return true
+    }
+
     override fun release() {
         try {
             if (playerNode.isPlaying()) {
@@ -237,6 +336,9 @@ class IosSoundPlayer :
                 isEngineStarted = false
             }
 
+            toneCache?.clear()
+            bufferPool.clear()
+
             audioSession.setActive(false, null)
             Log.v(TAG, "iOS sound player released")
         } catch (e: Exception) {
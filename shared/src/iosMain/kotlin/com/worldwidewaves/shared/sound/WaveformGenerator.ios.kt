@@ -0,0 +1,82 @@
+package com.worldwidewaves.shared.sound
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlinx.cinterop.ExperimentalForeignApi
+import kotlinx.cinterop.FloatVar
+import kotlinx.cinterop.IntVar
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.alloc
+import kotlinx.cinterop.memScoped
+import kotlinx.cinterop.ptr
+import kotlinx.cinterop.usePinned
+import kotlinx.cinterop.value
+import platform.Accelerate.vDSP_vramp
+import platform.Accelerate.vDSP_vsmul
+import platform.Accelerate.vvsinf
+import kotlin.math.PI
+import kotlin.math.floor
+
+// Samples per ramp: the Float ramp stays accurate because each block restarts from a
+// Double-precision, wrapped phase
+private const val SINE_BLOCK_SIZE = 1024
+
+/**
+ * iOS SINE kernel on Accelerate: phase ramps with vDSP_vramp, vForce vvsinf, then one
+ * vDSP_vsmul for the amplitude.
+ */
+@OptIn(ExperimentalForeignApi::class)
+internal actual fun fillSine(
+    output: FloatArray,
+    phase: Double,
+    phaseIncrement: Double,
+    amplitude: Float,
+) {
+    if (output.isEmpty()) return
+
+    output.usePinned { pinned ->
+        memScoped {
+            val start = alloc<FloatVar>()
+            val step = alloc<FloatVar>()
+            val count = alloc<IntVar>()
+            val gain = alloc<FloatVar>()
+            step.value = (2.0 * PI * phaseIncrement).toFloat()
+            gain.value = amplitude
+
+            var offset = 0
+            while (offset < output.size) {
+                val blockSize = minOf(SINE_BLOCK_SIZE, output.size - offset)
+                val blockPhase = phase + offset * phaseIncrement
+                start.value = (2.0 * PI * (blockPhase - floor(blockPhase))).toFloat()
+                count.value = blockSize
+
+                val block = pinned.addressOf(offset)
+                vDSP_vramp(start.ptr, step.ptr, block, 1, blockSize.toULong())
+                vvsinf(block, block, count.ptr)
+                offset += blockSize
+            }
+
+            val all = pinned.addressOf(0)
+            vDSP_vsmul(all, 1, gain.ptr, all, 1, output.size.toULong())
+        }
+    }
+}
@@ -0,0 +1,77 @@
+@file:Suppress("MatchingDeclarationName") // expect/actual pattern requires .ios.kt suffix
+
+package com.worldwidewaves.shared.utils
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlin.concurrent.Volatile
+
+/**
+ * Receives render chain intervals on iOS. Implemented in Swift (`WWWSignposts`) with
+ * `os_signpost`, which needs static interval names that Kotlin/Native cannot emit.
+ */
+interface SignpostSink {
+    /** True while Instruments records signposts for the render chain log. */
+    fun isRecording(): Boolean
+
+    fun beginInterval(
+        name: String,
+        detail: String,
+        id: Int,
+    )
+
+    fun endInterval(
+        name: String,
+        id: Int,
+    )
+}
+
+/**
+ * Entry point for Swift to install its [SignpostSink] at startup.
+ * Without a sink, stages only feed the in-app aggregate of [RenderTrace].
+ */
+object SignpostBridge {
+    @Volatile
+    var sink: SignpostSink? = null
+}
+
+@PublishedApi
+internal actual object PlatformTraceSection {
+    actual val isRecording: Boolean
+        get() = SignpostBridge.sink?.isRecording() == true
+
+    actual fun begin(
+        stage: RenderStage,
+        detail: String,
+        cookie: Int,
+    ) {
+        SignpostBridge.sink?.beginInterval(stage.traceName, detail, cookie)
+    }
+
+    actual fun end(
+        stage: RenderStage,
+        detail: String,
+        cookie: Int,
+    ) {
+        SignpostBridge.sink?.endInterval(stage.traceName, cookie)
+    }
+}
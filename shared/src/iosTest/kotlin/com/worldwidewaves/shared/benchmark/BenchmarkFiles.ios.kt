@@ -0,0 +1,48 @@
+package com.worldwidewaves.shared.benchmark
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import kotlinx.cinterop.ExperimentalForeignApi
+import kotlinx.cinterop.addressOf
+import kotlinx.cinterop.toKString
+import kotlinx.cinterop.usePinned
+import platform.Foundation.NSData
+import platform.Foundation.NSFileManager
+import platform.Foundation.dataWithContentsOfFile
+import platform.posix.getenv
+import platform.posix.memcpy
+
+@OptIn(ExperimentalForeignApi::class)
+actual object BenchmarkFiles {
+    actual val platform: String = "ios-native"
+
+    actual fun readBytes(relativePath: String): ByteArray? {
+        // The simulator shares the host file system; WWW_REPO_ROOT is forwarded by Gradle
+        val root = getenv("WWW_REPO_ROOT")?.toKString() ?: "${NSFileManager.defaultManager.currentDirectoryPath}/.."
+        val data = NSData.dataWithContentsOfFile("$root/$relativePath") ?: return null
+        val bytes = ByteArray(data.length.toInt())
+        if (bytes.isNotEmpty()) {
+            bytes.usePinned { pinned -> memcpy(pinned.addressOf(0), data.bytes, data.length) }
+        }
+        return bytes
+    }
+}
@@ -0,0 +1,68 @@
+package com.worldwidewaves.shared.benchmark
+
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.geometry.PolygonOperations
+import com.worldwidewaves.shared.events.geometry.PolygonTransformations
+import com.worldwidewaves.shared.map.MapWrapperRegistry
+import com.worldwidewaves.shared.map.PackedPolygonBuffer
+import kotlinx.coroutines.test.runTest
+import kotlin.test.AfterTest
+import kotlin.test.Test
+import kotlin.time.Duration.Companion.minutes
+
+/**
+ * Kotlin side of the wave polygon bridge: pack the wave polygons, publish them in
+ * [MapWrapperRegistry], take them as the Swift render pass does and expose the NSData blobs.
+ */
+class MapWrapperRegistryBenchmark {
+    private val eventId = "benchmark-event"
+
+    @AfterTest
+    fun tearDown() {
+        MapWrapperRegistry.clearPendingPolygons(eventId)
+    }
+
+    @Test
+    fun polygonRoundTrip() =
+        runTest(timeout = 10.minutes) {
+            BenchmarkFixtures.CITIES.forEach { city ->
+                val area = BenchmarkFixtures.cityArea(city)
+                if (area.isNullOrEmpty()) {
+                    println("Skipping $city: GeoJSON not available")
+                    return@forEach
+                }
+                // Half of the city covered by the wave
+                val bbox = PolygonOperations.polygonsBbox(area)
+                val midLongitude = (bbox.minLongitude + bbox.maxLongitude) / 2
+                val wave = area.flatMap { PolygonTransformations.splitByLongitude(it, midLongitude).left }
+
+                BenchmarkRunner.measure("MapWrapperRegistry.polygonRoundTrip.$city", operationsPerIteration = 10) {
+                    MapWrapperRegistry.setPendingPolygons(eventId, PackedPolygonBuffer.fromPolygons(wave), clearExisting = true)
+                    val pending = MapWrapperRegistry.takePendingPolygons(eventId)
+                    val packed = pending?.packed
+                    (packed?.coordinateData()?.length ?: 0UL) + (packed?.ringOffsetData()?.length ?: 0UL)
+                }
+            }
+        }
+}
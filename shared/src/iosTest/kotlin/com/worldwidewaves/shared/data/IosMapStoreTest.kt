@@ -19,11 +19,13 @@ package com.worldwidewaves.shared.data
  * See the License for the specific language governing permissions and
  * limitations under the License. */
 
+import com.worldwidewaves.shared.events.io.WaveKeyframeStore
 import kotlinx.coroutines.test.runTest
 import kotlin.test.Test
 import kotlin.test.assertEquals
 import kotlin.test.assertFalse
 import kotlin.test.assertNotNull
+import kotlin.test.assertNull
 import kotlin.test.assertTrue
 
 /**
@@ -116,4 +118,47 @@ class IosMapStoreTest {
             // Results should be consistent (both null in test environment)
             assertEquals(path1, path2, "Cache invalidation should allow consistent results")
         }
+
+    @Test
+    fun `binary area copied from a mounted ODR tag is served for the session`() =
+        runTest {
+            val eventId = "test_odr_area"
+            val root = platformCacheRoot().also { platformEnsureDir(it) }
+            val areaPath = "$root/$eventId.${MapFileExtension.AREA}"
+            val keyframePath = WaveKeyframeStore.path(root, eventId)
+            clearUnavailableGeoJsonCache(eventId)
+            platformDeleteFile("$areaPath.metadata")
+
+            // Not in the visible bundle: the miss is remembered for the session
+            assertNull(getAreaFileAbsolutePath(eventId))
+
+            // What mountAndCopyResource does once the tag is mounted
+            platformWriteText(areaPath, "WWWA")
+            platformWriteText(keyframePath, "stale keyframe")
+            onAreaFileCached(root, eventId)
+
+            assertEquals(areaPath, getAreaFileAbsolutePath(eventId))
+            assertEquals(platformAppVersionStamp(), platformReadText("$areaPath.metadata"))
+            assertFalse(platformFileExists(keyframePath), "Keyframe of the previous area should be dropped")
+
+            platformDeleteFile(areaPath)
+            platformDeleteFile("$areaPath.metadata")
+        }
+
+    @Test
+    fun `clearEventCache removes the binary area of an uninstalled event`() =
+        runTest {
+            val eventId = "test_uninstall_area"
+            val root = platformCacheRoot().also { platformEnsureDir(it) }
+            val areaPath = "$root/$eventId.${MapFileExtension.AREA}"
+            platformWriteText(areaPath, "WWWA")
+            onAreaFileCached(root, eventId)
+            assertEquals(areaPath, getAreaFileAbsolutePath(eventId))
+
+            clearEventCache(eventId)
+
+            assertFalse(platformFileExists(areaPath))
+            assertFalse(platformFileExists("$areaPath.metadata"))
+            assertNull(getAreaFileAbsolutePath(eventId), "Uninstalled event should have no area")
+        }
 }
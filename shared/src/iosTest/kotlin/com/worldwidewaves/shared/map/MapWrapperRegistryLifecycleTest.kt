@@ -195,6 +195,31 @@ class MapWrapperRegistryLifecycleTest {
         assertEquals(0.0, MapWrapperRegistry.getMinZoom(eventId)) // Returns default
     }
 
+    @Test
+    fun `viewport snapshot updates all viewport state before idle listeners run`() {
+        val eventId = "snapshot-test"
+        var zoomSeenByListener: Double? = null
+        MapWrapperRegistry.setCameraIdleListener(eventId) {
+            zoomSeenByListener = MapWrapperRegistry.getCameraZoom(eventId)
+        }
+
+        MapWrapperRegistry.updateViewportSnapshot(eventId, 48.85, 2.35, 12.5, 3.0, 48.8, 2.3, 48.9, 2.4, 390.0, 844.0)
+
+        assertEquals(12.5, zoomSeenByListener)
+        assertEquals(Pair(48.85, 2.35), MapWrapperRegistry.getCameraPosition(eventId))
+        assertEquals(3.0, MapWrapperRegistry.getMinZoom(eventId))
+        assertEquals(390.0, MapWrapperRegistry.getMapWidth(eventId))
+        assertEquals(844.0, MapWrapperRegistry.getMapHeight(eventId))
+        val region = assertNotNull(MapWrapperRegistry.getVisibleRegion(eventId))
+        assertEquals(48.8, region.sw.lat)
+        assertEquals(2.4, region.ne.lng)
+
+        // World-sized fallback bounds keep the last valid visible region
+        MapWrapperRegistry.updateViewportSnapshot(eventId, 0.0, 0.0, 1.0, 1.0, -85.0, -180.0, 85.0, 180.0, 390.0, 844.0)
+        assertEquals(48.8, MapWrapperRegistry.getVisibleRegion(eventId)?.sw?.lat)
+        assertEquals(1.0, MapWrapperRegistry.getCameraZoom(eventId))
+    }
+
     // ============================================================
     // ISOLATION TESTS
     // ============================================================
@@ -599,4 +599,77 @@ class MapWrapperRegistryTest {
         // Cleanup
         MapWrapperRegistry.clear()
     }
+
+    @Test
+    fun testPendingPolygons_RenderModeDefaultsToLayerPerPolygon() {
+        MapWrapperRegistry.setPendingPolygons("event1", listOf(listOf(Pair(0.0, 0.0))), true)
+
+        assertEquals(
+            WavePolygonRenderMode.LAYER_PER_POLYGON,
+            MapWrapperRegistry.getPendingPolygons("event1")?.renderMode,
+        )
+    }
+
+    @Test
+    fun testPendingPolygons_SingleSourceModePreserved() {
+        val packed = PackedPolygonBuffer.fromPairs(listOf(listOf(Pair(0.0, 0.0), Pair(1.0, 0.0), Pair(1.0, 1.0))))
+        MapWrapperRegistry.setPendingPolygons("event1", packed, true, WavePolygonRenderMode.SINGLE_SOURCE)
+
+        assertEquals(
+            WavePolygonRenderMode.SINGLE_SOURCE,
+            MapWrapperRegistry.getPendingPolygons("event1")?.renderMode,
+        )
+    }
+
+    @Test
+    fun testTakePendingPolygons_ConsumesOnceAndKeepsLaterFrames() {
+        MapWrapperRegistry.setPendingPolygons("event1", listOf(listOf(Pair(0.0, 0.0))), true)
+
+        assertNotNull(MapWrapperRegistry.takePendingPolygons("event1"))
+        assertFalse(MapWrapperRegistry.hasPendingPolygons("event1"))
+        assertNull(MapWrapperRegistry.takePendingPolygons("event1"))
+
+        // A frame published after the take (while Swift renders) stays pending for the next render
+        MapWrapperRegistry.setPendingPolygons("event1", listOf(listOf(Pair(1.0, 1.0))), false)
+        assertEquals(false, MapWrapperRegistry.takePendingPolygons("event1")?.clearExisting)
+    }
+
+    @Test
+    fun testClearExecutedCameraCommand_KeepsNewerAnimation() {
+        val first = CameraCommand.AnimateToPosition(Position(1.0, 1.0), 10.0)
+        val newer = CameraCommand.AnimateToPosition(Position(2.0, 2.0), 12.0)
+        MapWrapperRegistry.setPendingCameraCommand("event1", first)
+
+        val executing = MapWrapperRegistry.getPendingCameraCommand("event1")
+        MapWrapperRegistry.setPendingCameraCommand("event1", newer)
+        MapWrapperRegistry.clearPendingCameraCommand("event1", assertNotNull(executing))
+
+        assertEquals(newer, MapWrapperRegistry.getPendingCameraCommand("event1"))
+        MapWrapperRegistry.clearPendingCameraCommand("event1", newer)
+        assertFalse(MapWrapperRegistry.hasPendingCameraCommand("event1"))
+    }
+
+    @Test
+    fun testClearExecutedCameraCommand_ConfigQueueStaysFifo() {
+        val minZoom = CameraCommand.SetMinZoom(3.0)
+        val maxZoom = CameraCommand.SetMaxZoom(16.0)
+        MapWrapperRegistry.setPendingCameraCommand("event1", minZoom)
+        MapWrapperRegistry.setPendingCameraCommand("event1", maxZoom)
+
+        // Clearing a command that is not the head leaves the queue untouched
+        MapWrapperRegistry.clearPendingCameraCommand("event1", maxZoom)
+        assertEquals(minZoom, MapWrapperRegistry.getPendingCameraCommand("event1"))
+
+        MapWrapperRegistry.clearPendingCameraCommand("event1", minZoom)
+        assertEquals(maxZoom, MapWrapperRegistry.getPendingCameraCommand("event1"))
+    }
+
+    @Test
+    fun testHandle_IsStableUntilUnregister() {
+        val state = MapWrapperRegistry.handle("event1")
+        assertTrue(state === MapWrapperRegistry.handle("event1"))
+
+        MapWrapperRegistry.unregisterWrapper("event1")
+        assertFalse(state === MapWrapperRegistry.handle("event1"))
+    }
 }
@@ -0,0 +1,99 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.test.AfterTest
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFailsWith
+import kotlin.test.assertNotNull
+
+class PackedPolygonBufferTest {
+    @BeforeTest
+    fun setup() {
+        MapWrapperRegistry.clear()
+    }
+
+    @AfterTest
+    fun cleanup() {
+        MapWrapperRegistry.clear()
+    }
+
+    @Test
+    fun `fromPolygons interleaves lat lng and records ring offsets`() {
+        val first = Polygon.fromPositions(Position(1.0, 2.0), Position(3.0, 4.0), Position(5.0, 6.0))
+        val second = Polygon.fromPositions(Position(7.0, 8.0), Position(9.0, 10.0))
+
+        val packed = PackedPolygonBuffer.fromPolygons(listOf(first, second))
+
+        assertEquals(2, packed.ringCount)
+        assertEquals(5, packed.vertexCount)
+        assertContentEquals(intArrayOf(0, 3, 5), packed.ringOffsets)
+        assertContentEquals(
+            doubleArrayOf(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0),
+            packed.coordinates,
+        )
+    }
+
+    @Test
+    fun `fromPairs round trips through toPairs`() {
+        val pairs = listOf(listOf(Pair(48.8, 2.3), Pair(48.9, 2.4)), emptyList(), listOf(Pair(1.0, 1.0)))
+
+        val packed = PackedPolygonBuffer.fromPairs(pairs)
+
+        assertEquals(3, packed.ringCount)
+        assertEquals(0, packed.ringSize(1))
+        assertEquals(pairs, packed.toPairs())
+    }
+
+    @Test
+    fun `NSData views have expected byte lengths`() {
+        val packed = PackedPolygonBuffer.fromPairs(listOf(listOf(Pair(0.0, 0.0), Pair(1.0, 1.0))))
+
+        assertEquals((4 * Double.SIZE_BYTES).toULong(), packed.coordinateData().length)
+        assertEquals((2 * Int.SIZE_BYTES).toULong(), packed.ringOffsetData().length)
+        assertEquals(0uL, PackedPolygonBuffer.EMPTY.coordinateData().length)
+    }
+
+    @Test
+    fun `inconsistent offsets are rejected`() {
+        assertFailsWith<IllegalArgumentException> {
+            PackedPolygonBuffer(doubleArrayOf(0.0, 0.0), intArrayOf(0, 2))
+        }
+    }
+
+    @Test
+    fun `registry stores packed form and exposes legacy view`() {
+        val eventId = "packed-event"
+        val polygon = Polygon.fromPositions(Position(10.0, 20.0), Position(11.0, 21.0), Position(12.0, 22.0))
+
+        MapWrapperRegistry.setPendingPolygons(eventId, PackedPolygonBuffer.fromPolygons(listOf(polygon)), true)
+
+        val pending = assertNotNull(MapWrapperRegistry.getPendingPolygons(eventId))
+        assertEquals(1, pending.packed.ringCount)
+        assertEquals(listOf(Pair(10.0, 20.0), Pair(11.0, 21.0), Pair(12.0, 22.0)), pending.coordinates[0])
+    }
+}
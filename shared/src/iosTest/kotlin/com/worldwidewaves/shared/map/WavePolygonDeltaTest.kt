@@ -0,0 +1,170 @@
+package com.worldwidewaves.shared.map
+
+/*
+ * Copyright 2025 DrWave
+ *
+ * WorldWideWaves is an ephemeral mobile app designed to orchestrate human waves through cities and
+ * countries. The project aims to transcend physical and cultural
+ * boundaries, fostering unity, community, and shared human experience by leveraging real-time
+ * coordination and location-based services.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+import com.worldwidewaves.shared.events.utils.Polygon
+import com.worldwidewaves.shared.events.utils.Position
+import kotlin.test.AfterTest
+import kotlin.test.BeforeTest
+import kotlin.test.Test
+import kotlin.test.assertContentEquals
+import kotlin.test.assertEquals
+import kotlin.test.assertFalse
+import kotlin.test.assertNotNull
+import kotlin.test.assertNull
+import kotlin.test.assertTrue
+
+class WavePolygonDeltaTest {
+    private val behind = square(0.0, 0.0)
+    private val otherBehind = square(5.0, 5.0)
+
+    @BeforeTest
+    fun setup() {
+        MapWrapperRegistry.clear()
+    }
+
+    @AfterTest
+    fun cleanup() {
+        MapWrapperRegistry.clear()
+    }
+
+    @Test
+    fun `first frame requires full send and identical frame yields empty delta`() {
+        val encoder = WavePolygonDeltaEncoder()
+
+        assertNull(encoder.encode(listOf(behind, front(1.0))))
+        val delta = assertNotNull(encoder.encode(listOf(behind, front(1.0))))
+
+        assertTrue(delta.isEmpty)
+        assertEquals(0, delta.changed.vertexCount)
+    }
+
+    @Test
+    fun `only rings crossed by the front are sent`() {
+        val encoder = WavePolygonDeltaEncoder()
+        encoder.encode(listOf(behind, otherBehind, front(1.0)))
+
+        val delta = assertNotNull(encoder.encode(listOf(behind, otherBehind, front(1.5))))
+
+        assertEquals(3, delta.baseRingCount)
+        assertEquals(3, delta.ringCount)
+        assertContentEquals(intArrayOf(2), delta.changedIndices)
+        assertEquals(front(1.5).size, delta.changed.vertexCount)
+    }
+
+    @Test
+    fun `new and removed rings change the ring count`() {
+        val encoder = WavePolygonDeltaEncoder()
+        encoder.encode(listOf(behind))
+
+        val grown = assertNotNull(encoder.encode(listOf(behind, front(1.0))))
+        assertEquals(2, grown.ringCount)
+        assertContentEquals(intArrayOf(1), grown.changedIndices)
+
+        val shrunk = assertNotNull(encoder.encode(listOf(behind)))
+        assertEquals(1, shrunk.ringCount)
+        assertEquals(0, shrunk.changedIndices.size)
+        assertFalse(shrunk.isEmpty)
+    }
+
+    @Test
+    fun `merged deltas equal sequential application`() {
+        val frames =
+            listOf(
+                listOf(behind, front(1.0)),
+                listOf(behind, otherBehind, front(2.0)),
+                listOf(behind, front(3.0)),
+            )
+        val encoder = WavePolygonDeltaEncoder()
+        val base = PackedPolygonBuffer.fromPolygons(frames[0])
+        encoder.encode(frames[0])
+        val first = assertNotNull(encoder.encode(frames[1]))
+        val second = assertNotNull(encoder.encode(frames[2]))
+
+        val sequential = second.applyTo(first.applyTo(base))
+        val merged = first.merge(second).applyTo(base)
+
+        assertContentEquals(PackedPolygonBuffer.fromPolygons(frames[2]).coordinates, sequential.coordinates)
+        assertContentEquals(sequential.coordinates, merged.coordinates)
+        assertContentEquals(sequential.ringOffsets, merged.ringOffsets)
+    }
+
+    @Test
+    fun `registry folds delta into pending full frame`() {
+        val eventId = "delta-full"
+        val encoder = WavePolygonDeltaEncoder()
+        val initial = listOf(behind, front(1.0))
+        encoder.encode(initial)
+        MapWrapperRegistry.setPendingPolygons(eventId, PackedPolygonBuffer.fromPolygons(initial), true)
+
+        val next = listOf(behind, front(2.0))
+        MapWrapperRegistry.setPendingPolygonDelta(eventId, assertNotNull(encoder.encode(next)), clearExisting = true)
+
+        val pending = assertNotNull(MapWrapperRegistry.getPendingPolygons(eventId))
+        assertFalse(pending.isDelta)
+        assertContentEquals(PackedPolygonBuffer.fromPolygons(next).coordinates, pending.packed.coordinates)
+    }
+
+    @Test
+    fun `registry merges consecutive unconsumed deltas`() {
+        val eventId = "delta-merge"
+        val encoder = WavePolygonDeltaEncoder()
+        encoder.encode(listOf(behind, front(1.0)))
+
+        MapWrapperRegistry.setPendingPolygonDelta(eventId, assertNotNull(encoder.encode(listOf(behind, front(2.0)))), true)
+        MapWrapperRegistry.setPendingPolygonDelta(eventId, assertNotNull(encoder.encode(listOf(behind, front(3.0)))), true)
+
+        val delta = assertNotNull(MapWrapperRegistry.getPendingPolygons(eventId)?.delta)
+        assertEquals(2, delta.baseRingCount)
+        assertContentEquals(intArrayOf(1), delta.changedIndices)
+        assertContentEquals(PackedPolygonBuffer.fromPolygons(listOf(front(3.0))).coordinates, delta.changed.coordinates)
+    }
+
+    @Test
+    fun `registering a wrapper requests one full resync`() {
+        val eventId = "delta-resync"
+
+        MapWrapperRegistry.registerWrapper(eventId, Any())
+
+        assertTrue(MapWrapperRegistry.consumeFullPolygonResync(eventId))
+        assertFalse(MapWrapperRegistry.consumeFullPolygonResync(eventId))
+    }
+
+    private fun square(
+        lat: Double,
+        lng: Double,
+    ) = Polygon.fromPositions(
+        Position(lat, lng),
+        Position(lat + 1.0, lng),
+        Position(lat + 1.0, lng + 1.0),
+        Position(lat, lng + 1.0),
+    )
+
+    /** Strip whose east edge is the cut longitude. */
+    private fun front(cut: Double) =
+        Polygon.fromPositions(
+            Position(10.0, 0.0),
+            Position(11.0, 0.0),
+            Position(11.0, cut),
+            Position(10.0, cut),
+        )
+}